@@ -13,15 +13,21 @@ class ILogger;
 
 // Storage format constants
 #define CONFIG_MAGIC 0x52454D55  // "REMU" in little-endian ASCII
-#define CONFIG_VERSION 1
+#define CONFIG_VERSION 2
 #define MAX_TYPE_NAME_LEN 16
 #define MAX_OPTION_DATA_LEN 32
 
+// Device state (IEmulatedDevice::saveState) follows the StoredConfig:
+// STATE_MAGIC, then for each stored device in order a 16-bit length and
+// that many bytes (length 0 = nothing saved)
+#define STATE_MAGIC 0x54415453   // "STAT" in little-endian ASCII
+
 // Stored configuration for a single device
 struct StoredDeviceConfig {
     uint8_t valid;                          // 0x00 = empty, 0x01 = valid
     char typeName[MAX_TYPE_NAME_LEN];       // Null-terminated device type
     uint8_t uartIndex;                      // UART number (1-based)
+    uint8_t extraUarts[DEVICE_MAX_PORTS - 1]; // Attached UARTs (0 = unused)
     uint8_t optionCount;                    // Number of options stored
     uint8_t optionData[MAX_OPTION_DATA_LEN]; // Serialized option values
 };
@@ -36,7 +42,7 @@ struct StoredConfig {
 };
 
 // Configuration storage manager
-// Handles persistence of device configuration to EEPROM
+// Handles persistence of device configuration and device state to EEPROM
 class ConfigStorage {
 public:
     // Initialize EEPROM storage (call in setup before loading)
@@ -72,5 +78,9 @@ private:
     static bool serializeDevice(IEmulatedDevice* device, StoredDeviceConfig& config);
 
     // Restore a device from stored format
-    static bool restoreDevice(const StoredDeviceConfig& config, DeviceManager& mgr);
+    // Returns the device ID, or 0xFF on failure
+    static uint8_t restoreDevice(const StoredDeviceConfig& config, DeviceManager& mgr);
+
+    // Write the state blocks of the stored devices after the configuration
+    static void writeState(DeviceManager& mgr, const uint8_t* deviceIds, uint8_t count);
 };
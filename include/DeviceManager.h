@@ -9,6 +9,11 @@
 #include "ISerialPort.h"
 #include "ILogger.h"
 
+struct SerialTxStats;
+class QueuedSerialPort;
+class CaptureSerialPort;
+class TimedSerialPort;
+
 // Manages device factories, device instances, and UART allocation
 class DeviceManager {
 public:
@@ -48,9 +53,17 @@ public:
     uint8_t createDeviceWithOptions(const char* typeName, uint8_t uartIndex,
                                      const uint8_t* optionData, size_t optionLen);
 
-    // Destroy a device by ID
+    // Destroy a device by ID, freeing every UART it is served on
     bool destroyDevice(uint8_t deviceId);
 
+    // Also serve a device on another UART, sharing its state
+    // (e.g., a logger and WSJT-X talking to one radio)
+    bool attachUart(uint8_t deviceId, uint8_t uartIndex);
+
+    // Stop serving a device on an attached UART and free it
+    // A device's primary UART is freed only by destroying the device
+    bool detachUart(uint8_t uartIndex);
+
     // === Device Access ===
 
     // Get number of active devices
@@ -67,10 +80,39 @@ public:
     // Check if a UART is available for use
     bool isUartAvailable(uint8_t uartIndex) const;
 
+    // Check if a device of typeName can be created on a UART: it is free,
+    // or its devices are stations on the same bus as the new one
+    bool isUartAvailableFor(const char* typeName, uint8_t uartIndex);
+
     // Get serial port wrapper for a UART index
     // Creates wrapper if not already created
     ISerialPort* getSerialForUart(uint8_t uartIndex);
 
+    // Install a serial backend for a UART in place of the platform default
+    // (e.g., a socket instead of a pty on the host build). Takes ownership
+    // of port. Fails if a device is using the UART.
+    bool setSerialPort(uint8_t uartIndex, ISerialPort* port);
+
+    // Get description of a UART for display: the port name if the backend
+    // has one (e.g., a pty path), otherwise the pin assignment
+    // Returns nullptr if the UART does not exist on this platform
+    const char* getUartDescription(uint8_t uartIndex) const;
+
+    // Get TX queue statistics for a UART
+    // Returns false if the UART has no port yet
+    bool getTxStats(uint8_t uartIndex, SerialTxStats& stats, size_t& queued, size_t& queueSize) const;
+
+#if defined(PLATFORM_HOST)
+    // Pace ports created from now on at their configured baud rate and frame
+    // format, like a real UART (virtual ports are otherwise instant)
+    void setLineTiming(bool enabled) { _lineTiming = enabled; }
+
+    // Microseconds until a paced port next has a byte due or a device has
+    // a delayed reply due, so the main loop can sleep until then
+    // (TIMED_IDLE_US if none)
+    uint32_t getNextEventUs();
+#endif
+
     // === Logger ===
 
     // Set the logger to use for all devices
@@ -78,7 +120,7 @@ public:
 
     // === Main Loop ===
 
-    // Call update() on all running devices
+    // Call update() on all running devices, then drain their TX queues
     void updateAll();
 
 private:
@@ -93,10 +135,15 @@ private:
     IDeviceFactory* _deviceFactories[MAX_DEVICES];
 
     // UART allocation (which device ID is using each UART, 0xFF = free)
+    // Several UARTs may map to one device; on a shared bus UART this is the
+    // first device created on it
     uint8_t _uartAllocation[PLATFORM_MAX_UARTS];
 
-    // Serial port wrappers
+    // Serial port wrappers (hardware port, capture tap, and the TX queue
+    // in front of them)
     ISerialPort* _serialPorts[PLATFORM_MAX_UARTS];
+    CaptureSerialPort* _capturePorts[PLATFORM_MAX_UARTS];
+    QueuedSerialPort* _txQueues[PLATFORM_MAX_UARTS];
 
     // Logger instance
     ILogger* _logger;
@@ -104,9 +151,25 @@ private:
     // Next device ID to assign
     uint8_t _nextDeviceId;
 
+#if defined(PLATFORM_HOST)
+    // Line timing between the port and its TX queue, when enabled
+    TimedSerialPort* _timedPorts[PLATFORM_MAX_UARTS];
+    bool _lineTiming;
+#endif
+
     // Find free device slot
     uint8_t findFreeDeviceSlot() const;
 
+    // Check if a UART exists on this platform
+    bool uartExists(uint8_t uartIndex) const;
+
+    // Check if a device of factory can join the devices on an allocated
+    // UART (both are stations on the same bus)
+    bool canShareUart(const IDeviceFactory* factory, uint8_t uartIndex) const;
+
     // Initialize serial port for UART
     bool initSerialPort(uint8_t uartIndex);
+
+    // Create the platform's serial port for a UART
+    bool createSerialPort(uint8_t uartIndex);
 };
@@ -86,27 +86,51 @@ inline DeviceOption makeStringOption(const char* name, const char* desc, const c
     return opt;
 }
 
+// Copy str into buffer, cut off to fit, returns bytes written
+inline size_t copyOptionText(char* buffer, size_t bufLen, const char* str) {
+    if (bufLen == 0) {
+        return 0;
+    }
+    size_t len = strlen(str);
+    if (len >= bufLen) {
+        len = bufLen - 1;
+    }
+    memcpy(buffer, str, len);
+    buffer[len] = '\0';
+    return len;
+}
+
 // Format option value to string buffer, returns bytes written
 inline size_t formatOptionValue(const DeviceOption& opt, char* buffer, size_t bufLen) {
     switch (opt.type) {
-        case OptionType::UINT32:
-            return snprintf(buffer, bufLen, "%lu", (unsigned long)opt.value.uint32Val.current);
+        case OptionType::UINT32: {
+            // Decimal, without pulling in snprintf
+            char digits[11];
+            char* p = digits + sizeof(digits) - 1;
+            *p = '\0';
+            uint32_t value = opt.value.uint32Val.current;
+            do {
+                *--p = (char)('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            return copyOptionText(buffer, bufLen, p);
+        }
 
         case OptionType::BOOL:
-            return snprintf(buffer, bufLen, "%s", opt.value.boolVal ? "true" : "false");
+            return copyOptionText(buffer, bufLen, opt.value.boolVal ? "true" : "false");
 
         case OptionType::ENUM:
             if (opt.value.enumVal.current < opt.value.enumVal.count) {
-                return snprintf(buffer, bufLen, "%s",
-                               opt.value.enumVal.values[opt.value.enumVal.current]);
+                return copyOptionText(buffer, bufLen,
+                                      opt.value.enumVal.values[opt.value.enumVal.current]);
             }
-            return snprintf(buffer, bufLen, "?");
+            return copyOptionText(buffer, bufLen, "?");
 
         case OptionType::STRING:
-            return snprintf(buffer, bufLen, "%s", opt.value.stringVal);
+            return copyOptionText(buffer, bufLen, opt.value.stringVal);
 
         default:
-            return snprintf(buffer, bufLen, "?");
+            return copyOptionText(buffer, bufLen, "?");
     }
 }
 
@@ -114,8 +138,10 @@ inline size_t formatOptionValue(const DeviceOption& opt, char* buffer, size_t bu
 inline bool parseOptionValue(DeviceOption& opt, const char* str) {
     switch (opt.type) {
         case OptionType::UINT32: {
+            // Decimal, or hex with a 0x prefix (e.g., CI-V addresses)
+            int base = (str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) ? 16 : 10;
             char* endptr;
-            unsigned long val = strtoul(str, &endptr, 10);
+            unsigned long val = strtoul(str, &endptr, base);
             if (*endptr != '\0') return false;
             if (val < opt.value.uint32Val.min || val > opt.value.uint32Val.max) return false;
             opt.value.uint32Val.current = (uint32_t)val;
@@ -7,6 +7,12 @@
 #include "ILogger.h"
 #include "DeviceOption.h"
 
+// Returned by IEmulatedDevice::getNextEventUs() when nothing is scheduled
+#define DEVICE_IDLE_US 0xFFFFFFFFUL
+
+class ISerialPort;
+class IStateStream;
+
 // Device categories for grouping and default aliases
 enum class DeviceCategory : uint8_t {
     RADIO = 0,
@@ -75,9 +81,26 @@ public:
     // Set device instance ID (called by DeviceManager)
     virtual void setDeviceId(uint8_t id) = 0;
 
-    // Get UART index this device is using
+    // Get UART index this device was created on (its primary port)
     virtual uint8_t getUartIndex() const = 0;
 
+    // === Ports ===
+
+    // Also serve the device on another port (called by DeviceManager)
+    // State is shared; the port gets its own command parser
+    // Returns false if the device has no free port slot
+    virtual bool attachPort(ISerialPort* serial, uint8_t uartIndex) = 0;
+
+    // Stop serving the device on an attached port (called by DeviceManager)
+    // The primary port cannot be detached
+    virtual bool detachPort(uint8_t uartIndex) = 0;
+
+    // Get number of ports the device is served on, including the primary
+    virtual size_t getPortCount() const = 0;
+
+    // Get UART index of a port (index 0 is the primary), 0 if out of range
+    virtual uint8_t getPortUart(size_t index) const = 0;
+
     // === Options ===
 
     // Get number of configurable options
@@ -105,6 +128,14 @@ public:
     // Returns true on success
     virtual bool deserializeOptions(const uint8_t* buffer, size_t len) = 0;
 
+    // Save state that is edited at run time rather than configured (e.g.
+    // radio memory channels), after the options. Devices without such
+    // state keep the defaults.
+    virtual bool saveState(IStateStream& out) { return true; }
+
+    // Restore state written by saveState()
+    virtual bool loadState(IStateStream& in) { return true; }
+
     // === Meter Simulation ===
 
     // Set a meter value for simulation (console-controlled)
@@ -118,6 +149,13 @@ public:
     // Set the logger instance for this device
     virtual void setLogger(ILogger* logger) = 0;
 
+    // === Timing ===
+
+    // Microseconds until the device has output due without new input
+    // (e.g. a reply held back by a latency option), so a main loop that
+    // sleeps can wake in time; DEVICE_IDLE_US if nothing is scheduled
+    virtual uint32_t getNextEventUs() const { return DEVICE_IDLE_US; }
+
     // === Status ===
 
     // Check if device is currently running
@@ -141,6 +179,11 @@ public:
     // Get device category (radio, rotator, gps)
     virtual DeviceCategory getCategory() const = 0;
 
+    // Name of the multi-drop bus the devices are stations on, or nullptr
+    // Devices whose factories name the same bus can share one UART, told
+    // apart by their bus addresses (e.g., Icom radios on one CI-V line)
+    virtual const char* getBus() const { return nullptr; }
+
     // Create a new device instance
     // serial: The serial port for this device to use
     // uartIndex: Which UART number (1, 2, etc.)
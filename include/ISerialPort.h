@@ -26,6 +26,13 @@ public:
     // Read multiple bytes into buffer, returns number of bytes read
     virtual size_t readBytes(uint8_t* buffer, size_t length) = 0;
 
+    // Drain up to length already-buffered bytes into buffer (never waits)
+    // Returns number of bytes read, 0 if nothing is available
+    virtual size_t readAvailable(uint8_t* buffer, size_t length) = 0;
+
+    // Returns the number of bytes that can be written without blocking
+    virtual int availableForWrite() = 0;
+
     // Write a single byte
     virtual size_t write(uint8_t byte) = 0;
 
@@ -38,9 +45,22 @@ public:
     // Write a string followed by newline
     virtual size_t println(const char* str) = 0;
 
+    // Record output the caller discarded because there was no room for it
+    // (whole messages skipped rather than sent in part); ports that keep
+    // TX statistics count these bytes as dropped
+    virtual void noteDropped(size_t size) { (void)size; }
+
     // Wait for outgoing data to be transmitted
     virtual void flush() = 0;
 
+    // Do background work such as accepting connections or sending batched
+    // output. Called once per main loop iteration, must be non-blocking
+    virtual void service() = 0;
+
     // Check if port is initialized
     virtual bool isOpen() const = 0;
+
+    // Get a display name for the port (e.g., "/dev/pts/3")
+    // Returns nullptr if the port is only identified by its UART pins
+    virtual const char* getPortName() const = 0;
 };
@@ -0,0 +1,20 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// Sequential access to a device's block of saved state (see
+// IEmulatedDevice::saveState). Blocks are small and bounded by the space
+// left in EEPROM, so writes fail once the block is full.
+class IStateStream {
+public:
+    virtual ~IStateStream() = default;
+
+    // Append bytes, returns false if they do not fit
+    virtual bool write(const void* data, size_t len) = 0;
+
+    // Read the next bytes, returns false past the end of the block
+    virtual bool read(void* data, size_t len) = 0;
+};
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "platform_config.h"
+
+// Capture format constants
+#define CAPTURE_MAGIC 0x50414353  // "SCAP" in little-endian ASCII
+#define CAPTURE_VERSION 1
+
+// Record flag: bytes sent by the device (otherwise received)
+#define CAPTURE_DIR_TX 0x80
+
+// Capture buffer header
+// The buffer is the capture format: this header followed by a power-of-2
+// data ring of records. On the host build the buffer is a memory-mapped
+// file, so the file on disk is always a complete capture. All fields are
+// little-endian.
+struct CaptureHeader {
+    uint32_t magic;       // CAPTURE_MAGIC
+    uint8_t version;      // CAPTURE_VERSION
+    uint8_t reserved[3];  // Padding for alignment
+    uint32_t capacity;    // Size of the data ring in bytes
+    uint32_t head;        // Free-running offset where the next record goes
+    uint32_t tail;        // Free-running offset of the oldest record
+    uint32_t overwritten; // Records lost to make room for newer ones
+};
+
+// Record in the data ring (may wrap around the end of the ring)
+//   uint32_t timestamp   micros() when the bytes crossed the port
+//   uint8_t  port        UART index | CAPTURE_DIR_TX
+//   uint8_t  length      Number of data bytes (1-255)
+//   uint8_t  data[length]
+#define CAPTURE_RECORD_HEADER 6
+#define CAPTURE_MAX_CHUNK 255
+
+// Serial traffic capture
+// Records each chunk a port reads or writes as one timestamped record, so
+// the cost is a header per chunk plus a copy of the bytes. The ring keeps
+// the most recent traffic and drops the oldest records when full.
+class SerialCapture {
+public:
+    // Set up buffer, which holds the header and the data ring, as an empty
+    // capture. size - sizeof(CaptureHeader) is rounded down to a power of 2
+    // Capture starts once UARTs are enabled
+    static bool begin(uint8_t* buffer, size_t size);
+
+    // Check if a capture buffer is set up
+    static bool isReady() { return _header != nullptr; }
+
+    // Enable or disable capture for a UART (0 = all UARTs)
+    static void setEnabled(uint8_t uartIndex, bool enabled);
+
+    // Check if a UART is being captured
+    static bool isEnabled(uint8_t uartIndex) {
+        return (_enabledMask & (1UL << (uartIndex - 1))) != 0;
+    }
+
+    // Record a chunk of traffic on a UART
+    static void record(uint8_t uartIndex, bool tx, const uint8_t* data, size_t len) {
+        if (len > 0 && isEnabled(uartIndex) && _header != nullptr) {
+            append(uartIndex, tx, data, len);
+        }
+    }
+
+    // Discard all captured records
+    static void clear();
+
+    // Access the raw buffer (header + ring) for dumping
+    static const uint8_t* getBuffer() { return (const uint8_t*)_header; }
+    static size_t getBufferSize();
+
+    // Statistics
+    static size_t getUsed();
+    static uint32_t getOverwritten();
+
+private:
+    static CaptureHeader* _header;
+    static uint8_t* _ring;
+    static uint32_t _mask;
+    static uint32_t _enabledMask;
+
+    static void append(uint8_t uartIndex, bool tx, const uint8_t* data, size_t len);
+    static void put(uint32_t offset, const uint8_t* data, size_t len);
+};
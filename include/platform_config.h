@@ -89,6 +89,37 @@
     #define UART_2_PINS "TX=16, RX=17"
     #define UART_3_PINS "TX=14, RX=15"
 
+    // 8 KB of RAM: keep the capture ring small
+    #define CAPTURE_BUFFER_SIZE 1024
+
+#elif defined(PLATFORM_HOST)
+    // Linux host build (env:native)
+    // Every device UART is a pseudo-terminal created on first use
+    #define PLATFORM_NAME "Linux"
+    #define PLATFORM_MAX_UARTS 32
+    #define MAX_DEVICES 32
+    #define EEPROM_SIZE 8192
+    #define YAESU_TAG_SLOTS 117  // A tag for every memory channel
+    #define CAPTURE_BUFFER_SIZE (1024UL * 1024UL)  // Capture ring in the capture file
+    #ifndef REPLY_DELAY_QUEUE_SIZE
+    #define REPLY_DELAY_QUEUE_SIZE 65536  // Delayed replies per port
+    #endif
+    #ifndef REPLY_DELAY_ENTRIES
+    #define REPLY_DELAY_ENTRIES 4096
+    #endif
+
+    #define HAS_SERIAL1 1
+    #define HAS_SERIAL2 1
+    #define HAS_SERIAL3 1
+    #define HAS_SERIAL4 1
+    #define HAS_SERIAL5 1
+    #define HAS_SERIAL6 1
+    #define HAS_SERIAL7 1
+    #define HAS_SERIAL8 1
+
+    // All UARTs share one description until the pty exists
+    #define UART_DEFAULT_PINS "pty"
+
 #elif defined(ARDUINO_ARCH_ESP32)
     // ESP32
     #define PLATFORM_NAME "ESP32"
@@ -168,13 +199,54 @@
 #define COMMAND_BUFFER_SIZE 128
 #define CAT_BUFFER_SIZE 64
 #define LOG_BUFFER_SIZE 256
+#define SERIAL_RX_CHUNK_SIZE 32  // Bytes drained from a port per bulk read
+#define REPLY_BATCH_SIZE 64      // Replies to one input burst, staged on the stack and sent in one write
+#define SERIAL_TX_QUEUE_SIZE 512 // Software TX ring per device UART (power of two)
+
+// Replies held back by the device latency options, per port, allocated
+// when a latency is set. At 38400 baud a 50 ms latency keeps under 200
+// bytes in flight, so a board needs little; virtual ports on the host
+// have no line rate and get more.
+#ifndef REPLY_DELAY_QUEUE_SIZE
+#define REPLY_DELAY_QUEUE_SIZE 256  // Bytes (power of two)
+#endif
+#ifndef REPLY_DELAY_ENTRIES
+#define REPLY_DELAY_ENTRIES 32      // Replies (power of two)
+#endif
+#ifndef CAPTURE_BUFFER_SIZE
+#define CAPTURE_BUFFER_SIZE 4096 // Serial capture ring (power of two), allocated on first use
+#endif
 
 // Maximum devices
+#ifndef MAX_DEVICES
 #define MAX_DEVICES 8
-#define MAX_DEVICE_FACTORIES 8
+#endif
+// Device types (factories); each CAT and Icom model is one
+#define MAX_DEVICE_FACTORIES 12
+
+// Ports (UARTs) one device can be served on at once, e.g. a logger and
+// WSJT-X sharing one radio
+#ifndef DEVICE_MAX_PORTS
+#define DEVICE_MAX_PORTS 4
+#endif
+
+// Icom radios that can share one UART as a CI-V bus
+#ifndef CIV_BUS_MAX_RADIOS
+#define CIV_BUS_MAX_RADIOS 8
+#endif
 
 // EEPROM configuration
-#define EEPROM_SIZE 512  // Bytes to allocate for EEPROM storage
+// Device configuration uses about 450 bytes; device state (FT-991A memory
+// channels, about 700 bytes per radio) follows it
+#ifndef EEPROM_SIZE
+#define EEPROM_SIZE 2048  // Bytes to allocate for EEPROM storage
+#endif
+
+// FT-991A memory-channel tags written with MT that are held in RAM (13
+// bytes each); preset tags are read from flash and need no slot
+#ifndef YAESU_TAG_SLOTS
+#define YAESU_TAG_SLOTS 16
+#endif
 
 // Default device type aliases for each category
 // Used when user specifies category name (e.g., "create radio 1")
@@ -210,6 +282,11 @@ inline const char* getUartPins(uint8_t uartIndex) {
 #ifdef UART_8_PINS
         case 8: return UART_8_PINS;
 #endif
+#ifdef UART_DEFAULT_PINS
+        default:
+            return (uartIndex >= 1 && uartIndex <= PLATFORM_MAX_UARTS) ? UART_DEFAULT_PINS : nullptr;
+#else
         default: return nullptr;
+#endif
     }
 }
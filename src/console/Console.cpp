@@ -3,7 +3,12 @@
 
 #include "Console.h"
 #include "ConfigStorage.h"
+#include "SerialCapture.h"
+#include "core/FixedWriter.h"
+#include "core/QueuedSerialPort.h"
 #include "devices/nmea_gps/NMEAGPSDevice.h"
+#include "devices/icom/IcomDevice.h"
+#include "devices/yaesu/YaesuDevice.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
@@ -16,6 +21,8 @@ static const ConsoleCommand commands[] = {
     {"devices", "devices",                  "List active device instances",         cmdDevices},
     {"create",  "create <type> <uart>",     "Create device on UART (e.g., create radio 1)", cmdCreate},
     {"destroy", "destroy <id>",             "Destroy device by ID",                 cmdDestroy},
+    {"attach",  "attach <id> <uart>",       "Also serve device on another UART",    cmdAttach},
+    {"detach",  "detach <uart>",            "Stop serving a device on an attached UART", cmdDetach},
     {"start",   "start <id>",               "Start device",                         cmdStart},
     {"stop",    "stop <id>",                "Stop device",                          cmdStop},
     {"status",  "status [id]",              "Show device status",                   cmdStatus},
@@ -30,6 +37,9 @@ static const ConsoleCommand commands[] = {
     {"clear",   "clear",                    "Clear stored configuration",           cmdClear},
     {"gps",     "gps <id> <lat> <lon> [alt]", "Set GPS position (decimal degrees)",  cmdGps},
     {"time",    "time <id> <HH:MM:SS> [YYYY-MM-DD]", "Set GPS time (UTC)",         cmdTime},
+    {"tune",    "tune <id> <hz>",           "Turn an Icom radio's dial (transceive)", cmdTune},
+    {"sat",     "sat <id> tle|station|time|pass", "Satellite elements, station and clock", cmdSat},
+    {"capture", "capture [on|off [uart]|clear|dump]", "Capture serial traffic",      cmdCapture},
     {nullptr, nullptr, nullptr, nullptr}
 };
 
@@ -39,6 +49,7 @@ Console::Console(Stream& stream, DeviceManager& deviceMgr, ILogger& logger)
     , _logger(logger)
     , _cmdLen(0)
     , _echoEnabled(true)
+    , _escapeSkip(0)
 {
     memset(_cmdBuffer, 0, sizeof(_cmdBuffer));
 }
@@ -49,49 +60,67 @@ void Console::begin() {
 }
 
 void Console::update() {
-    while (_stream.available()) {
-        char c = _stream.read();
-
-        // Handle backspace
-        if (c == '\b' || c == 127) {
-            if (_cmdLen > 0) {
-                _cmdLen--;
-                if (_echoEnabled) {
-                    _stream.print("\b \b");
-                }
-            }
-            continue;
+    uint8_t chunk[SERIAL_RX_CHUNK_SIZE];
+    int avail;
+
+    while ((avail = _stream.available()) > 0) {
+        // Only request bytes that are already buffered so readBytes() never waits
+        size_t want = ((size_t)avail < sizeof(chunk)) ? (size_t)avail : sizeof(chunk);
+        size_t count = _stream.readBytes(chunk, want);
+        if (count == 0) {
+            break;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            processChar((char)chunk[i]);
         }
+    }
+}
+
+void Console::processChar(char c) {
+    // Skip remaining bytes of an escape sequence (arrow keys, etc.)
+    if (_escapeSkip > 0) {
+        _escapeSkip--;
+        return;
+    }
 
-        // Handle enter
-        if (c == '\r' || c == '\n') {
+    // Handle backspace
+    if (c == '\b' || c == 127) {
+        if (_cmdLen > 0) {
+            _cmdLen--;
             if (_echoEnabled) {
-                _stream.println();
+                _stream.print("\b \b");
             }
-            if (_cmdLen > 0) {
-                _cmdBuffer[_cmdLen] = '\0';
-                processCommand();
-                _cmdLen = 0;
-            }
-            printPrompt();
-            continue;
         }
+        return;
+    }
 
-        // Handle escape sequences (arrow keys, etc.) - ignore
-        if (c == 27) {
-            // Skip next two chars of escape sequence
-            while (_stream.available() < 2) { delay(1); }
-            _stream.read();
-            _stream.read();
-            continue;
+    // Handle enter
+    if (c == '\r' || c == '\n') {
+        if (_echoEnabled) {
+            _stream.println();
+        }
+        if (_cmdLen > 0) {
+            _cmdBuffer[_cmdLen] = '\0';
+            processCommand();
+            _cmdLen = 0;
         }
+        printPrompt();
+        return;
+    }
 
-        // Add printable characters to buffer
-        if (c >= 32 && c < 127 && _cmdLen < COMMAND_BUFFER_SIZE - 1) {
-            _cmdBuffer[_cmdLen++] = c;
-            if (_echoEnabled) {
-                _stream.print(c);
-            }
+    // Handle escape sequences - ignore the next two chars, even if they
+    // arrive in a later chunk
+    if (c == 27) {
+        _escapeSkip = 2;
+        return;
+    }
+
+    // Add printable characters to buffer
+    if (c >= 32 && c < 127 && _cmdLen < COMMAND_BUFFER_SIZE - 1) {
+        _cmdBuffer[_cmdLen++] = c;
+        if (_echoEnabled) {
+            _stream.print(c);
         }
     }
 }
@@ -162,6 +191,9 @@ void Console::showWelcome() {
     println("  Radio Emulator Console");
     printf("  Platform: %s\r\n", PLATFORM_NAME);
     printf("  Available UARTs: %d\r\n", PLATFORM_MAX_UARTS);
+#ifdef UART_DEFAULT_PINS
+    printf("  UARTs: 1-%d (%s)\r\n", PLATFORM_MAX_UARTS, UART_DEFAULT_PINS);
+#else
     print("  UARTs: ");
     for (uint8_t i = 1; i <= PLATFORM_MAX_UARTS; i++) {
         const char* pins = getUartPins(i);
@@ -171,6 +203,7 @@ void Console::showWelcome() {
         }
     }
     println();
+#endif
     println("=================================");
     println("Type 'help' for available commands.");
     println();
@@ -187,7 +220,7 @@ void Console::println(const char* str) {
 void Console::printf(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    vsnprintf(_outBuffer, sizeof(_outBuffer), fmt, args);
+    FixedWriter(_outBuffer, sizeof(_outBuffer)).vformat(fmt, args);
     va_end(args);
     _stream.print(_outBuffer);
 }
@@ -281,13 +314,21 @@ void cmdDevices(Console& console, int argc, char* argv[]) {
     for (uint8_t i = 0; i < MAX_DEVICES; i++) {
         IEmulatedDevice* dev = mgr.getDevice(i);
         if (dev != nullptr) {
-            const char* pins = getUartPins(dev->getUartIndex());
+            const char* pins = mgr.getUartDescription(dev->getUartIndex());
             console.printf("  %2d  %-10s  %4d  %-16s  %s\r\n",
                           dev->getDeviceId(),
                           dev->getName(),
                           dev->getUartIndex(),
                           pins != nullptr ? pins : "N/A",
                           dev->isRunning() ? "running" : "stopped");
+
+            // Attached ports, one row each
+            for (size_t p = 1; p < dev->getPortCount(); p++) {
+                uint8_t uart = dev->getPortUart(p);
+                pins = mgr.getUartDescription(uart);
+                console.printf("      %-10s  %4d  %s\r\n", "", uart,
+                              pins != nullptr ? pins : "N/A");
+            }
         }
     }
 }
@@ -337,6 +378,41 @@ void cmdDestroy(Console& console, int argc, char* argv[]) {
     }
 }
 
+void cmdAttach(Console& console, int argc, char* argv[]) {
+    if (argc < 3) {
+        console.println("Usage: attach <id> <uart>");
+        return;
+    }
+
+    int id = atoi(argv[1]);
+    int uart = atoi(argv[2]);
+
+    if (uart < 1 || uart > PLATFORM_MAX_UARTS) {
+        console.printf("Invalid UART: %d (valid: 1-%d)\r\n", uart, PLATFORM_MAX_UARTS);
+        return;
+    }
+
+    if (console.getDeviceManager().attachUart(id, uart)) {
+        console.printf("Device %d also on UART %d\r\n", id, uart);
+    } else {
+        console.printf("Failed to attach UART %d to device %d\r\n", uart, id);
+    }
+}
+
+void cmdDetach(Console& console, int argc, char* argv[]) {
+    if (argc < 2) {
+        console.println("Usage: detach <uart>");
+        return;
+    }
+
+    int uart = atoi(argv[1]);
+    if (console.getDeviceManager().detachUart(uart)) {
+        console.printf("Detached UART %d\r\n", uart);
+    } else {
+        console.printf("Failed to detach UART %d\r\n", uart);
+    }
+}
+
 void cmdStart(Console& console, int argc, char* argv[]) {
     if (argc < 2) {
         console.println("Usage: start <id>");
@@ -400,10 +476,10 @@ void cmdStatus(Console& console, int argc, char* argv[]) {
         return;
     }
 
-    char statusBuf[256];
+    char statusBuf[512];
     dev->getStatus(statusBuf, sizeof(statusBuf));
 
-    const char* pins = getUartPins(dev->getUartIndex());
+    const char* pins = mgr.getUartDescription(dev->getUartIndex());
     console.printf("Device %d (%s):\r\n", id, dev->getName());
     console.printf("  Description: %s\r\n", dev->getDescription());
     console.printf("  UART: %d (%s)\r\n", dev->getUartIndex(), pins != nullptr ? pins : "N/A");
@@ -635,6 +711,119 @@ void cmdGps(Console& console, int argc, char* argv[]) {
     console.println();
 }
 
+void cmdTune(Console& console, int argc, char* argv[]) {
+    if (argc < 3) {
+        console.println("Usage: tune <id> <hz>");
+        console.println("  Example: tune 0 7074000");
+        return;
+    }
+
+    int id = atoi(argv[1]);
+    IEmulatedDevice* dev = console.getDeviceManager().getDevice(id);
+    if (dev == nullptr) {
+        console.printf("Device %d not found\r\n", id);
+        return;
+    }
+
+    // Check if this is an Icom radio
+    if (strncmp(dev->getName(), "ic-", 3) != 0) {
+        console.printf("Device %d is not an Icom radio\r\n", id);
+        return;
+    }
+
+    unsigned long hz = strtoul(argv[2], nullptr, 10);
+    IcomDevice* radio = static_cast<IcomDevice*>(dev);
+    if (radio->tune((uint32_t)hz)) {
+        console.printf("Tuned to %lu Hz\r\n", hz);
+    } else {
+        console.println("Frequency outside the radio's coverage");
+    }
+}
+
+void cmdSat(Console& console, int argc, char* argv[]) {
+    if (argc < 3) {
+        console.println("Usage: sat <id> tle \"<line>\"");
+        console.println("       sat <id> station <lat> <lon> [alt]");
+        console.println("       sat <id> time <HH:MM:SS> <YYYY-MM-DD>");
+        console.println("       sat <id> pass");
+        console.println("  tle loads an element set, line 1 then line 2; the station is in");
+        console.println("  decimal degrees and metres, the time UTC; pass moves the clock to");
+        console.println("  the satellite's next rise");
+        return;
+    }
+
+    int id = atoi(argv[1]);
+    IEmulatedDevice* dev = console.getDeviceManager().getDevice(id);
+    if (dev == nullptr) {
+        console.printf("Device %d not found\r\n", id);
+        return;
+    }
+
+    // Check if this is a CAT radio
+    if (findCATModel(dev->getName()) == nullptr) {
+        console.printf("Device %d is not a CAT radio\r\n", id);
+        return;
+    }
+
+    YaesuSatellite& sat = static_cast<YaesuDevice*>(dev)->getSatellite();
+    const char* what = argv[2];
+
+    if (strcasecmp(what, "tle") == 0 && argc > 3) {
+        // A line does not fit on the command line with the other, so line
+        // 1 waits here for line 2
+        static char line1[72];
+        if (argv[3][0] == '1') {
+            strncpy(line1, argv[3], sizeof(line1) - 1);
+            line1[sizeof(line1) - 1] = '\0';
+            console.println("Line 1 stored, now send line 2");
+        } else if (argv[3][0] == '2' && line1[0] != '\0') {
+            bool loaded = sat.loadTle(line1, argv[3]);
+            line1[0] = '\0';
+            if (!loaded) {
+                console.println("Invalid element set (check the lengths and checksums)");
+                return;
+            }
+            console.printf("Loaded satellite %05lu\r\n", (unsigned long)sat.getCatalogNumber());
+            if (!sat.isClockSet() && sat.findPass(millis())) {
+                console.println("Clock moved to its first pass");
+            }
+        } else {
+            console.println("Send line 1, then line 2, each in quotes");
+        }
+    } else if (strcasecmp(what, "station") == 0 && argc > 4) {
+        float lat = atof(argv[3]);
+        float lon = atof(argv[4]);
+        float alt = (argc > 5) ? atof(argv[5]) : 0.0f;
+        if (lat < -90.0f || lat > 90.0f || lon < -180.0f || lon > 180.0f) {
+            console.println("Invalid position (latitude -90 to 90, longitude -180 to 180)");
+            return;
+        }
+        sat.setStation(lat, lon, alt);
+        console.println("Ground station set");
+    } else if (strcasecmp(what, "time") == 0 && argc > 4) {
+        int hour = 0, minute = 0, second = 0;
+        int year = 0, month = 0, day = 0;
+        if (sscanf(argv[3], "%d:%d:%d", &hour, &minute, &second) != 3 ||
+            sscanf(argv[4], "%d-%d-%d", &year, &month, &day) != 3 ||
+            hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59 ||
+            year < 1970 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31) {
+            console.println("Invalid time (use HH:MM:SS YYYY-MM-DD)");
+            return;
+        }
+        sat.setTime(YaesuSatellite::toUnix(year, month, day, hour, minute, second), millis());
+        console.printf("Pass clock set to %02d:%02d:%02d %04d-%02d-%02d UTC\r\n",
+                       hour, minute, second, year, month, day);
+    } else if (strcasecmp(what, "pass") == 0) {
+        if (sat.findPass(millis())) {
+            console.println("Clock moved to the next pass");
+        } else {
+            console.println("No pass in the next day");
+        }
+    } else {
+        console.println("Unknown satellite command (tle, station, time or pass)");
+    }
+}
+
 void cmdTime(Console& console, int argc, char* argv[]) {
     if (argc < 3) {
         console.println("Usage: time <id> <HH:MM:SS> [YYYY-MM-DD]");
@@ -713,29 +902,108 @@ void cmdUarts(Console& console, int argc, char* argv[]) {
     (void)argv;
 
     console.printf("Available UARTs on %s:\r\n", PLATFORM_NAME);
-    console.println("  UART  Pins              Status");
-    console.println("  ----  ----------------  ----------");
+    console.println("  UART  Pins              Status           TX queue   Peak  Deferred   Dropped");
+    console.println("  ----  ----------------  ---------------  --------  -----  --------  --------");
 
     DeviceManager& mgr = console.getDeviceManager();
 
     for (uint8_t i = 1; i <= PLATFORM_MAX_UARTS; i++) {
-        const char* pins = getUartPins(i);
+        const char* pins = mgr.getUartDescription(i);
         if (pins == nullptr) {
             continue;  // Skip UARTs without pin info
         }
 
         // Check if UART is available or in use
         const char* status = "available";
-        for (uint8_t d = 0; d < MAX_DEVICES; d++) {
-            IEmulatedDevice* dev = mgr.getDevice(d);
-            if (dev != nullptr && dev->getUartIndex() == i) {
-                static char statusBuf[24];
-                snprintf(statusBuf, sizeof(statusBuf), "in use (dev %d)", dev->getDeviceId());
-                status = statusBuf;
-                break;
+        IEmulatedDevice* dev = mgr.getDeviceByUart(i);
+        if (dev != nullptr) {
+            static char statusBuf[24];
+            FixedWriter(statusBuf, sizeof(statusBuf)).format("in use (dev %d)", dev->getDeviceId());
+            status = statusBuf;
+        }
+
+        SerialTxStats stats;
+        size_t queued, queueSize;
+        if (mgr.getTxStats(i, stats, queued, queueSize)) {
+            console.printf("  %4d  %-16s  %-15s  %3u/%-4u  %5lu  %8lu  %8lu\r\n",
+                          i, pins, status,
+                          (unsigned)queued, (unsigned)queueSize,
+                          (unsigned long)stats.highWater,
+                          (unsigned long)stats.deferredBytes,
+                          (unsigned long)stats.droppedBytes);
+        } else {
+            console.printf("  %4d  %-16s  %s\r\n", i, pins, status);
+        }
+    }
+}
+
+void cmdCapture(Console& console, int argc, char* argv[]) {
+    if (argc < 2) {
+        if (!SerialCapture::isReady()) {
+            console.println("Capture not started. Use: capture on [uart]");
+            return;
+        }
+        console.printf("Capture: %lu of %lu bytes used, %lu records overwritten\r\n",
+                      (unsigned long)SerialCapture::getUsed(),
+                      (unsigned long)(SerialCapture::getBufferSize() - sizeof(CaptureHeader)),
+                      (unsigned long)SerialCapture::getOverwritten());
+        console.print("Capturing UARTs:");
+        bool any = false;
+        for (uint8_t i = 1; i <= PLATFORM_MAX_UARTS; i++) {
+            if (SerialCapture::isEnabled(i)) {
+                console.printf(" %d", i);
+                any = true;
             }
         }
+        console.println(any ? "" : " none");
+        return;
+    }
+
+    if (strcasecmp(argv[1], "on") == 0 || strcasecmp(argv[1], "off") == 0) {
+        bool on = strcasecmp(argv[1], "on") == 0;
+        uint8_t uart = (argc >= 3) ? (uint8_t)atoi(argv[2]) : 0;
+        if (uart > PLATFORM_MAX_UARTS) {
+            console.printf("Invalid UART: %d\r\n", uart);
+            return;
+        }
+
+        // The ring is only allocated once capture is first used
+        if (on && !SerialCapture::isReady()) {
+            size_t size = sizeof(CaptureHeader) + CAPTURE_BUFFER_SIZE;
+            uint8_t* buffer = new uint8_t[size];
+            memset(buffer, 0, size);
+            SerialCapture::begin(buffer, size);
+        }
 
-        console.printf("  %4d  %-16s  %s\r\n", i, pins, status);
+        SerialCapture::setEnabled(uart, on);
+        if (uart == 0) {
+            console.printf("Capture %s for all UARTs\r\n", on ? "enabled" : "disabled");
+        } else {
+            console.printf("Capture %s for UART %d\r\n", on ? "enabled" : "disabled", uart);
+        }
+    } else if (strcasecmp(argv[1], "clear") == 0) {
+        SerialCapture::clear();
+        console.println("Capture cleared");
+    } else if (strcasecmp(argv[1], "dump") == 0) {
+        // Hex dump of the raw buffer, for tools/capture_decode.py
+        const uint8_t* data = SerialCapture::getBuffer();
+        size_t size = SerialCapture::getBufferSize();
+        if (data == nullptr) {
+            console.println("Capture not started");
+            return;
+        }
+        console.println("-- capture begin --");
+        char buf[2 * 32 + 1];
+        for (size_t offset = 0; offset < size; offset += 32) {
+            size_t n = (size - offset < 32) ? size - offset : 32;
+            FixedWriter line(buf, sizeof(buf));
+            for (size_t i = 0; i < n; i++) {
+                line.hex(data[offset + i]);
+            }
+            console.println(line.c_str());
+        }
+        console.println("-- capture end --");
+    } else {
+        console.println("Usage: capture [on|off [uart]|clear|dump]");
     }
 }
@@ -52,10 +52,14 @@ private:
     char _cmdBuffer[COMMAND_BUFFER_SIZE];
     size_t _cmdLen;
     bool _echoEnabled;
+    uint8_t _escapeSkip;  // Escape sequence bytes still to discard
 
     // Output buffer for printf
     char _outBuffer[LOG_BUFFER_SIZE];
 
+    // Handle one input character (line editing, enter, escape sequences)
+    void processChar(char c);
+
     // Process a complete command line
     void processCommand();
 
@@ -78,6 +82,8 @@ void cmdTypes(Console& console, int argc, char* argv[]);
 void cmdDevices(Console& console, int argc, char* argv[]);
 void cmdCreate(Console& console, int argc, char* argv[]);
 void cmdDestroy(Console& console, int argc, char* argv[]);
+void cmdAttach(Console& console, int argc, char* argv[]);
+void cmdDetach(Console& console, int argc, char* argv[]);
 void cmdStart(Console& console, int argc, char* argv[]);
 void cmdStop(Console& console, int argc, char* argv[]);
 void cmdStatus(Console& console, int argc, char* argv[]);
@@ -92,4 +98,7 @@ void cmdSave(Console& console, int argc, char* argv[]);
 void cmdClear(Console& console, int argc, char* argv[]);
 void cmdGps(Console& console, int argc, char* argv[]);
 void cmdTime(Console& console, int argc, char* argv[]);
+void cmdTune(Console& console, int argc, char* argv[]);
+void cmdSat(Console& console, int argc, char* argv[]);
 void cmdUarts(Console& console, int argc, char* argv[]);
+void cmdCapture(Console& console, int argc, char* argv[]);
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// Fixed-capacity byte FIFO
+// Capacity must be a power of two so wrapping is a mask instead of a division
+// (Cortex-M0 and AVR have no hardware divider)
+//
+// Lock-free for one producer and one consumer: only write() moves _head and
+// only consume()/clear() move _tail, and each side publishes its index with
+// release ordering after touching the data. Everything else may be called
+// from either side.
+//
+// Only the host build needs atomics, where the loopback pair crosses
+// threads. On boards the ring is only touched from the main loop, so a
+// volatile index behind a compiler barrier is enough; AVR has no 16-bit
+// atomics (avr-gcc would call __atomic_load_2, which no library provides).
+class ByteRing {
+public:
+    explicit ByteRing(size_t capacity)
+        : _data(new uint8_t[capacity])
+        , _mask(capacity - 1)
+        , _head(0)
+        , _tail(0)
+    {
+    }
+
+    ~ByteRing() {
+        delete[] _data;
+    }
+
+    // Number of bytes stored
+    size_t size() const { return loadHead() - loadTail(); }
+
+    // Number of bytes that can still be stored
+    size_t space() const { return capacity() - size(); }
+
+    size_t capacity() const { return _mask + 1; }
+    bool empty() const { return size() == 0; }
+
+    // Store up to len bytes, returns number of bytes stored (producer side)
+    size_t write(const uint8_t* data, size_t len) {
+        size_t head = _head;
+        size_t room = capacity() - (head - loadTail());
+        if (len > room) {
+            len = room;
+        }
+
+        // Copy in at most two runs: up to the end of storage, then from the start
+        size_t start = head & _mask;
+        size_t run = capacity() - start;
+        if (run > len) {
+            run = len;
+        }
+        memcpy(&_data[start], data, run);
+        memcpy(_data, data + run, len - run);
+
+        storeIndex(_head, head + len);
+        return len;
+    }
+
+    // Get the longest contiguous run of stored bytes without removing them
+    // Returns run length, 0 if empty (consumer side)
+    size_t peek(const uint8_t** data) const {
+        size_t tail = _tail;
+        size_t count = loadHead() - tail;
+        size_t start = tail & _mask;
+        size_t run = capacity() - start;
+        *data = &_data[start];
+        return (count < run) ? count : run;
+    }
+
+    // Remove up to len bytes into out, returns number of bytes removed
+    // (consumer side)
+    size_t read(uint8_t* out, size_t len) {
+        size_t copied = 0;
+        while (copied < len) {
+            const uint8_t* run;
+            size_t n = peek(&run);
+            if (n == 0) {
+                break;
+            }
+            if (n > len - copied) {
+                n = len - copied;
+            }
+            memcpy(out + copied, run, n);
+            consume(n);
+            copied += n;
+        }
+        return copied;
+    }
+
+    // Remove len bytes (after peek, consumer side)
+    void consume(size_t len) {
+        size_t tail = _tail;
+        size_t count = loadHead() - tail;
+        if (len > count) {
+            len = count;
+        }
+        storeIndex(_tail, tail + len);
+    }
+
+    // Discard all stored bytes (consumer side)
+    void clear() {
+        storeIndex(_tail, loadHead());
+    }
+
+private:
+    uint8_t* _data;
+    size_t _mask;
+    volatile size_t _head;  // Free-running write index, written by the producer only
+    volatile size_t _tail;  // Free-running read index, written by the consumer only
+
+    size_t loadHead() const { return loadIndex(_head); }
+    size_t loadTail() const { return loadIndex(_tail); }
+
+#if defined(PLATFORM_HOST)
+    static size_t loadIndex(const volatile size_t& index) {
+        return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+    }
+
+    static void storeIndex(volatile size_t& index, size_t value) {
+        __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+    }
+#else
+    // Data accesses stay on their side of the index access
+    static size_t loadIndex(const volatile size_t& index) {
+        size_t value = index;
+        __asm__ __volatile__("" ::: "memory");
+        return value;
+    }
+
+    static void storeIndex(volatile size_t& index, size_t value) {
+        __asm__ __volatile__("" ::: "memory");
+        index = value;
+    }
+#endif
+
+    // Not copyable
+    ByteRing(const ByteRing&);
+    ByteRing& operator=(const ByteRing&);
+};
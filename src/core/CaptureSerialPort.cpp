@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "CaptureSerialPort.h"
+
+int CaptureSerialPort::read() {
+    int c = _port.read();
+    if (c >= 0) {
+        uint8_t byte = (uint8_t)c;
+        SerialCapture::record(_uartIndex, false, &byte, 1);
+    }
+    return c;
+}
+
+size_t CaptureSerialPort::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = _port.readBytes(buffer, length);
+    SerialCapture::record(_uartIndex, false, buffer, count);
+    return count;
+}
+
+size_t CaptureSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    size_t count = _port.readAvailable(buffer, length);
+    SerialCapture::record(_uartIndex, false, buffer, count);
+    return count;
+}
+
+size_t CaptureSerialPort::write(uint8_t byte) {
+    size_t count = _port.write(byte);
+    SerialCapture::record(_uartIndex, true, &byte, count);
+    return count;
+}
+
+size_t CaptureSerialPort::write(const uint8_t* buffer, size_t size) {
+    size_t count = _port.write(buffer, size);
+    SerialCapture::record(_uartIndex, true, buffer, count);
+    return count;
+}
+
+size_t CaptureSerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t CaptureSerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
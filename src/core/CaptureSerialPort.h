@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "SerialCapture.h"
+
+// Serial port tap feeding SerialCapture
+// Sits directly on the hardware (or virtual) port so timestamps reflect
+// when bytes actually crossed it. When capture is off for the UART, each
+// call costs one mask test.
+class CaptureSerialPort : public ISerialPort {
+public:
+    CaptureSerialPort(ISerialPort& port, uint8_t uartIndex)
+        : _port(port)
+        , _uartIndex(uartIndex)
+    {
+    }
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override { _port.begin(baud, config); }
+    void end() override { _port.end(); }
+    int available() override { return _port.available(); }
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override { return _port.availableForWrite(); }
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void flush() override { _port.flush(); }
+    void service() override { _port.service(); }
+    bool isOpen() const override { return _port.isOpen(); }
+    const char* getPortName() const override { return _port.getPortName(); }
+
+private:
+    ISerialPort& _port;
+    uint8_t _uartIndex;
+};
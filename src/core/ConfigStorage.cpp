@@ -5,16 +5,67 @@
 #include "DeviceManager.h"
 #include "IEmulatedDevice.h"
 #include "ILogger.h"
+#include "IStateStream.h"
 #include <EEPROM.h>
 #include <string.h>
 
 // Static member initialization
 ILogger* ConfigStorage::_logger = nullptr;
 
+// Start of the device state area
+#define STATE_BASE sizeof(StoredConfig)
+
+// A block of the state area, from start up to the end of EEPROM or, when
+// reading, up to the block's saved length
+class EEPROMStateStream : public IStateStream {
+public:
+    EEPROMStateStream(size_t start, size_t end)
+        : _pos(start)
+        , _end(end)
+    {}
+
+    bool write(const void* data, size_t len) override {
+        if (_pos + len > _end) {
+            return false;
+        }
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i < len; i++) {
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_RASPBERRY_PI_PICO) || \
+    defined(ARDUINO_ARCH_ESP32) || defined(PLATFORM_HOST)
+            // Buffered in RAM until the commit
+            EEPROM.write(_pos + i, bytes[i]);
+#else
+            // Skip cells that already hold the byte, saving wear
+            EEPROM.update(_pos + i, bytes[i]);
+#endif
+        }
+        _pos += len;
+        return true;
+    }
+
+    bool read(void* data, size_t len) override {
+        if (_pos + len > _end) {
+            return false;
+        }
+        uint8_t* bytes = (uint8_t*)data;
+        for (size_t i = 0; i < len; i++) {
+            bytes[i] = EEPROM.read(_pos + i);
+        }
+        _pos += len;
+        return true;
+    }
+
+    size_t position() const { return _pos; }
+
+private:
+    size_t _pos;
+    size_t _end;
+};
+
 void ConfigStorage::begin() {
 #if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_RASPBERRY_PI_PICO) || \
-    defined(ARDUINO_ARCH_ESP32)
-    // Pico and ESP platforms require size parameter
+    defined(ARDUINO_ARCH_ESP32) || defined(PLATFORM_HOST)
+    // Pico, ESP and host platforms require size parameter
     EEPROM.begin(EEPROM_SIZE);
 #else
     // STM32 and other platforms
@@ -56,8 +107,8 @@ bool ConfigStorage::writeConfig(const StoredConfig& config) {
     EEPROM.put(0, config);
 
 #if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_RASPBERRY_PI_PICO) || \
-    defined(ARDUINO_ARCH_ESP32)
-    // Pico and ESP platforms require explicit commit
+    defined(ARDUINO_ARCH_ESP32) || defined(PLATFORM_HOST)
+    // Pico, ESP and host platforms require explicit commit
     EEPROM.commit();
 #endif
 
@@ -80,19 +131,52 @@ uint8_t ConfigStorage::load(DeviceManager& mgr) {
     }
 
     uint8_t restored = 0;
+    uint8_t deviceIds[MAX_DEVICES];
 
     for (uint8_t i = 0; i < config.deviceCount && i < MAX_DEVICES; i++) {
         const StoredDeviceConfig& devConfig = config.devices[i];
 
+        deviceIds[i] = 0xFF;
         if (devConfig.valid != 0x01) {
             continue;
         }
 
-        if (restoreDevice(devConfig, mgr)) {
+        deviceIds[i] = restoreDevice(devConfig, mgr);
+        if (deviceIds[i] != 0xFF) {
             restored++;
         }
     }
 
+    // Device state, one block per stored device; the blocks of devices
+    // that could not be restored are skipped
+    uint32_t stateMagic = 0;
+    size_t end = EEPROM.length();
+    if (STATE_BASE + sizeof(stateMagic) <= end) {
+        EEPROM.get(STATE_BASE, stateMagic);
+    }
+    size_t pos = STATE_BASE + sizeof(stateMagic);
+    for (uint8_t i = 0; stateMagic == STATE_MAGIC && i < config.deviceCount && i < MAX_DEVICES; i++) {
+        uint16_t length;
+        if (pos + sizeof(length) > end) {
+            break;
+        }
+        EEPROM.get(pos, length);
+        pos += sizeof(length);
+        if (length > end - pos) {
+            break;
+        }
+
+        IEmulatedDevice* device = (deviceIds[i] != 0xFF) ? mgr.getDevice(deviceIds[i]) : nullptr;
+        if (device != nullptr && length > 0) {
+            EEPROMStateStream in(pos, pos + length);
+            if (!device->loadState(in) && _logger) {
+                _logger->logf(LogLevel::WARN, "Config", "Saved state of device %d is invalid",
+                             deviceIds[i]);
+            }
+        }
+        pos += length;
+    }
+
     if (_logger) {
         _logger->logf(LogLevel::INFO, "Config", "Restored %d device(s)", restored);
     }
@@ -107,17 +191,22 @@ bool ConfigStorage::save(DeviceManager& mgr) {
     config.magic = CONFIG_MAGIC;
     config.version = CONFIG_VERSION;
     config.deviceCount = 0;
+    uint8_t deviceIds[MAX_DEVICES];
 
     // Iterate through all device slots
     for (uint8_t i = 0; i < MAX_DEVICES; i++) {
         IEmulatedDevice* device = mgr.getDevice(i);
         if (device != nullptr) {
             if (serializeDevice(device, config.devices[config.deviceCount])) {
+                deviceIds[config.deviceCount] = i;
                 config.deviceCount++;
             }
         }
     }
 
+    // State first: writeConfig() commits both
+    writeState(mgr, deviceIds, config.deviceCount);
+
     if (!writeConfig(config)) {
         if (_logger) {
             _logger->logf(LogLevel::ERROR, "Config", "Failed to write configuration");
@@ -133,6 +222,38 @@ bool ConfigStorage::save(DeviceManager& mgr) {
     return true;
 }
 
+void ConfigStorage::writeState(DeviceManager& mgr, const uint8_t* deviceIds, uint8_t count) {
+    size_t end = EEPROM.length();
+    uint32_t stateMagic = STATE_MAGIC;
+    if (STATE_BASE + sizeof(stateMagic) > end) {
+        if (_logger) {
+            _logger->logf(LogLevel::WARN, "Config", "No room in EEPROM for device state");
+        }
+        return;
+    }
+    EEPROM.put(STATE_BASE, stateMagic);
+
+    size_t pos = STATE_BASE + sizeof(stateMagic);
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t length = 0;
+        if (pos + sizeof(length) > end) {
+            break;  // Blocks past the end load as missing
+        }
+
+        // The block is written after its length, which is filled in last
+        EEPROMStateStream out(pos + sizeof(length), end);
+        IEmulatedDevice* device = mgr.getDevice(deviceIds[i]);
+        if (device->saveState(out)) {
+            length = (uint16_t)(out.position() - pos - sizeof(length));
+        } else if (_logger) {
+            _logger->logf(LogLevel::WARN, "Config", "State of device %d does not fit in EEPROM",
+                         deviceIds[i]);
+        }
+        EEPROM.put(pos, length);
+        pos += sizeof(length) + length;
+    }
+}
+
 void ConfigStorage::clear() {
     StoredConfig config;
     memset(&config, 0, sizeof(config));
@@ -141,7 +262,7 @@ void ConfigStorage::clear() {
     EEPROM.put(0, config);
 
 #if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_RASPBERRY_PI_PICO) || \
-    defined(ARDUINO_ARCH_ESP32)
+    defined(ARDUINO_ARCH_ESP32) || defined(PLATFORM_HOST)
     EEPROM.commit();
 #endif
 
@@ -159,8 +280,11 @@ bool ConfigStorage::serializeDevice(IEmulatedDevice* device, StoredDeviceConfig&
     strncpy(config.typeName, device->getName(), MAX_TYPE_NAME_LEN - 1);
     config.typeName[MAX_TYPE_NAME_LEN - 1] = '\0';
 
-    // Store UART index
+    // Store UART index and any attached UARTs
     config.uartIndex = device->getUartIndex();
+    for (size_t i = 1; i < device->getPortCount() && i < DEVICE_MAX_PORTS; i++) {
+        config.extraUarts[i - 1] = device->getPortUart(i);
+    }
 
     // Serialize options
     size_t optionBytes = device->serializeOptions(config.optionData, MAX_OPTION_DATA_LEN);
@@ -174,22 +298,22 @@ bool ConfigStorage::serializeDevice(IEmulatedDevice* device, StoredDeviceConfig&
     return true;
 }
 
-bool ConfigStorage::restoreDevice(const StoredDeviceConfig& config, DeviceManager& mgr) {
+uint8_t ConfigStorage::restoreDevice(const StoredDeviceConfig& config, DeviceManager& mgr) {
     // Validate type name
     if (config.typeName[0] == '\0') {
         if (_logger) {
             _logger->logf(LogLevel::WARN, "Config", "Empty device type name");
         }
-        return false;
+        return 0xFF;
     }
 
     // Check if UART is available
-    if (!mgr.isUartAvailable(config.uartIndex)) {
+    if (!mgr.isUartAvailableFor(config.typeName, config.uartIndex)) {
         if (_logger) {
             _logger->logf(LogLevel::WARN, "Config", "UART %d not available for device '%s'",
                          config.uartIndex, config.typeName);
         }
-        return false;
+        return 0xFF;
     }
 
     // Create device with restored options
@@ -205,7 +329,16 @@ bool ConfigStorage::restoreDevice(const StoredDeviceConfig& config, DeviceManage
             _logger->logf(LogLevel::ERROR, "Config", "Failed to create device '%s' on UART %d",
                          config.typeName, config.uartIndex);
         }
-        return false;
+        return 0xFF;
+    }
+
+    // Re-attach extra UARTs; a missing one does not fail the device
+    for (size_t i = 0; i < DEVICE_MAX_PORTS - 1; i++) {
+        uint8_t uart = config.extraUarts[i];
+        if (uart != 0 && !mgr.attachUart(deviceId, uart) && _logger) {
+            _logger->logf(LogLevel::WARN, "Config", "UART %d not available for device '%s'",
+                         uart, config.typeName);
+        }
     }
 
     if (_logger) {
@@ -213,5 +346,5 @@ bool ConfigStorage::restoreDevice(const StoredDeviceConfig& config, DeviceManage
                      deviceId, config.typeName, config.uartIndex);
     }
 
-    return true;
+    return deviceId;
 }
@@ -2,7 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "ConsoleLogger.h"
-#include <stdio.h>
+#include "FixedWriter.h"
 
 ConsoleLogger::ConsoleLogger(Stream& output)
     : _output(output)
@@ -25,7 +25,7 @@ void ConsoleLogger::logf(LogLevel level, const char* tag, const char* fmt, ...)
 
     va_list args;
     va_start(args, fmt);
-    vsnprintf(_buffer, sizeof(_buffer), fmt, args);
+    FixedWriter(_buffer, sizeof(_buffer)).vformat(fmt, args);
     va_end(args);
 
     printPrefix(level, tag);
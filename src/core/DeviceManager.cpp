@@ -2,7 +2,15 @@
 // SPDX-License-Identifier: MIT
 
 #include "DeviceManager.h"
+#include "QueuedSerialPort.h"
+#include "CaptureSerialPort.h"
+
+#if defined(PLATFORM_HOST)
+#include "host/PtySerialPort.h"
+#include "TimedSerialPort.h"
+#else
 #include "HardwareSerialPort.h"
+#endif
 
 // Invalid device ID marker
 #define INVALID_ID 0xFF
@@ -11,6 +19,9 @@ DeviceManager::DeviceManager()
     : _factoryCount(0)
     , _logger(nullptr)
     , _nextDeviceId(0)
+#if defined(PLATFORM_HOST)
+    , _lineTiming(false)
+#endif
 {
     // Initialize arrays
     for (size_t i = 0; i < MAX_DEVICE_FACTORIES; i++) {
@@ -23,6 +34,11 @@ DeviceManager::DeviceManager()
     for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
         _uartAllocation[i] = INVALID_ID;
         _serialPorts[i] = nullptr;
+        _capturePorts[i] = nullptr;
+        _txQueues[i] = nullptr;
+#if defined(PLATFORM_HOST)
+        _timedPorts[i] = nullptr;
+#endif
     }
 }
 
@@ -36,6 +52,14 @@ DeviceManager::~DeviceManager() {
 
     // Clean up serial port wrappers
     for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        delete _txQueues[i];
+        _txQueues[i] = nullptr;
+#if defined(PLATFORM_HOST)
+        delete _timedPorts[i];
+        _timedPorts[i] = nullptr;
+#endif
+        delete _capturePorts[i];
+        _capturePorts[i] = nullptr;
         delete _serialPorts[i];
         _serialPorts[i] = nullptr;
     }
@@ -109,14 +133,6 @@ uint8_t DeviceManager::createDevice(const char* typeName, uint8_t uartIndex) {
         return INVALID_ID;
     }
 
-    // Check UART availability
-    if (!isUartAvailable(uartIndex)) {
-        if (_logger) {
-            _logger->logf(LogLevel::ERROR, "DevMgr", "UART %d is already in use", uartIndex);
-        }
-        return INVALID_ID;
-    }
-
     // Find factory
     IDeviceFactory* factory = findFactory(resolvedType);
     if (factory == nullptr) {
@@ -126,6 +142,18 @@ uint8_t DeviceManager::createDevice(const char* typeName, uint8_t uartIndex) {
         return INVALID_ID;
     }
 
+    // Check UART availability; stations on one bus share their UART
+    bool sharing = false;
+    if (!isUartAvailable(uartIndex)) {
+        sharing = canShareUart(factory, uartIndex);
+        if (!sharing) {
+            if (_logger) {
+                _logger->logf(LogLevel::ERROR, "DevMgr", "UART %d is already in use", uartIndex);
+            }
+            return INVALID_ID;
+        }
+    }
+
     // Find free device slot
     uint8_t slot = findFreeDeviceSlot();
     if (slot == INVALID_ID) {
@@ -161,11 +189,21 @@ uint8_t DeviceManager::createDevice(const char* typeName, uint8_t uartIndex) {
     // Store device
     _devices[slot] = device;
     _deviceFactories[slot] = factory;
-    _uartAllocation[uartIndex - 1] = deviceId;  // uartIndex is 1-based, array is 0-based
+    if (!sharing) {
+        _uartAllocation[uartIndex - 1] = deviceId;  // uartIndex is 1-based, array is 0-based
+    }
 
     if (_logger) {
-        _logger->logf(LogLevel::INFO, "DevMgr", "Created device %d (%s) on UART %d",
-                      deviceId, resolvedType, uartIndex);
+        if (sharing) {
+            _logger->logf(LogLevel::INFO, "DevMgr", "Created device %d (%s) on the %s bus on UART %d",
+                          deviceId, resolvedType, factory->getBus(), uartIndex);
+        } else if (serial->getPortName() != nullptr) {
+            _logger->logf(LogLevel::INFO, "DevMgr", "Created device %d (%s) on UART %d (%s)",
+                          deviceId, resolvedType, uartIndex, serial->getPortName());
+        } else {
+            _logger->logf(LogLevel::INFO, "DevMgr", "Created device %d (%s) on UART %d",
+                          deviceId, resolvedType, uartIndex);
+        }
     }
 
     return deviceId;
@@ -206,10 +244,19 @@ bool DeviceManager::destroyDevice(uint8_t deviceId) {
         device->end();
     }
 
-    // Free UART allocation
-    uint8_t uartIndex = device->getUartIndex();
-    if (uartIndex > 0 && uartIndex <= PLATFORM_MAX_UARTS) {
-        _uartAllocation[uartIndex - 1] = INVALID_ID;
+    // Free every UART the device is served on, or hand a shared bus UART
+    // to another device still on it
+    for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        if (_uartAllocation[i] == deviceId) {
+            _uartAllocation[i] = INVALID_ID;
+            for (size_t j = 0; j < MAX_DEVICES; j++) {
+                if (j != deviceId && _devices[j] != nullptr &&
+                    _devices[j]->getUartIndex() == i + 1) {
+                    _uartAllocation[i] = (uint8_t)j;
+                    break;
+                }
+            }
+        }
     }
 
     // Destroy device through its factory
@@ -227,6 +274,64 @@ bool DeviceManager::destroyDevice(uint8_t deviceId) {
     return true;
 }
 
+bool DeviceManager::attachUart(uint8_t deviceId, uint8_t uartIndex) {
+    if (deviceId >= MAX_DEVICES || _devices[deviceId] == nullptr) {
+        return false;
+    }
+
+    if (!isUartAvailable(uartIndex)) {
+        if (_logger) {
+            _logger->logf(LogLevel::ERROR, "DevMgr", "UART %d is not available", uartIndex);
+        }
+        return false;
+    }
+
+    ISerialPort* serial = getSerialForUart(uartIndex);
+    if (serial == nullptr) {
+        if (_logger) {
+            _logger->logf(LogLevel::ERROR, "DevMgr", "Failed to get serial for UART %d", uartIndex);
+        }
+        return false;
+    }
+
+    if (!_devices[deviceId]->attachPort(serial, uartIndex)) {
+        if (_logger) {
+            _logger->logf(LogLevel::ERROR, "DevMgr", "Device %d cannot take more ports", deviceId);
+        }
+        return false;
+    }
+
+    _uartAllocation[uartIndex - 1] = deviceId;
+
+    if (_logger) {
+        if (serial->getPortName() != nullptr) {
+            _logger->logf(LogLevel::INFO, "DevMgr", "Attached UART %d (%s) to device %d",
+                          uartIndex, serial->getPortName(), deviceId);
+        } else {
+            _logger->logf(LogLevel::INFO, "DevMgr", "Attached UART %d to device %d",
+                          uartIndex, deviceId);
+        }
+    }
+
+    return true;
+}
+
+bool DeviceManager::detachUart(uint8_t uartIndex) {
+    IEmulatedDevice* device = getDeviceByUart(uartIndex);
+    if (device == nullptr || !device->detachPort(uartIndex)) {
+        return false;
+    }
+
+    _uartAllocation[uartIndex - 1] = INVALID_ID;
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "DevMgr", "Detached UART %d from device %d",
+                      uartIndex, device->getDeviceId());
+    }
+
+    return true;
+}
+
 size_t DeviceManager::getDeviceCount() const {
     size_t count = 0;
     for (size_t i = 0; i < MAX_DEVICES; i++) {
@@ -256,6 +361,35 @@ IEmulatedDevice* DeviceManager::getDeviceByUart(uint8_t uartIndex) {
 }
 
 bool DeviceManager::isUartAvailable(uint8_t uartIndex) const {
+    // Check if already allocated
+    return uartExists(uartIndex) && _uartAllocation[uartIndex - 1] == INVALID_ID;
+}
+
+bool DeviceManager::isUartAvailableFor(const char* typeName, uint8_t uartIndex) {
+    if (isUartAvailable(uartIndex)) {
+        return true;
+    }
+    IDeviceFactory* factory = findFactory(resolveTypeName(typeName));
+    return factory != nullptr && canShareUart(factory, uartIndex);
+}
+
+bool DeviceManager::canShareUart(const IDeviceFactory* factory, uint8_t uartIndex) const {
+    if (!uartExists(uartIndex) || factory->getBus() == nullptr) {
+        return false;
+    }
+    uint8_t owner = _uartAllocation[uartIndex - 1];
+    if (owner == INVALID_ID) {
+        return false;
+    }
+
+    // The UART must be the owner's own bus, not a port attached to it
+    const IDeviceFactory* ownerFactory = _deviceFactories[owner];
+    return ownerFactory != nullptr && ownerFactory->getBus() != nullptr &&
+           strcmp(ownerFactory->getBus(), factory->getBus()) == 0 &&
+           _devices[owner]->getUartIndex() == uartIndex;
+}
+
+bool DeviceManager::uartExists(uint8_t uartIndex) const {
     if (uartIndex == 0 || uartIndex > PLATFORM_MAX_UARTS) {
         return false;
     }
@@ -286,8 +420,7 @@ bool DeviceManager::isUartAvailable(uint8_t uartIndex) const {
     if (uartIndex == 8) return false;
 #endif
 
-    // Check if already allocated
-    return _uartAllocation[uartIndex - 1] == INVALID_ID;
+    return true;
 }
 
 ISerialPort* DeviceManager::getSerialForUart(uint8_t uartIndex) {
@@ -296,10 +429,45 @@ ISerialPort* DeviceManager::getSerialForUart(uint8_t uartIndex) {
     }
 
     // Return existing wrapper if already created
-    if (_serialPorts[uartIndex - 1] != nullptr) {
-        return _serialPorts[uartIndex - 1];
+    if (_txQueues[uartIndex - 1] != nullptr) {
+        return _txQueues[uartIndex - 1];
+    }
+
+    // Create the platform port unless a backend was installed with setSerialPort()
+    if (_serialPorts[uartIndex - 1] == nullptr && !createSerialPort(uartIndex)) {
+        return nullptr;
     }
 
+    // Capture tap sits directly on the port
+    _capturePorts[uartIndex - 1] = new CaptureSerialPort(*_serialPorts[uartIndex - 1], uartIndex);
+    ISerialPort* port = _capturePorts[uartIndex - 1];
+
+#if defined(PLATFORM_HOST)
+    // Pace virtual ports at real line speed
+    if (_lineTiming) {
+        _timedPorts[uartIndex - 1] = new TimedSerialPort(*port);
+        port = _timedPorts[uartIndex - 1];
+    }
+#endif
+
+    // Devices write through a software TX queue so they never block the loop
+    _txQueues[uartIndex - 1] = new QueuedSerialPort(*port, SERIAL_TX_QUEUE_SIZE);
+    return _txQueues[uartIndex - 1];
+}
+
+bool DeviceManager::createSerialPort(uint8_t uartIndex) {
+#if defined(PLATFORM_HOST)
+    // Host build: every UART is a pseudo-terminal
+    PtySerialPort* pty = new PtySerialPort();
+    if (!pty->isValid()) {
+        if (_logger) {
+            _logger->logf(LogLevel::ERROR, "DevMgr", "Failed to create pty for UART %d", uartIndex);
+        }
+        delete pty;
+        return false;
+    }
+    _serialPorts[uartIndex - 1] = pty;
+#else
     // Create new wrapper
     HardwareSerial* hwSerial = nullptr;
 
@@ -345,15 +513,72 @@ ISerialPort* DeviceManager::getSerialForUart(uint8_t uartIndex) {
             break;
 #endif
         default:
-            return nullptr;
+            return false;
     }
 
     if (hwSerial == nullptr) {
-        return nullptr;
+        return false;
     }
 
     _serialPorts[uartIndex - 1] = new HardwareSerialPort(*hwSerial);
-    return _serialPorts[uartIndex - 1];
+#endif
+    return true;
+}
+
+bool DeviceManager::setSerialPort(uint8_t uartIndex, ISerialPort* port) {
+    if (uartIndex == 0 || uartIndex > PLATFORM_MAX_UARTS || port == nullptr) {
+        return false;
+    }
+
+    // Cannot swap the port out from under a device
+    if (_uartAllocation[uartIndex - 1] != INVALID_ID) {
+        if (_logger) {
+            _logger->logf(LogLevel::ERROR, "DevMgr", "UART %d is already in use", uartIndex);
+        }
+        return false;
+    }
+
+    // Replace any port created earlier
+    delete _txQueues[uartIndex - 1];
+    _txQueues[uartIndex - 1] = nullptr;
+#if defined(PLATFORM_HOST)
+    delete _timedPorts[uartIndex - 1];
+    _timedPorts[uartIndex - 1] = nullptr;
+#endif
+    delete _capturePorts[uartIndex - 1];
+    _capturePorts[uartIndex - 1] = nullptr;
+    delete _serialPorts[uartIndex - 1];
+    _serialPorts[uartIndex - 1] = port;
+    return true;
+}
+
+const char* DeviceManager::getUartDescription(uint8_t uartIndex) const {
+    if (uartIndex == 0 || uartIndex > PLATFORM_MAX_UARTS) {
+        return nullptr;
+    }
+
+    const ISerialPort* port = _serialPorts[uartIndex - 1];
+    if (port != nullptr && port->getPortName() != nullptr) {
+        return port->getPortName();
+    }
+    return getUartPins(uartIndex);
+}
+
+bool DeviceManager::getTxStats(uint8_t uartIndex, SerialTxStats& stats,
+                               size_t& queued, size_t& queueSize) const {
+    if (uartIndex == 0 || uartIndex > PLATFORM_MAX_UARTS) {
+        return false;
+    }
+
+    const QueuedSerialPort* port = _txQueues[uartIndex - 1];
+    if (port == nullptr) {
+        return false;
+    }
+
+    stats = port->getStats();
+    queued = port->queued();
+    queueSize = port->queueSize();
+    return true;
 }
 
 void DeviceManager::updateAll() {
@@ -362,8 +587,38 @@ void DeviceManager::updateAll() {
             _devices[i]->update();
         }
     }
+
+    // Hand queued output to the UARTs as their hardware buffers free up
+    for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        if (_txQueues[i] != nullptr) {
+            _txQueues[i]->service();
+        }
+    }
 }
 
+#if defined(PLATFORM_HOST)
+uint32_t DeviceManager::getNextEventUs() {
+    uint32_t next = TIMED_IDLE_US;
+    for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        if (_timedPorts[i] != nullptr) {
+            uint32_t due = _timedPorts[i]->getNextEventUs();
+            if (due < next) {
+                next = due;
+            }
+        }
+    }
+    for (size_t i = 0; i < MAX_DEVICES; i++) {
+        if (_devices[i] != nullptr) {
+            uint32_t due = _devices[i]->getNextEventUs();
+            if (due < next) {
+                next = due;
+            }
+        }
+    }
+    return next;
+}
+#endif
+
 uint8_t DeviceManager::findFreeDeviceSlot() const {
     for (size_t i = 0; i < MAX_DEVICES; i++) {
         if (_devices[i] == nullptr) {
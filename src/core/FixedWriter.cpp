@@ -0,0 +1,235 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "FixedWriter.h"
+
+FixedWriter& FixedWriter::put(char c) {
+    if (room(1)) {
+        _buf[_len++] = c;
+        _buf[_len] = '\0';
+    }
+    return *this;
+}
+
+FixedWriter& FixedWriter::put(const char* str, size_t len) {
+    if (room(len)) {
+        memcpy(_buf + _len, str, len);
+        _len += len;
+        _buf[_len] = '\0';
+    }
+    return *this;
+}
+
+FixedWriter& FixedWriter::hex(uint8_t value) {
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    if (room(2)) {
+        _buf[_len++] = HEX_DIGITS[value >> 4];
+        _buf[_len++] = HEX_DIGITS[value & 0x0F];
+        _buf[_len] = '\0';
+    }
+    return *this;
+}
+
+// Split into two types because 32-bit division is several times the cost
+// of 16-bit division on AVR; both produce digits lowest first
+FixedWriter& FixedWriter::digits16(uint16_t value, uint8_t width) {
+    char tmp[5];
+    uint8_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    return putReversed(tmp, n, width);
+}
+
+FixedWriter& FixedWriter::digits32(uint32_t value, uint8_t width) {
+    char tmp[10];
+    uint8_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    return putReversed(tmp, n, width);
+}
+
+FixedWriter& FixedWriter::putReversed(const char* tmp, uint8_t n, uint8_t width) {
+    if (width == 0) {
+        width = n;
+    } else if (n > width) {
+        n = width;
+    }
+    if (room(width)) {
+        for (uint8_t i = n; i < width; i++) {
+            _buf[_len++] = '0';
+        }
+        while (n > 0) {
+            _buf[_len++] = tmp[--n];
+        }
+        _buf[_len] = '\0';
+    }
+    return *this;
+}
+
+FixedWriter& FixedWriter::format(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vformat(fmt, args);
+    va_end(args);
+    return *this;
+}
+
+FixedWriter& FixedWriter::vformat(const char* fmt, va_list args) {
+    static const char HEX_LOWER[] = "0123456789abcdef";
+    static const char HEX_UPPER[] = "0123456789ABCDEF";
+
+    while (*fmt != '\0' && !_overflow) {
+        // Text up to the next conversion
+        const char* percent = strchr(fmt, '%');
+        if (percent == nullptr) {
+            clip(fmt, strlen(fmt));
+            break;
+        }
+        clip(fmt, (size_t)(percent - fmt));
+        fmt = percent + 1;
+
+        bool left = false;
+        bool zero = false;
+        bool plus = false;
+        for (;; fmt++) {
+            if (*fmt == '-') {
+                left = true;
+            } else if (*fmt == '0') {
+                zero = true;
+            } else if (*fmt == '+') {
+                plus = true;
+            } else {
+                break;
+            }
+        }
+        size_t width = 0;
+        while (*fmt >= '0' && *fmt <= '9') {
+            width = width * 10 + (size_t)(*fmt++ - '0');
+        }
+        int precision = -1;
+        if (*fmt == '.') {
+            fmt++;
+            if (*fmt == '*') {
+                precision = va_arg(args, int);
+                fmt++;
+            } else {
+                precision = 0;
+                while (*fmt >= '0' && *fmt <= '9') {
+                    precision = precision * 10 + (*fmt++ - '0');
+                }
+            }
+        }
+        bool isLong = false;
+        while (*fmt == 'l') {
+            isLong = true;
+            fmt++;
+        }
+
+        // Digits lowest first, or the text to write as is
+        char tmp[11];
+        const char* text = nullptr;
+        size_t len = 0;
+        char sign = '\0';
+        uint32_t value = 0;
+        uint8_t base = 10;
+        const char* digitChars = HEX_UPPER;
+
+        switch (*fmt) {
+            case 'd':
+            case 'i': {
+                long n = isLong ? va_arg(args, long) : (long)va_arg(args, int);
+                value = (n < 0) ? (uint32_t)0 - (uint32_t)n : (uint32_t)n;
+                sign = (n < 0) ? '-' : (plus ? '+' : '\0');
+                break;
+            }
+            case 'x':
+                digitChars = HEX_LOWER;
+                // Fall through
+            case 'X':
+                base = 16;
+                // Fall through
+            case 'u':
+                value = isLong ? (uint32_t)va_arg(args, unsigned long)
+                               : (uint32_t)va_arg(args, unsigned int);
+                break;
+            case 'c':
+                tmp[0] = (char)va_arg(args, int);
+                text = tmp;
+                len = 1;
+                break;
+            case 's':
+                text = va_arg(args, const char*);
+                if (text == nullptr) {
+                    text = "(null)";
+                }
+                len = strlen(text);
+                if (precision >= 0 && (size_t)precision < len) {
+                    len = (size_t)precision;
+                }
+                break;
+            case '\0':
+                return *this;
+            default:
+                // '%' and anything unknown are written as they are
+                text = fmt;
+                len = 1;
+                break;
+        }
+        fmt++;
+
+        if (text == nullptr) {
+            do {
+                tmp[len++] = digitChars[value % base];
+                value /= base;
+            } while (value != 0);
+        }
+
+        size_t total = len + (sign != '\0' ? 1 : 0);
+        size_t pad = (width > total) ? width - total : 0;
+        if (!left && !zero) {
+            clipFill(' ', pad);
+        }
+        if (sign != '\0') {
+            clip(&sign, 1);
+        }
+        if (!left && zero) {
+            clipFill('0', pad);
+        }
+        if (text != nullptr) {
+            clip(text, len);
+        } else {
+            while (len > 0) {
+                clip(&tmp[--len], 1);
+            }
+        }
+        if (left) {
+            clipFill(' ', pad);
+        }
+    }
+    return *this;
+}
+
+void FixedWriter::clip(const char* str, size_t len) {
+    if (_size == 0) {
+        _overflow = true;
+        return;
+    }
+    size_t space = _size - 1 - _len;
+    if (len > space) {
+        len = space;
+        _overflow = true;
+    }
+    memcpy(_buf + _len, str, len);
+    _len += len;
+    _buf[_len] = '\0';
+}
+
+void FixedWriter::clipFill(char c, size_t n) {
+    while (n-- > 0 && !_overflow) {
+        clip(&c, 1);
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <string.h>
+
+// Fixed-width text formatter for protocol encoders
+// Replaces snprintf/dtostrf for the fields serial protocols use: zero-padded
+// integers, signed offsets, fixed-point decimals and hex checksums. Field
+// widths are template parameters checked at compile time; the digit loops
+// are shared, with 16-bit arithmetic for values that fit (cheap on AVR).
+// Writes into a caller-owned buffer, never allocates, and always keeps the
+// text NUL-terminated. Output that does not fit is dropped and
+// overflowed() reports it.
+//
+// format() covers the printf subset the log, console and status text use, so
+// nothing in the firmware links vsnprintf (and avr-libc's vfprintf).
+class FixedWriter {
+public:
+    FixedWriter(char* buffer, size_t size)
+        : _buf(buffer)
+        , _size(size)
+        , _len(0)
+        , _overflow(false)
+    {
+        if (_size > 0) {
+            _buf[0] = '\0';
+        }
+    }
+
+    // Single character
+    FixedWriter& put(char c);
+
+    // NUL-terminated string
+    FixedWriter& put(const char* str) {
+        return put(str, strlen(str));
+    }
+
+    // First len characters of str
+    FixedWriter& put(const char* str, size_t len);
+
+    // Exactly W digits of a non-negative value, zero-padded ("%0Wu"); only
+    // the low W digits of larger values are written
+    template <uint8_t W, typename T>
+    FixedWriter& digits(T value) {
+        static_assert(W > 0 && W <= 10, "FixedWriter: 1 to 10 digits");
+        if (sizeof(T) <= 2) {
+            return digits16((uint16_t)value, W);
+        }
+        return digits32((uint32_t)value, W);
+    }
+
+    // Exactly width digits, for widths only known at run time; widths
+    // past 10 are zero-padded (11-digit Kenwood frequencies)
+    FixedWriter& digits(uint32_t value, uint8_t width) {
+        return (value <= 0xFFFF) ? digits16((uint16_t)value, width) : digits32(value, width);
+    }
+
+    // As many digits as a non-negative value needs ("%u")
+    template <typename T>
+    FixedWriter& number(T value) {
+        if (sizeof(T) <= 2) {
+            return digits16((uint16_t)value, 0);
+        }
+        return digits32((uint32_t)value, 0);
+    }
+
+    // Sign and exactly W digits ("%+0(W+1)d", e.g. +0050 for W = 4)
+    template <uint8_t W>
+    FixedWriter& signedDigits(int32_t value) {
+        put(value < 0 ? '-' : '+');
+        return digits<W>((value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value);
+    }
+
+    // Fixed-point decimal with F fraction digits and a minimal integer
+    // part, as dtostrf(value, 1, F) ("12.3", "-0.5")
+    // Scaling is done in double (the same as float on AVR) so a float that
+    // prints as x.x5 is not pushed over the rounding edge
+    template <uint8_t F>
+    FixedWriter& fixed(double value) {
+        bool negative = value < 0.0;
+        uint32_t scaled = (uint32_t)((negative ? -value : value) * scale(F) + 0.5);
+        if (negative && scaled != 0) {
+            put('-');
+        }
+        number(scaled / scale(F));
+        put('.');
+        return digits<F>(scaled % scale(F));
+    }
+
+    // Fixed-point decimal already scaled by 10^F, with the integer part
+    // zero-padded to I digits (e.g. NMEA minutes MM.MMMM: I = 2, F = 4)
+    template <uint8_t I, uint8_t F>
+    FixedWriter& fixedDigits(uint32_t scaled) {
+        digits<I>(scaled / scale(F));
+        put('.');
+        return digits<F>(scaled % scale(F));
+    }
+
+    // Two uppercase hex digits ("%02X")
+    FixedWriter& hex(uint8_t value);
+
+    // printf-style text: flags '-', '0' and '+', a width, a precision for
+    // strings ('.N' or '.*'), the 'l' modifier, and d i u x X c s %; no
+    // floating point. Unlike the writers above, output that does not fit
+    // is cut off where the buffer ends, as snprintf does.
+    FixedWriter& format(const char* fmt, ...);
+    FixedWriter& vformat(const char* fmt, va_list args);
+
+    const char* c_str() const { return _buf; }
+    size_t length() const { return _len; }
+    bool overflowed() const { return _overflow; }
+
+    // Discard everything written so far
+    void clear() {
+        _len = 0;
+        _overflow = false;
+        if (_size > 0) {
+            _buf[0] = '\0';
+        }
+    }
+
+private:
+    char* _buf;
+    size_t _size;
+    size_t _len;
+    bool _overflow;
+
+    // 10^f, folded at compile time for template arguments
+    static constexpr uint32_t scale(uint8_t f) {
+        return (f == 0) ? 1 : 10 * scale(f - 1);
+    }
+
+    // Write value as width digits, or as many as it needs if width is 0
+    FixedWriter& digits16(uint16_t value, uint8_t width);
+    FixedWriter& digits32(uint32_t value, uint8_t width);
+
+    // Write n digits stored lowest first, zero-padded to width
+    FixedWriter& putReversed(const char* tmp, uint8_t n, uint8_t width);
+
+    // Write as much of str as fits (format())
+    void clip(const char* str, size_t len);
+    void clipFill(char c, size_t n);
+
+    // Check that n more characters and the terminator fit
+    bool room(size_t n) {
+        if (_len + n < _size) {
+            return true;
+        }
+        _overflow = true;
+        return false;
+    }
+};
@@ -31,6 +31,23 @@ size_t HardwareSerialPort::readBytes(uint8_t* buffer, size_t length) {
     return _serial.readBytes(buffer, length);
 }
 
+size_t HardwareSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    int avail = _serial.available();
+    if (avail <= 0) {
+        return 0;
+    }
+
+    // Only ask for what is already buffered so readBytes() never hits its timeout
+    if ((size_t)avail < length) {
+        length = (size_t)avail;
+    }
+    return _serial.readBytes(buffer, length);
+}
+
+int HardwareSerialPort::availableForWrite() {
+    return _serial.availableForWrite();
+}
+
 size_t HardwareSerialPort::write(uint8_t byte) {
     return _serial.write(byte);
 }
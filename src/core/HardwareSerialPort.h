@@ -16,12 +16,16 @@ public:
     int available() override;
     int read() override;
     size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
     size_t write(uint8_t byte) override;
     size_t write(const uint8_t* buffer, size_t size) override;
     size_t print(const char* str) override;
     size_t println(const char* str) override;
     void flush() override;
+    void service() override {}
     bool isOpen() const override;
+    const char* getPortName() const override { return nullptr; }
 
 private:
     HardwareSerial& _serial;
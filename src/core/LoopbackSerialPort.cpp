@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "LoopbackSerialPort.h"
+
+LoopbackSerialPort::LoopbackSerialPort(ByteRing& rx, ByteRing& tx)
+    : _rx(rx)
+    , _tx(tx)
+    , _writeLimit(0)
+    , _baud(0)
+    , _config(SERIAL_8N1)
+    , _isOpen(false)
+{
+}
+
+void LoopbackSerialPort::begin(uint32_t baud, uint32_t config) {
+    _baud = baud;
+    _config = config;
+    _isOpen = true;
+}
+
+void LoopbackSerialPort::end() {
+    _isOpen = false;
+}
+
+int LoopbackSerialPort::available() {
+    return _isOpen ? (int)_rx.size() : 0;
+}
+
+int LoopbackSerialPort::read() {
+    uint8_t byte;
+    if (!_isOpen || _rx.read(&byte, 1) == 0) {
+        return -1;
+    }
+    return byte;
+}
+
+size_t LoopbackSerialPort::readBytes(uint8_t* buffer, size_t length) {
+    return readAvailable(buffer, length);
+}
+
+size_t LoopbackSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    if (!_isOpen) {
+        return 0;
+    }
+    return _rx.read(buffer, length);
+}
+
+int LoopbackSerialPort::availableForWrite() {
+    if (!_isOpen) {
+        return 0;
+    }
+
+    size_t room = _tx.space();
+    if (_writeLimit > 0) {
+        size_t used = _tx.size();
+        size_t limitRoom = (used < _writeLimit) ? _writeLimit - used : 0;
+        if (limitRoom < room) {
+            room = limitRoom;
+        }
+    }
+    return (int)room;
+}
+
+size_t LoopbackSerialPort::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t LoopbackSerialPort::write(const uint8_t* buffer, size_t size) {
+    size_t room = (size_t)availableForWrite();
+    if (size > room) {
+        size = room;
+    }
+    return _tx.write(buffer, size);
+}
+
+size_t LoopbackSerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t LoopbackSerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
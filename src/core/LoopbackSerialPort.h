@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "ByteRing.h"
+
+// Default buffer size for each direction of a loopback pair (power of 2)
+#define LOOPBACK_BUFFER_SIZE 1024
+
+// One end of an in-memory serial link
+// Bytes written to one end are read from the other. Each direction is a
+// lock-free ByteRing, so the two ends may be driven from different threads
+// (one thread per end). No system calls are involved, which makes a pair the
+// harness for driving a parser or generator directly in benchmarks, or for
+// wiring two emulated devices together inside one process.
+class LoopbackSerialPort : public ISerialPort {
+public:
+    LoopbackSerialPort(ByteRing& rx, ByteRing& tx);
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void flush() override {}
+    void service() override {}
+    bool isOpen() const override { return _isOpen; }
+    const char* getPortName() const override { return "loopback"; }
+
+    // Limit how many bytes may sit unread in this end's TX direction, to
+    // behave like a small hardware FIFO (0 = full ring capacity)
+    // Writes beyond the limit are refused, as on a full UART
+    void setWriteLimit(size_t limit) { _writeLimit = limit; }
+
+    // Configured line settings (from begin)
+    uint32_t getBaud() const { return _baud; }
+    uint32_t getConfig() const { return _config; }
+
+private:
+    ByteRing& _rx;
+    ByteRing& _tx;
+    size_t _writeLimit;
+    uint32_t _baud;
+    uint32_t _config;
+    bool _isOpen;
+};
+
+// Two linked loopback ends
+// Give device() to the code under test (e.g., a CATParser) and drive it from
+// client(), as client software would drive a real port
+class LoopbackSerialPair {
+public:
+    explicit LoopbackSerialPair(size_t capacity = LOOPBACK_BUFFER_SIZE)
+        : _toDevice(capacity)
+        , _toClient(capacity)
+        , _device(_toDevice, _toClient)
+        , _client(_toClient, _toDevice)
+    {
+    }
+
+    LoopbackSerialPort& device() { return _device; }
+    LoopbackSerialPort& client() { return _client; }
+
+private:
+    ByteRing _toDevice;
+    ByteRing _toClient;
+    LoopbackSerialPort _device;
+    LoopbackSerialPort _client;
+};
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "QueuedSerialPort.h"
+#include <string.h>
+
+QueuedSerialPort::QueuedSerialPort(ISerialPort& port, size_t queueSize)
+    : _port(port)
+    , _queue(queueSize)
+{
+    resetStats();
+}
+
+void QueuedSerialPort::begin(uint32_t baud, uint32_t config) {
+    _queue.clear();
+    _port.begin(baud, config);
+}
+
+void QueuedSerialPort::end() {
+    _queue.clear();
+    _port.end();
+}
+
+int QueuedSerialPort::available() {
+    return _port.available();
+}
+
+int QueuedSerialPort::read() {
+    return _port.read();
+}
+
+size_t QueuedSerialPort::readBytes(uint8_t* buffer, size_t length) {
+    return _port.readBytes(buffer, length);
+}
+
+size_t QueuedSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    return _port.readAvailable(buffer, length);
+}
+
+int QueuedSerialPort::availableForWrite() {
+    return (int)_queue.space();
+}
+
+size_t QueuedSerialPort::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t QueuedSerialPort::write(const uint8_t* buffer, size_t size) {
+    size_t sent = 0;
+
+    // Fast path: nothing waiting, so the port can take bytes directly
+    if (_queue.empty()) {
+        int room = _port.availableForWrite();
+        if (room > 0) {
+            size_t direct = ((size_t)room < size) ? (size_t)room : size;
+            sent = _port.write(buffer, direct);
+        }
+    }
+
+    size_t remaining = size - sent;
+    if (remaining == 0) {
+        return size;
+    }
+
+    size_t stored = _queue.write(buffer + sent, remaining);
+    _stats.deferredBytes += stored;
+    _stats.droppedBytes += remaining - stored;
+
+    if (_queue.size() > _stats.highWater) {
+        _stats.highWater = _queue.size();
+    }
+
+    return sent + stored;
+}
+
+size_t QueuedSerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t QueuedSerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+void QueuedSerialPort::flush() {
+    // Blocking by contract: wait until everything queued has been handed over
+    while (!_queue.empty() && _port.isOpen()) {
+        pump();
+    }
+    _port.flush();
+}
+
+bool QueuedSerialPort::isOpen() const {
+    return _port.isOpen();
+}
+
+void QueuedSerialPort::service() {
+    if (_port.isOpen()) {
+        pump();
+    }
+    _port.service();
+}
+
+void QueuedSerialPort::pump() {
+    while (!_queue.empty()) {
+        int room = _port.availableForWrite();
+        if (room <= 0) {
+            return;
+        }
+
+        const uint8_t* data;
+        size_t run = _queue.peek(&data);
+        if ((size_t)room < run) {
+            run = (size_t)room;
+        }
+
+        size_t written = _port.write(data, run);
+        _queue.consume(written);
+        if (written < run) {
+            return;
+        }
+    }
+}
+
+void QueuedSerialPort::resetStats() {
+    _stats.highWater = 0;
+    _stats.deferredBytes = 0;
+    _stats.droppedBytes = 0;
+}
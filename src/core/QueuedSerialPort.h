@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "ByteRing.h"
+
+// TX queue statistics for one port
+struct SerialTxStats {
+    uint32_t highWater;      // Most bytes ever waiting in the queue
+    uint32_t deferredBytes;  // Bytes that had to wait in the queue
+    uint32_t droppedBytes;   // Bytes discarded or skipped because the queue was full
+};
+
+// Serial port wrapper with a software TX ring
+// Writes never block: whatever the port cannot take right now is queued and
+// sent later by pump(), which DeviceManager calls from the main loop.
+// Reads pass straight through to the wrapped port.
+class QueuedSerialPort : public ISerialPort {
+public:
+    QueuedSerialPort(ISerialPort& port, size_t queueSize);
+    ~QueuedSerialPort() override = default;
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void noteDropped(size_t size) override { _stats.droppedBytes += size; }
+    void flush() override;
+    void service() override;
+    bool isOpen() const override;
+    const char* getPortName() const override { return _port.getPortName(); }
+
+    // Move queued bytes into the wrapped port as far as it has room (non-blocking)
+    // service() does this and then services the wrapped port
+    void pump();
+
+    // Number of bytes currently waiting in the queue
+    size_t queued() const { return _queue.size(); }
+    size_t queueSize() const { return _queue.capacity(); }
+
+    const SerialTxStats& getStats() const { return _stats; }
+    void resetStats();
+
+private:
+    ISerialPort& _port;
+    ByteRing _queue;
+    SerialTxStats _stats;
+};
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "ReplyBatch.h"
+#include <string.h>
+
+ReplyBatch::ReplyBatch(ISerialPort& serial, char* buffer, size_t size, ReplyStats& stats)
+    : _serial(serial)
+    , _buf(buffer)
+    , _size(size)
+    , _len(0)
+    , _count(0)
+    , _stats(stats)
+{
+}
+
+void ReplyBatch::add(const char* reply, size_t len) {
+    if (_len + len > _size) {
+        flush();
+    }
+
+    // Too long to stage at all: send it on its own
+    if (len > _size) {
+        send(reply, len, 1);
+        return;
+    }
+
+    memcpy(_buf + _len, reply, len);
+    _len += len;
+    _count++;
+}
+
+char* ReplyBatch::reserve(size_t maxLen) {
+    if (maxLen > _size) {
+        return nullptr;
+    }
+    if (_len + maxLen > _size) {
+        flush();
+    }
+    return _buf + _len;
+}
+
+void ReplyBatch::commit(size_t len) {
+    if (len == 0) {
+        return;
+    }
+    _len += len;
+    _count++;
+}
+
+void ReplyBatch::flush() {
+    if (_len == 0) {
+        return;
+    }
+    send(_buf, _len, _count);
+    _len = 0;
+    _count = 0;
+}
+
+void ReplyBatch::send(const char* data, size_t len, uint16_t replies) {
+    _serial.write((const uint8_t*)data, len);
+    _stats.replies += replies;
+    _stats.writes++;
+    if (replies > _stats.maxBatch) {
+        _stats.maxBatch = replies;
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+
+// Reply counters for one parser
+struct ReplyStats {
+    uint32_t replies;   // Replies sent
+    uint32_t writes;    // Port writes that carried them
+    uint16_t maxBatch;  // Most replies carried by one write
+};
+
+// Replies to one input burst, sent together
+// A parser creates one on the stack in update(), adds each reply as its
+// command completes, and flushes once the input is drained, so a client
+// polling "FA;MD0;IF;SM0;" gets its four replies in a single port write.
+// A reply that does not fit flushes the staged ones first.
+class ReplyBatch {
+public:
+    ReplyBatch(ISerialPort& serial, char* buffer, size_t size, ReplyStats& stats);
+
+    // Stage one complete reply
+    void add(const char* reply, size_t len);
+
+    // Room for a reply of up to maxLen bytes, to be built in place and
+    // staged with commit(); flushes first if it does not fit. Returns
+    // nullptr if maxLen is larger than the whole batch.
+    char* reserve(size_t maxLen);
+
+    // Stage the first len bytes of the last reserve() (0 stages nothing)
+    void commit(size_t len);
+
+    // Write the staged replies, if any
+    void flush();
+
+private:
+    ISerialPort& _serial;
+    char* _buf;
+    size_t _size;
+    size_t _len;
+    uint16_t _count;  // Replies staged since the last write
+    ReplyStats& _stats;
+
+    void send(const char* data, size_t len, uint16_t replies);
+};
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "ReplyDelay.h"
+#include <string.h>
+
+static_assert((REPLY_DELAY_ENTRIES & (REPLY_DELAY_ENTRIES - 1)) == 0,
+              "REPLY_DELAY_ENTRIES must be a power of two");
+static_assert(REPLY_DELAY_ENTRIES <= 32768, "Entry indices are 16-bit");
+static_assert(REPLY_BATCH_SIZE <= 255, "Entry lengths are 8-bit");
+
+LatencyModel::LatencyModel(uint32_t seed)
+    : _baseUs(0)
+    , _jitterUs(0)
+    , _random((seed != 0) ? seed : 1)
+{
+}
+
+void LatencyModel::set(uint16_t latencyMs, uint16_t jitterMs) {
+    _baseUs = (uint32_t)latencyMs * 1000UL;
+    _jitterUs = (uint32_t)jitterMs * 1000UL;
+}
+
+uint32_t LatencyModel::sampleUs() {
+    if (_jitterUs == 0) {
+        return _baseUs;
+    }
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _baseUs + _random % (_jitterUs + 1);
+}
+
+ReplyDelay::ReplyDelay()
+    : _enabled(false)
+    , _bytes(nullptr)
+    , _entries(nullptr)
+    , _head(0)
+    , _tail(0)
+    , _lastDueUs(0)
+{
+    _latency[1] = LatencyModel(0x2545F491UL);
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+ReplyDelay::~ReplyDelay() {
+    delete _bytes;
+    delete[] _entries;
+}
+
+void ReplyDelay::setLatency(ReplyClass cls, uint16_t latencyMs, uint16_t jitterMs) {
+    uint8_t index = (uint8_t)cls;
+    if (index >= 2) {
+        return;
+    }
+    _latency[index].set(latencyMs, jitterMs);
+    _enabled = !_latency[0].isZero() || !_latency[1].isZero();
+
+    if (_enabled && _bytes == nullptr) {
+        _bytes = new ByteRing(REPLY_DELAY_QUEUE_SIZE);
+        _entries = new Entry[REPLY_DELAY_ENTRIES];
+        _lastDueUs = micros();
+    }
+}
+
+uint32_t ReplyDelay::schedule(ReplyClass cls, uint32_t nowUs) {
+    uint32_t due = nowUs;
+    uint8_t index = (uint8_t)cls;
+    if (index < 2) {
+        due += _latency[index].sampleUs();
+    }
+
+    // Never ahead of an earlier command
+    if ((int32_t)(due - _lastDueUs) < 0) {
+        due = _lastDueUs;
+    }
+    _lastDueUs = due;
+    return due;
+}
+
+bool ReplyDelay::add(ReplyClass cls, const char* reply, size_t len, uint32_t nowUs) {
+    if (_bytes == nullptr) {
+        return false;
+    }
+
+    // Replies are at most a batch long; they are copied out on the stack
+    // A dropped reply does not keep the device busy
+    if (len > REPLY_BATCH_SIZE || len > _bytes->space() || waiting() >= REPLY_DELAY_ENTRIES) {
+        _stats.dropped++;
+        return false;
+    }
+    uint32_t due = schedule(cls, nowUs);
+
+    Entry& entry = _entries[_head & (REPLY_DELAY_ENTRIES - 1)];
+    entry.dueUs = due;
+    entry.len = (uint8_t)len;
+    _bytes->write((const uint8_t*)reply, len);
+    _head++;
+
+    _stats.delayed++;
+    if (waiting() > _stats.peak) {
+        _stats.peak = (uint16_t)waiting();
+    }
+    return true;
+}
+
+void ReplyDelay::hold(ReplyClass cls, uint32_t nowUs) {
+    if (_bytes != nullptr) {
+        schedule(cls, nowUs);
+    }
+}
+
+void ReplyDelay::release(ReplyBatch& out, uint32_t nowUs, size_t room) {
+    while (_tail != _head) {
+        const Entry& entry = _entries[_tail & (REPLY_DELAY_ENTRIES - 1)];
+        int32_t late = (int32_t)(nowUs - entry.dueUs);
+        if (late < 0 || entry.len > room) {
+            return;
+        }
+        room -= entry.len;
+        if ((uint32_t)late > _stats.maxLateUs) {
+            _stats.maxLateUs = (uint32_t)late;
+        }
+
+        char reply[REPLY_BATCH_SIZE];
+        size_t len = _bytes->read((uint8_t*)reply, entry.len);
+        _tail++;
+        out.add(reply, len);
+    }
+
+    // Idle: keep the last due time close to now, so it cannot wrap
+    // around ahead of the clock
+    if (_bytes != nullptr && (int32_t)(nowUs - _lastDueUs) > 0) {
+        _lastDueUs = nowUs;
+    }
+}
+
+uint32_t ReplyDelay::untilNext(uint32_t nowUs) const {
+    if (_tail == _head) {
+        return REPLY_DELAY_IDLE_US;
+    }
+    int32_t wait = (int32_t)(_entries[_tail & (REPLY_DELAY_ENTRIES - 1)].dueUs - nowUs);
+    return (wait > 0) ? (uint32_t)wait : 0;
+}
+
+void ReplyDelay::clear() {
+    if (_bytes != nullptr) {
+        _bytes->clear();
+    }
+    _tail = _head;
+}
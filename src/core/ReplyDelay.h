@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "platform_config.h"
+#include "ReplyBatch.h"
+#include "ByteRing.h"
+
+// Longest latency or jitter a device option accepts (ms)
+#define REPLY_LATENCY_MAX_MS 1000
+
+// Returned by untilNext() when no reply is waiting
+#define REPLY_DELAY_IDLE_US 0xFFFFFFFFUL
+
+// Command classes with their own latency
+enum class ReplyClass : uint8_t {
+    READ = 0,   // Commands that reply ("FA;", "C2")
+    SET,        // Commands without a reply ("FA014074000;", "M180")
+    PUSH        // Output the device sends unasked (AI reports), never delayed
+};
+
+// Latency of a device: a fixed part plus a uniform random jitter
+class LatencyModel {
+public:
+    explicit LatencyModel(uint32_t seed = 0x9E3779B9UL);
+
+    void set(uint16_t latencyMs, uint16_t jitterMs);
+    bool isZero() const { return _baseUs == 0 && _jitterUs == 0; }
+
+    // Draw one latency (us)
+    uint32_t sampleUs();
+
+private:
+    uint32_t _baseUs;
+    uint32_t _jitterUs;
+    uint32_t _random;    // xorshift32 state
+};
+
+// Delayed-reply counters for one port
+struct ReplyDelayStats {
+    uint32_t delayed;    // Replies that went through the queue
+    uint32_t dropped;    // Replies discarded because the queue was full
+    uint16_t peak;       // Most replies waiting at once
+    uint32_t maxLateUs;  // Worst release time after a reply was due
+};
+
+// Response latency of a real device, for one port
+// A real radio takes 10-50 ms to answer some commands; this holds each
+// reply until the latency of its command class, plus a uniform random
+// jitter, has passed since the command arrived. A command without a
+// reply keeps the device busy for its class latency, so a reply to a
+// later command waits for it. Replies leave in the order their commands
+// arrived, so their due times never decrease and the queue is a FIFO:
+// adding and releasing a reply cost the same however many are waiting.
+// The queue is allocated when a latency is first set.
+class ReplyDelay {
+public:
+    ReplyDelay();
+    ~ReplyDelay();
+
+    // Latency of a class of command: latencyMs plus up to jitterMs
+    // All zero (the default) answers at once
+    void setLatency(ReplyClass cls, uint16_t latencyMs, uint16_t jitterMs);
+    bool isEnabled() const { return _enabled; }
+
+    // Queue a reply to a command that arrived at nowUs (micros())
+    // Returns false if it was dropped
+    bool add(ReplyClass cls, const char* reply, size_t len, uint32_t nowUs);
+
+    // A command without a reply arrived at nowUs
+    void hold(ReplyClass cls, uint32_t nowUs);
+
+    // Pass the replies that are due to out, in order, up to room bytes
+    // (the port's availableForWrite()); the rest wait for the next call
+    void release(ReplyBatch& out, uint32_t nowUs, size_t room);
+
+    // Microseconds from nowUs until the next reply is due, 0 if one is
+    // overdue, REPLY_DELAY_IDLE_US if none is waiting
+    uint32_t untilNext(uint32_t nowUs) const;
+
+    // Discard waiting replies
+    void clear();
+
+    size_t waiting() const { return (uint16_t)(_head - _tail); }
+    const ReplyDelayStats& getStats() const { return _stats; }
+
+private:
+    // One waiting reply; its bytes are the next len bytes of _bytes
+    struct Entry {
+        uint32_t dueUs;
+        uint8_t len;
+    };
+
+    bool _enabled;
+    LatencyModel _latency[2];   // READ and SET
+    ByteRing* _bytes;
+    Entry* _entries;            // REPLY_DELAY_ENTRIES, a power of two
+    uint16_t _head;             // Free-running entry indices
+    uint16_t _tail;
+    uint32_t _lastDueUs;        // Due time of the last reply or hold
+    ReplyDelayStats _stats;
+
+    // Due time of a command of cls arriving at nowUs, after the last one
+    uint32_t schedule(ReplyClass cls, uint32_t nowUs);
+
+    // Not copyable
+    ReplyDelay(const ReplyDelay&);
+    ReplyDelay& operator=(const ReplyDelay&);
+};
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "SerialCapture.h"
+
+// Static member initialization
+CaptureHeader* SerialCapture::_header = nullptr;
+uint8_t* SerialCapture::_ring = nullptr;
+uint32_t SerialCapture::_mask = 0;
+uint32_t SerialCapture::_enabledMask = 0;
+
+bool SerialCapture::begin(uint8_t* buffer, size_t size) {
+    if (buffer == nullptr || size < sizeof(CaptureHeader) + 2 * CAPTURE_RECORD_HEADER) {
+        return false;
+    }
+
+    // Largest power of 2 that fits after the header
+    uint32_t capacity = 1;
+    while ((size_t)capacity * 2 <= size - sizeof(CaptureHeader)) {
+        capacity *= 2;
+    }
+
+    CaptureHeader* header = (CaptureHeader*)buffer;
+    memset(header, 0, sizeof(CaptureHeader));
+    header->magic = CAPTURE_MAGIC;
+    header->version = CAPTURE_VERSION;
+    header->capacity = capacity;
+
+    _ring = buffer + sizeof(CaptureHeader);
+    _mask = capacity - 1;
+    _header = header;
+    return true;
+}
+
+void SerialCapture::setEnabled(uint8_t uartIndex, bool enabled) {
+    uint32_t bits;
+    if (uartIndex == 0) {
+        bits = 0xFFFFFFFFUL;
+    } else if (uartIndex <= PLATFORM_MAX_UARTS) {
+        bits = 1UL << (uartIndex - 1);
+    } else {
+        return;
+    }
+
+    if (enabled) {
+        _enabledMask |= bits;
+    } else {
+        _enabledMask &= ~bits;
+    }
+}
+
+void SerialCapture::clear() {
+    if (_header != nullptr) {
+        _header->tail = _header->head;
+        _header->overwritten = 0;
+    }
+}
+
+size_t SerialCapture::getBufferSize() {
+    return (_header != nullptr) ? sizeof(CaptureHeader) + _header->capacity : 0;
+}
+
+size_t SerialCapture::getUsed() {
+    return (_header != nullptr) ? _header->head - _header->tail : 0;
+}
+
+uint32_t SerialCapture::getOverwritten() {
+    return (_header != nullptr) ? _header->overwritten : 0;
+}
+
+void SerialCapture::put(uint32_t offset, const uint8_t* data, size_t len) {
+    size_t start = offset & _mask;
+    size_t run = _mask + 1 - start;
+    if (run > len) {
+        run = len;
+    }
+    memcpy(&_ring[start], data, run);
+    memcpy(_ring, data + run, len - run);
+}
+
+void SerialCapture::append(uint8_t uartIndex, bool tx, const uint8_t* data, size_t len) {
+    uint32_t stamp = micros();
+    uint8_t port = uartIndex | (tx ? CAPTURE_DIR_TX : 0);
+
+    while (len > 0) {
+        uint8_t chunk = (len > CAPTURE_MAX_CHUNK) ? CAPTURE_MAX_CHUNK : (uint8_t)len;
+        uint32_t need = CAPTURE_RECORD_HEADER + chunk;
+        if (need > _header->capacity) {
+            return;
+        }
+
+        // Drop the oldest records until the new one fits
+        uint32_t head = _header->head;
+        while (head - _header->tail + need > _header->capacity) {
+            uint8_t oldLen = _ring[(_header->tail + 5) & _mask];
+            _header->tail += CAPTURE_RECORD_HEADER + oldLen;
+            _header->overwritten++;
+        }
+
+        uint8_t record[CAPTURE_RECORD_HEADER] = {
+            (uint8_t)stamp, (uint8_t)(stamp >> 8),
+            (uint8_t)(stamp >> 16), (uint8_t)(stamp >> 24),
+            port, chunk
+        };
+        put(head, record, sizeof(record));
+        put(head + CAPTURE_RECORD_HEADER, data, chunk);
+
+        // Publish the record only once it is complete, for live readers
+        _header->head = head + need;
+
+        data += chunk;
+        len -= chunk;
+    }
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "SerialFanOut.h"
+#include <string.h>
+
+SerialFanOut::SerialFanOut()
+    : _count(0)
+{
+    for (size_t i = 0; i < DEVICE_MAX_PORTS; i++) {
+        _ports[i] = nullptr;
+        _uarts[i] = 0;
+    }
+}
+
+bool SerialFanOut::add(ISerialPort* port, uint8_t uartIndex) {
+    if (port == nullptr || _count >= DEVICE_MAX_PORTS || indexOf(uartIndex) >= 0) {
+        return false;
+    }
+    _ports[_count] = port;
+    _uarts[_count] = uartIndex;
+    _count++;
+    return true;
+}
+
+bool SerialFanOut::remove(uint8_t uartIndex) {
+    int index = indexOf(uartIndex);
+    if (index < 0) {
+        return false;
+    }
+    for (size_t i = (size_t)index; i + 1 < _count; i++) {
+        _ports[i] = _ports[i + 1];
+        _uarts[i] = _uarts[i + 1];
+    }
+    _count--;
+    _ports[_count] = nullptr;
+    _uarts[_count] = 0;
+    return true;
+}
+
+int SerialFanOut::indexOf(uint8_t uartIndex) const {
+    for (size_t i = 0; i < _count; i++) {
+        if (_uarts[i] == uartIndex) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+void SerialFanOut::begin(uint32_t baud, uint32_t config) {
+    for (size_t i = 0; i < _count; i++) {
+        _ports[i]->begin(baud, config);
+    }
+}
+
+void SerialFanOut::end() {
+    for (size_t i = 0; i < _count; i++) {
+        _ports[i]->end();
+    }
+}
+
+size_t SerialFanOut::readBytes(uint8_t* buffer, size_t length) {
+    (void)buffer;
+    (void)length;
+    return 0;
+}
+
+size_t SerialFanOut::readAvailable(uint8_t* buffer, size_t length) {
+    (void)buffer;
+    (void)length;
+    return 0;
+}
+
+int SerialFanOut::availableForWrite() {
+    // Room on the emptiest port: a run that fits reaches at least one client
+    int room = 0;
+    for (size_t i = 0; i < _count; i++) {
+        if (_ports[i]->isOpen()) {
+            int space = _ports[i]->availableForWrite();
+            if (space > room) {
+                room = space;
+            }
+        }
+    }
+    return room;
+}
+
+size_t SerialFanOut::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t SerialFanOut::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    for (size_t i = 0; i < _count; i++) {
+        ISerialPort* port = _ports[i];
+        if (!port->isOpen()) {
+            continue;
+        }
+        if (port->availableForWrite() < (int)size) {
+            port->noteDropped(size);
+            continue;
+        }
+        size_t count = port->write(buffer, size);
+        if (count > written) {
+            written = count;
+        }
+    }
+    return written;
+}
+
+size_t SerialFanOut::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t SerialFanOut::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+void SerialFanOut::noteDropped(size_t size) {
+    // Skipped by the writer, so lost on every client
+    for (size_t i = 0; i < _count; i++) {
+        if (_ports[i]->isOpen()) {
+            _ports[i]->noteDropped(size);
+        }
+    }
+}
+
+void SerialFanOut::flush() {
+    for (size_t i = 0; i < _count; i++) {
+        _ports[i]->flush();
+    }
+}
+
+void SerialFanOut::service() {
+    for (size_t i = 0; i < _count; i++) {
+        _ports[i]->service();
+    }
+}
+
+bool SerialFanOut::isOpen() const {
+    for (size_t i = 0; i < _count; i++) {
+        if (_ports[i]->isOpen()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* SerialFanOut::getPortName() const {
+    return (_count > 0) ? _ports[0]->getPortName() : nullptr;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "platform_config.h"
+
+// Set of ports one device is served on, written as a single port
+// A device formats its output once and writes it here; each byte run is
+// copied to every open port. A run goes to a port only if the port has
+// room for all of it, so a slow client loses whole messages instead of
+// receiving fragments, and never holds back the others; the skipped run
+// counts as dropped on that port. Reads return
+// nothing: input is per port, handled by one parser per port.
+class SerialFanOut : public ISerialPort {
+public:
+    SerialFanOut();
+
+    // Add a port for a UART, returns false if full or the UART is present
+    bool add(ISerialPort* port, uint8_t uartIndex);
+
+    // Remove the port for a UART, returns false if not present
+    // Later ports move down one index
+    bool remove(uint8_t uartIndex);
+
+    // Index of the port for a UART, or -1 if not present
+    int indexOf(uint8_t uartIndex) const;
+
+    size_t count() const { return _count; }
+    ISerialPort* getPort(size_t index) const { return (index < _count) ? _ports[index] : nullptr; }
+    uint8_t getUart(size_t index) const { return (index < _count) ? _uarts[index] : 0; }
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void noteDropped(size_t size) override;
+    void flush() override;
+    void service() override;
+    bool isOpen() const override;
+    const char* getPortName() const override;
+
+private:
+    ISerialPort* _ports[DEVICE_MAX_PORTS];
+    uint8_t _uarts[DEVICE_MAX_PORTS];
+    size_t _count;
+};
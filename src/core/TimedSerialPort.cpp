@@ -0,0 +1,258 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "TimedSerialPort.h"
+#include "platform_config.h"
+
+// Frame formats and their length on the wire (start + data + parity + stop)
+// The SERIAL_xPy values differ between cores, so they are matched by name
+struct FrameFormat {
+    uint32_t config;
+    uint8_t bits;
+};
+
+static const FrameFormat FRAME_FORMATS[] = {
+    { SERIAL_8N1, 10 }, { SERIAL_8N2, 11 },
+    { SERIAL_8E1, 11 }, { SERIAL_8E2, 12 },
+    { SERIAL_8O1, 11 }, { SERIAL_8O2, 12 },
+    { SERIAL_7N1, 9 },  { SERIAL_7N2, 10 },
+    { SERIAL_7E1, 10 }, { SERIAL_7E2, 11 },
+    { SERIAL_7O1, 10 }, { SERIAL_7O2, 11 },
+};
+
+#define FRAME_FORMAT_COUNT (sizeof(FRAME_FORMATS) / sizeof(FRAME_FORMATS[0]))
+
+// Default frame length (8N1)
+#define DEFAULT_FRAME_BITS 10
+
+TimedSerialPort::TimedSerialPort(ISerialPort& port)
+    : _port(port)
+    , _tx(TIMED_TX_FIFO_SIZE)
+    , _rx(TIMED_RX_BUFFER_SIZE)
+    , _rxReady(0)
+    , _baud(0)
+    , _frameBits(DEFAULT_FRAME_BITS)
+{
+    _txLine.epochUs = 0;
+    _txLine.done = 0;
+    _rxLine.epochUs = 0;
+    _rxLine.done = 0;
+}
+
+uint8_t TimedSerialPort::getFrameBits(uint32_t config) {
+    for (size_t i = 0; i < FRAME_FORMAT_COUNT; i++) {
+        if (FRAME_FORMATS[i].config == config) {
+            return FRAME_FORMATS[i].bits;
+        }
+    }
+    return DEFAULT_FRAME_BITS;
+}
+
+uint32_t TimedSerialPort::getCharTimeUs() const {
+    if (_baud == 0) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)_frameBits * 1000000UL + _baud - 1) / _baud);
+}
+
+void TimedSerialPort::begin(uint32_t baud, uint32_t config) {
+    _baud = baud;
+    _frameBits = getFrameBits(config);
+    _tx.clear();
+    _rx.clear();
+    _rxReady = 0;
+    _port.begin(baud, config);
+}
+
+void TimedSerialPort::end() {
+    _tx.clear();
+    _rx.clear();
+    _rxReady = 0;
+    _port.end();
+}
+
+uint32_t TimedSerialPort::elapsedChars(const LinePacer& line, uint32_t now) const {
+    if (_baud == 0) {
+        return 0xFFFFFFFFUL;
+    }
+    uint64_t bits = (uint64_t)(now - line.epochUs) * _baud;
+    return (uint32_t)(bits / ((uint32_t)_frameBits * 1000000UL));
+}
+
+uint32_t TimedSerialPort::untilChar(const LinePacer& line, uint32_t n, uint32_t now) const {
+    if (_baud == 0) {
+        return 0;
+    }
+    uint64_t bitsUs = (uint64_t)n * _frameBits * 1000000UL;
+    uint32_t complete = line.epochUs + (uint32_t)((bitsUs + _baud - 1) / _baud);
+    int32_t remaining = (int32_t)(complete - now);
+    return (remaining > 0) ? (uint32_t)remaining : 0;
+}
+
+void TimedSerialPort::rebase(LinePacer& line) {
+    // _baud characters take exactly _frameBits seconds
+    while (_baud > 0 && line.done >= _baud) {
+        line.epochUs += (uint32_t)_frameBits * 1000000UL;
+        line.done -= _baud;
+    }
+}
+
+void TimedSerialPort::pullRx() {
+    uint8_t chunk[SERIAL_RX_CHUNK_SIZE];
+    while (_rx.space() > 0) {
+        size_t want = _rx.space();
+        if (want > sizeof(chunk)) {
+            want = sizeof(chunk);
+        }
+        size_t count = _port.readAvailable(chunk, want);
+        if (count == 0) {
+            break;
+        }
+
+        // First byte on an idle line starts a new burst
+        if (_rx.size() == _rxReady) {
+            _rxLine.epochUs = micros();
+            _rxLine.done = 0;
+        }
+        _rx.write(chunk, count);
+    }
+}
+
+void TimedSerialPort::releaseRx() {
+    size_t pending = _rx.size() - _rxReady;
+    if (pending == 0) {
+        return;
+    }
+
+    uint32_t due = elapsedChars(_rxLine, micros()) - _rxLine.done;
+    if (due > pending) {
+        due = pending;
+    }
+    _rxReady += due;
+    _rxLine.done += due;
+    rebase(_rxLine);
+}
+
+void TimedSerialPort::releaseTx() {
+    if (_tx.empty()) {
+        return;
+    }
+
+    uint32_t due = elapsedChars(_txLine, micros()) - _txLine.done;
+    while (due > 0 && !_tx.empty()) {
+        const uint8_t* data;
+        size_t run = _tx.peek(&data);
+        if (run > due) {
+            run = due;
+        }
+        size_t written = _port.write(data, run);
+        _tx.consume(written);
+        _txLine.done += written;
+        due -= written;
+        if (written < run) {
+            break;  // Port is full, retry on the next pass
+        }
+    }
+    rebase(_txLine);
+}
+
+int TimedSerialPort::available() {
+    pullRx();
+    releaseRx();
+    return (int)_rxReady;
+}
+
+int TimedSerialPort::read() {
+    uint8_t byte;
+    return (readAvailable(&byte, 1) == 1) ? byte : -1;
+}
+
+size_t TimedSerialPort::readBytes(uint8_t* buffer, size_t length) {
+    return readAvailable(buffer, length);
+}
+
+size_t TimedSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    pullRx();
+    releaseRx();
+    if (length > _rxReady) {
+        length = _rxReady;
+    }
+    size_t count = _rx.read(buffer, length);
+    _rxReady -= count;
+    return count;
+}
+
+int TimedSerialPort::availableForWrite() {
+    if (!_port.isOpen()) {
+        return 0;
+    }
+    releaseTx();
+    return (int)_tx.space();
+}
+
+size_t TimedSerialPort::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t TimedSerialPort::write(const uint8_t* buffer, size_t size) {
+    if (!_port.isOpen()) {
+        return 0;
+    }
+
+    releaseTx();
+
+    // First byte on an idle line starts a new burst
+    if (_tx.empty()) {
+        _txLine.epochUs = micros();
+        _txLine.done = 0;
+    }
+    return _tx.write(buffer, size);
+}
+
+size_t TimedSerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t TimedSerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+void TimedSerialPort::flush() {
+    releaseTx();
+    while (!_tx.empty() && _port.isOpen()) {
+        uint32_t wait = untilChar(_txLine, _txLine.done + 1, micros());
+        if (wait > 0) {
+            delayMicroseconds(wait);
+        }
+        size_t before = _tx.size();
+        releaseTx();
+        if (wait == 0 && _tx.size() == before) {
+            break;  // Port will not take more, nothing to wait for
+        }
+    }
+    _port.flush();
+}
+
+void TimedSerialPort::service() {
+    pullRx();
+    releaseRx();
+    releaseTx();
+    _port.service();
+}
+
+uint32_t TimedSerialPort::getNextEventUs() {
+    uint32_t now = micros();
+    uint32_t next = TIMED_IDLE_US;
+
+    if (!_tx.empty()) {
+        next = untilChar(_txLine, _txLine.done + 1, now);
+    }
+    if (_rx.size() > _rxReady) {
+        uint32_t rxNext = untilChar(_rxLine, _rxLine.done + 1, now);
+        if (rxNext < next) {
+            next = rxNext;
+        }
+    }
+    return next;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "ByteRing.h"
+
+// Simulated UART transmit FIFO size (must be a power of 2)
+// Matches the Arduino HardwareSerial TX buffer, so writers see the same
+// back-pressure they would on a board
+#define TIMED_TX_FIFO_SIZE 64
+
+// Simulated UART receive buffer size (must be a power of 2)
+#define TIMED_RX_BUFFER_SIZE 256
+
+// Returned by getNextEventUs() when no byte is in flight
+#define TIMED_IDLE_US 0xFFFFFFFFUL
+
+// Paces a serial port at real line speed
+// Virtual ports (pty, socket, loopback) move bytes instantly. This wrapper
+// uses the baud rate and frame format from begin() to release each byte
+// only after its full character time (start + data + parity + stop bits)
+// has elapsed on the line, in both directions. Scheduling uses micros();
+// nothing blocks except flush(). getNextEventUs() tells the main loop how
+// long it may sleep before the next byte is due.
+class TimedSerialPort : public ISerialPort {
+public:
+    explicit TimedSerialPort(ISerialPort& port);
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void flush() override;
+    void service() override;
+    bool isOpen() const override { return _port.isOpen(); }
+    const char* getPortName() const override { return _port.getPortName(); }
+
+    // Microseconds until the next byte is due in either direction
+    // Returns TIMED_IDLE_US if nothing is in flight
+    uint32_t getNextEventUs();
+
+    // Time one character occupies the line (0 before begin)
+    uint32_t getCharTimeUs() const;
+
+    // Bits on the wire per character for a SERIAL_xPy frame setting
+    static uint8_t getFrameBits(uint32_t config);
+
+private:
+    // Schedule for one direction of the line
+    // A burst starts when a byte arrives on an idle line; character k of
+    // the burst completes at epoch + (k + 1) character times
+    struct LinePacer {
+        uint32_t epochUs;  // Start of the current burst
+        uint32_t done;     // Characters completed since epoch
+    };
+
+    ISerialPort& _port;
+    ByteRing _tx;          // Written, not yet on the line
+    ByteRing _rx;          // Received from the port, including bytes still arriving
+    size_t _rxReady;       // Bytes at the front of _rx whose time has passed
+    uint32_t _baud;
+    uint8_t _frameBits;
+    LinePacer _txLine;
+    LinePacer _rxLine;
+
+    // Characters completed on a line by now since its epoch
+    uint32_t elapsedChars(const LinePacer& line, uint32_t now) const;
+    // Microseconds from now until character n of the burst completes
+    uint32_t untilChar(const LinePacer& line, uint32_t n, uint32_t now) const;
+    // Drop whole seconds of bits from the epoch so now - epoch never wraps
+    void rebase(LinePacer& line);
+
+    void pullRx();
+    void releaseRx();
+    void releaseTx();
+};
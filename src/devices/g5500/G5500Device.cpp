@@ -3,7 +3,7 @@
 
 #include "G5500Device.h"
 #include <string.h>
-#include <stdio.h>
+#include "core/FixedWriter.h"
 
 // Baud rate options for GS-232
 static const char* BAUD_RATE_OPTIONS[] = {"1200", "4800", "9600"};
@@ -21,13 +21,18 @@ static const uint32_t DEFAULT_EL_SPEED_INT = 1;
 static const unsigned long MIN_UPDATE_INTERVAL = 10;
 
 G5500Device::G5500Device(ISerialPort* serial, uint8_t uartIndex)
-    : _serial(serial)
-    , _uartIndex(uartIndex)
+    : _uartIndex(uartIndex)
     , _deviceId(0xFF)
     , _running(false)
     , _logger(nullptr)
-    , _parser(_state, *serial)
 {
+    for (size_t i = 0; i < DEVICE_MAX_PORTS; i++) {
+        _parsers[i] = nullptr;
+    }
+    if (serial != nullptr) {
+        _ports.add(serial, uartIndex);
+        _parsers[0] = new GS232Parser(_state, *serial);
+    }
     _state.reset();
     initOptions();
 }
@@ -36,6 +41,49 @@ G5500Device::~G5500Device() {
     if (_running) {
         end();
     }
+    for (size_t i = 0; i < DEVICE_MAX_PORTS; i++) {
+        delete _parsers[i];
+    }
+}
+
+bool G5500Device::attachPort(ISerialPort* serial, uint8_t uartIndex) {
+    if (!_ports.add(serial, uartIndex)) {
+        return false;
+    }
+
+    GS232Parser* parser = new GS232Parser(_state, *serial);
+    parser->setLogger(_logger);
+    applyLatency(parser);
+    _parsers[_ports.count() - 1] = parser;
+
+    if (_running) {
+        serial->begin(getBaudRate());
+    }
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "G5500", "Device %d also on UART %d", _deviceId, uartIndex);
+    }
+    return true;
+}
+
+bool G5500Device::detachPort(uint8_t uartIndex) {
+    int index = _ports.indexOf(uartIndex);
+    if (index <= 0) {
+        return false;  // Not attached, or the primary port
+    }
+
+    if (_running) {
+        _ports.getPort(index)->end();
+    }
+    delete _parsers[index];
+
+    // Keep parsers in step with the ports
+    for (size_t i = (size_t)index; i + 1 < _ports.count(); i++) {
+        _parsers[i] = _parsers[i + 1];
+    }
+    _parsers[_ports.count() - 1] = nullptr;
+    _ports.remove(uartIndex);
+    return true;
 }
 
 void G5500Device::initOptions() {
@@ -65,15 +113,50 @@ void G5500Device::initOptions() {
         MAX_SPEED,
         DEFAULT_EL_SPEED_INT
     );
+
+    // Options 3-6: Response latency (ms). A position reply waits
+    // read_latency plus up to read_jitter; a rotation command keeps the
+    // controller busy for set_latency plus up to set_jitter
+    _options[3] = makeUint32Option(
+        "read_latency",
+        "Reply latency (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
+    _options[4] = makeUint32Option(
+        "read_jitter",
+        "Reply latency jitter (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
+    _options[5] = makeUint32Option(
+        "set_latency",
+        "Busy time after a command (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
+    _options[6] = makeUint32Option(
+        "set_jitter",
+        "Busy time jitter (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
 }
 
 bool G5500Device::begin() {
-    if (_serial == nullptr) {
+    if (_ports.count() == 0) {
         return false;
     }
 
     applyBaudRate();
-    _parser.reset();
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->reset();
+        applyLatency(_parsers[i]);
+    }
     _state.reset();
     _state.lastUpdateMs = millis();
     _running = true;
@@ -89,7 +172,7 @@ bool G5500Device::begin() {
 void G5500Device::end() {
     _running = false;
     _state.stopAll();
-    _serial->end();
+    _ports.end();
 
     if (_logger) {
         _logger->logf(LogLevel::INFO, "G5500", "Stopped on UART %d", _uartIndex);
@@ -99,8 +182,10 @@ void G5500Device::end() {
 void G5500Device::update() {
     if (!_running) return;
 
-    // Process incoming GS-232 commands
-    _parser.update();
+    // Process incoming GS-232 commands from each client
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->update();
+    }
 
     // Simulate rotation based on elapsed time
     simulateRotation();
@@ -193,13 +278,40 @@ void G5500Device::simulateRotation() {
     }
 }
 
-void G5500Device::applyBaudRate() {
+uint32_t G5500Device::getBaudRate() const {
     uint8_t baudIndex = _options[0].value.enumVal.current;
     if (baudIndex >= NUM_BAUD_RATES) {
         baudIndex = DEFAULT_BAUD_INDEX;
     }
-    uint32_t baud = BAUD_RATE_VALUES[baudIndex];
-    _serial->begin(baud);
+    return BAUD_RATE_VALUES[baudIndex];
+}
+
+void G5500Device::applyBaudRate() {
+    _ports.begin(getBaudRate());
+}
+
+void G5500Device::applyLatency(GS232Parser* parser) {
+    parser->setLatency(ReplyClass::READ,
+                       (uint16_t)_options[3].value.uint32Val.current,
+                       (uint16_t)_options[4].value.uint32Val.current);
+    parser->setLatency(ReplyClass::SET,
+                       (uint16_t)_options[5].value.uint32Val.current,
+                       (uint16_t)_options[6].value.uint32Val.current);
+}
+
+uint32_t G5500Device::getNextEventUs() const {
+    uint32_t next = DEVICE_IDLE_US;
+    if (!_running) {
+        return next;
+    }
+    uint32_t now = micros();
+    for (size_t i = 0; i < _ports.count(); i++) {
+        uint32_t due = _parsers[i]->getReplyDelay().untilNext(now);
+        if (due < next) {
+            next = due;
+        }
+    }
+    return next;
 }
 
 float G5500Device::getAzSpeed() const {
@@ -241,6 +353,13 @@ bool G5500Device::setOption(const char* name, const char* value) {
         applyBaudRate();
     }
 
+    // Latency and jitter options apply to every port at once
+    if (opt >= &_options[3]) {
+        for (size_t i = 0; i < _ports.count(); i++) {
+            applyLatency(_parsers[i]);
+        }
+    }
+
     return true;
 }
 
@@ -256,15 +375,22 @@ bool G5500Device::getOptionValue(const char* name, char* buffer, size_t bufLen)
 
 size_t G5500Device::serializeOptions(uint8_t* buffer, size_t bufLen) const {
     // Format: [baud_index (1 byte)][az_speed (1 byte)][el_speed (1 byte)]
-    if (bufLen < 3) {
+    //         [read_latency, read_jitter, set_latency, set_jitter
+    //          (2 bytes each, little-endian)]
+    if (bufLen < 11) {
         return 0;
     }
 
     buffer[0] = _options[0].value.enumVal.current;  // Baud rate index
     buffer[1] = (uint8_t)_options[1].value.uint32Val.current;  // Azimuth speed
     buffer[2] = (uint8_t)_options[2].value.uint32Val.current;  // Elevation speed
+    for (size_t i = 0; i < 4; i++) {
+        uint32_t ms = _options[3 + i].value.uint32Val.current;  // Latency
+        buffer[3 + 2 * i] = (uint8_t)(ms & 0xFF);
+        buffer[4 + 2 * i] = (uint8_t)(ms >> 8);
+    }
 
-    return 3;
+    return 11;
 }
 
 bool G5500Device::deserializeOptions(const uint8_t* buffer, size_t len) {
@@ -293,6 +419,15 @@ bool G5500Device::deserializeOptions(const uint8_t* buffer, size_t len) {
     }
     _options[2].value.uint32Val.current = elSpeed;
 
+    // Restore latency, none in configurations saved before the options
+    for (size_t i = 0; i < 4; i++) {
+        uint32_t ms = 0;
+        if (len >= 5 + 2 * i) {
+            ms = (uint32_t)buffer[3 + 2 * i] | ((uint32_t)buffer[4 + 2 * i] << 8);
+        }
+        _options[3 + i].value.uint32Val.current = (ms <= REPLY_LATENCY_MAX_MS) ? ms : 0;
+    }
+
     return true;
 }
 
@@ -311,7 +446,9 @@ uint8_t G5500Device::getMeter(MeterType type) const {
 
 void G5500Device::setLogger(ILogger* logger) {
     _logger = logger;
-    _parser.setLogger(logger);
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->setLogger(logger);
+    }
 }
 
 void G5500Device::getStatus(char* buffer, size_t bufLen) const {
@@ -330,19 +467,39 @@ void G5500Device::getStatus(char* buffer, size_t bufLen) const {
         elStatus = _state.elGotoMode ? "goto DOWN" : "DOWN";
     }
 
-    snprintf(buffer, bufLen,
+    // Replies over all ports, and the port writes that carried them
+    unsigned long replies = 0;
+    unsigned long writes = 0;
+    unsigned long delayed = 0;
+    unsigned long maxLateUs = 0;
+    for (size_t i = 0; i < _ports.count(); i++) {
+        replies += _parsers[i]->getReplyStats().replies;
+        writes += _parsers[i]->getReplyStats().writes;
+
+        const ReplyDelayStats& delay = _parsers[i]->getReplyDelay().getStats();
+        delayed += delay.delayed;
+        if (delay.maxLateUs > maxLateUs) {
+            maxLateUs = delay.maxLateUs;
+        }
+    }
+
+    FixedWriter(buffer, bufLen).format(
              "  Azimuth: %d deg (%s)\r\n"
              "  Elevation: %d deg (%s)\r\n"
              "  Target Az: %d deg\r\n"
              "  Target El: %d deg\r\n"
              "  Az Speed: %lu deg/sec\r\n"
-             "  El Speed: %lu deg/sec",
+             "  El Speed: %lu deg/sec\r\n"
+             "  Replies: %lu in %lu writes\r\n"
+             "  Delayed replies: %lu, at most %lu us late",
              _state.getAzimuthInt(), azStatus,
              _state.getElevationInt(), elStatus,
              (int)_state.targetAzimuth,
              (int)_state.targetElevation,
              (unsigned long)_options[1].value.uint32Val.current,
-             (unsigned long)_options[2].value.uint32Val.current);
+             (unsigned long)_options[2].value.uint32Val.current,
+             replies, writes,
+             delayed, maxLateUs);
 }
 
 // === Factory Implementation ===
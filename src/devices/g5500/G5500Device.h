@@ -7,10 +7,11 @@
 #include "ISerialPort.h"
 #include "G5500State.h"
 #include "GS232Parser.h"
+#include "core/SerialFanOut.h"
 #include "platform_config.h"
 
 // Number of configurable options
-#define G5500_OPTION_COUNT 3
+#define G5500_OPTION_COUNT 7
 
 // Yaesu G-5500 Az/El rotator emulator with GS-232 protocol
 class G5500Device : public IEmulatedDevice {
@@ -30,6 +31,12 @@ public:
     void setDeviceId(uint8_t id) override { _deviceId = id; }
     uint8_t getUartIndex() const override { return _uartIndex; }
 
+    // === Ports ===
+    bool attachPort(ISerialPort* serial, uint8_t uartIndex) override;
+    bool detachPort(uint8_t uartIndex) override;
+    size_t getPortCount() const override { return _ports.count(); }
+    uint8_t getPortUart(size_t index) const override { return _ports.getUart(index); }
+
     // === Options ===
     size_t getOptionCount() const override { return G5500_OPTION_COUNT; }
     const DeviceOption* getOption(size_t index) const override;
@@ -48,6 +55,9 @@ public:
     // === Logging ===
     void setLogger(ILogger* logger) override;
 
+    // === Timing ===
+    uint32_t getNextEventUs() const override;
+
     // === Status ===
     bool isRunning() const override { return _running; }
     void getStatus(char* buffer, size_t bufLen) const override;
@@ -59,20 +69,22 @@ public:
     float getElSpeed() const;
 
 private:
-    ISerialPort* _serial;
+    SerialFanOut _ports;     // Every port the rotator is served on
     uint8_t _uartIndex;
     uint8_t _deviceId;
     bool _running;
     ILogger* _logger;
 
     G5500State _state;
-    GS232Parser _parser;
+    GS232Parser* _parsers[DEVICE_MAX_PORTS];  // One per port, same order as _ports
 
     // Options
     DeviceOption _options[G5500_OPTION_COUNT];
 
     void initOptions();
+    uint32_t getBaudRate() const;
     void applyBaudRate();
+    void applyLatency(GS232Parser* parser);
     void simulateRotation();
 };
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "GS232Parser.h"
+#include "core/FixedWriter.h"
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
@@ -12,8 +13,12 @@ GS232Parser::GS232Parser(G5500State& state, ISerialPort& serial)
     , _logger(nullptr)
     , _echo(false)
     , _bufLen(0)
+    , _replies(nullptr)
+    , _arrivalUs(0)
+    , _replied(false)
 {
     memset(_buffer, 0, sizeof(_buffer));
+    memset(&_replyStats, 0, sizeof(_replyStats));
 }
 
 void GS232Parser::reset() {
@@ -21,41 +26,57 @@ void GS232Parser::reset() {
     memset(_buffer, 0, sizeof(_buffer));
 }
 
+// Replies are collected and sent in one write once the input is drained,
+// together with any delayed replies that have come due
 bool GS232Parser::update() {
     bool processed = false;
-
-    while (_serial.available()) {
-        char c = _serial.read();
-
-        // Echo character if enabled
-        if (_echo && _logger) {
-            char echoStr[2] = {c, '\0'};
-            if (c == GS232_CR) {
-                _logger->logf(LogLevel::DEBUG, "G5500", "<CR>");
-            } else if (c == GS232_LF) {
-                _logger->logf(LogLevel::DEBUG, "G5500", "<LF>");
-            } else if (c >= 32 && c < 127) {
-                _logger->logf(LogLevel::DEBUG, "G5500", "RX: %s", echoStr);
+    uint8_t chunk[SERIAL_RX_CHUNK_SIZE];
+    size_t count;
+
+    char staged[REPLY_BATCH_SIZE];
+    ReplyBatch replies(_serial, staged, sizeof(staged), _replyStats);
+    _replies = &replies;
+
+    _arrivalUs = micros();
+    _delay.release(replies, _arrivalUs, (size_t)_serial.availableForWrite());
+
+    while ((count = _serial.readAvailable(chunk, sizeof(chunk))) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            char c = (char)chunk[i];
+
+            // Echo character if enabled
+            if (_echo && _logger) {
+                char echoStr[2] = {c, '\0'};
+                if (c == GS232_CR) {
+                    _logger->logf(LogLevel::DEBUG, "G5500", "<CR>");
+                } else if (c == GS232_LF) {
+                    _logger->logf(LogLevel::DEBUG, "G5500", "<LF>");
+                } else if (c >= 32 && c < 127) {
+                    _logger->logf(LogLevel::DEBUG, "G5500", "RX: %s", echoStr);
+                }
             }
-        }
 
-        // GS-232 uses CR as command terminator
-        if (c == GS232_CR || c == GS232_LF) {
-            if (_bufLen > 0) {
-                _buffer[_bufLen] = '\0';
-                processCommand();
-                _bufLen = 0;
-                processed = true;
+            // GS-232 uses CR as command terminator
+            if (c == GS232_CR || c == GS232_LF) {
+                if (_bufLen > 0) {
+                    _buffer[_bufLen] = '\0';
+                    processCommand();
+                    _bufLen = 0;
+                    processed = true;
+                }
+                continue;
             }
-            continue;
-        }
 
-        // Add character to buffer (convert to uppercase)
-        if (_bufLen < CAT_BUFFER_SIZE - 1 && c >= 32 && c < 127) {
-            _buffer[_bufLen++] = toupper(c);
+            // Add character to buffer (convert to uppercase)
+            if (_bufLen < CAT_BUFFER_SIZE - 1 && c >= 32 && c < 127) {
+                _buffer[_bufLen++] = toupper(c);
+            }
         }
     }
 
+    replies.flush();
+    _replies = nullptr;
+
     return processed;
 }
 
@@ -68,6 +89,7 @@ void GS232Parser::processCommand() {
 
     // Single character commands
     char cmd = _buffer[0];
+    _replied = false;
 
     switch (cmd) {
         case 'R':
@@ -110,14 +132,26 @@ void GS232Parser::processCommand() {
             }
             break;
     }
+
+    if (!_replied && _delay.isEnabled()) {
+        _delay.hold(ReplyClass::SET, _arrivalUs);
+    }
 }
 
-void GS232Parser::sendResponse(const char* response) {
-    _serial.print(response);
-    _serial.print("\r\n");
+void GS232Parser::sendResponse(FixedWriter& response) {
+    size_t len = response.length();
+    response.put("\r\n");
+    _replied = true;
+    if (_delay.isEnabled()) {
+        _delay.add(ReplyClass::READ, response.c_str(), response.length(), _arrivalUs);
+    } else if (_replies != nullptr) {
+        _replies->add(response.c_str(), response.length());
+    } else {
+        _serial.write((const uint8_t*)response.c_str(), response.length());
+    }
 
     if (_echo && _logger) {
-        _logger->logf(LogLevel::DEBUG, "G5500", "TX: %s", response);
+        _logger->logf(LogLevel::DEBUG, "G5500", "TX: %.*s", (int)len, response.c_str());
     }
 }
 
@@ -179,26 +213,27 @@ void GS232Parser::handleS() {
 
 // C - Read azimuth, C2 - Read azimuth and elevation
 void GS232Parser::handleC() {
-    char response[32];
+    char buf[32];
+    FixedWriter rsp(buf, sizeof(buf));
+
+    // Response format: +0xxx (azimuth only)
+    rsp.put("+0").digits<3>((uint16_t)_state.getAzimuthInt());
 
     // Check for C2 command (read both az and el)
     if (_bufLen >= 2 && _buffer[1] == '2') {
         // Response format: +0xxx +0xxx (azimuth elevation)
-        snprintf(response, sizeof(response), "+0%03d +0%03d",
-                 _state.getAzimuthInt(), _state.getElevationInt());
-    } else {
-        // Response format: +0xxx (azimuth only)
-        snprintf(response, sizeof(response), "+0%03d", _state.getAzimuthInt());
+        rsp.put(" +0").digits<3>((uint16_t)_state.getElevationInt());
     }
 
-    sendResponse(response);
+    sendResponse(rsp);
 }
 
 // B - Read elevation
 void GS232Parser::handleB() {
-    char response[16];
-    snprintf(response, sizeof(response), "+0%03d", _state.getElevationInt());
-    sendResponse(response);
+    char buf[16];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("+0").digits<3>((uint16_t)_state.getElevationInt());
+    sendResponse(rsp);
 }
 
 // M - Move to azimuth (Mxxx where xxx is 000-450)
@@ -8,6 +8,10 @@
 #include "G5500State.h"
 #include "ISerialPort.h"
 #include "ILogger.h"
+#include "core/ReplyBatch.h"
+#include "core/ReplyDelay.h"
+
+class FixedWriter;
 
 // GS-232 command terminators
 #define GS232_CR '\r'
@@ -28,6 +32,16 @@ public:
     // Reset input buffer
     void reset();
 
+    // Replies sent and the port writes that carried them
+    const ReplyStats& getReplyStats() const { return _replyStats; }
+
+    // Response latency: position reads wait ReplyClass::READ latency,
+    // rotation commands keep the controller busy for ReplyClass::SET
+    void setLatency(ReplyClass cls, uint16_t latencyMs, uint16_t jitterMs) {
+        _delay.setLatency(cls, latencyMs, jitterMs);
+    }
+    const ReplyDelay& getReplyDelay() const { return _delay; }
+
 private:
     G5500State& _state;
     ISerialPort& _serial;
@@ -37,11 +51,20 @@ private:
     char _buffer[CAT_BUFFER_SIZE];
     size_t _bufLen;
 
+    // Replies to the burst being processed (only set during update())
+    ReplyBatch* _replies;
+    ReplyStats _replyStats;
+
+    // Replies waiting for their latency
+    ReplyDelay _delay;
+    uint32_t _arrivalUs;         // micros() when the input burst was read
+    bool _replied;               // The current command sent a reply
+
     // Process a complete command line
     void processCommand();
 
-    // Send response string (with CR LF terminator)
-    void sendResponse(const char* response);
+    // Queue a response (CR LF is appended)
+    void sendResponse(FixedWriter& response);
 
     // Command handlers
     void handleR();                      // Rotate CW (right)
@@ -0,0 +1,357 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "CIVBus.h"
+#include <string.h>
+
+static_assert(CIV_REPLY_MAX <= REPLY_BATCH_SIZE, "A CI-V reply must fit in a reply batch");
+static_assert(CIV_FRAME_MAX <= 255, "CIVFrame lengths are 8-bit");
+
+static const uint8_t JAMMER[CIV_JAM_LEN] = {CIV_JAM, CIV_JAM, CIV_JAM};
+
+CIVBus* CIVBus::_buses[PLATFORM_MAX_UARTS] = {};
+
+CIVBus::CIVBus(ISerialPort& port)
+    : _port(port)
+    , _nodeCount(0)
+    , _open(false)
+    , _baud(0)
+    , _lineUs(0)
+    , _lineAtUs(0)
+    , _rxState(RxState::IDLE)
+    , _carryLen(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+    memset(&_replyStats, 0, sizeof(_replyStats));
+}
+
+CIVBus* CIVBus::join(ISerialPort* port, CIVNode* node) {
+    if (port == nullptr) {
+        return nullptr;
+    }
+
+    CIVBus* bus = nullptr;
+    size_t freeSlot = PLATFORM_MAX_UARTS;
+    for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        if (_buses[i] != nullptr && &_buses[i]->_port == port) {
+            bus = _buses[i];
+            break;
+        }
+        if (_buses[i] == nullptr && freeSlot == PLATFORM_MAX_UARTS) {
+            freeSlot = i;
+        }
+    }
+
+    if (bus == nullptr) {
+        if (freeSlot == PLATFORM_MAX_UARTS) {
+            return nullptr;
+        }
+        bus = new CIVBus(*port);
+        _buses[freeSlot] = bus;
+    }
+
+    if (bus->_nodeCount >= CIV_BUS_MAX_RADIOS) {
+        return nullptr;
+    }
+    bus->_nodes[bus->_nodeCount++] = node;
+    return bus;
+}
+
+void CIVBus::leave(CIVBus* bus, CIVNode* node) {
+    if (bus == nullptr) {
+        return;
+    }
+
+    for (size_t i = 0; i < bus->_nodeCount; i++) {
+        if (bus->_nodes[i] == node) {
+            for (size_t j = i; j + 1 < bus->_nodeCount; j++) {
+                bus->_nodes[j] = bus->_nodes[j + 1];
+            }
+            bus->_nodeCount--;
+            break;
+        }
+    }
+
+    if (bus->_nodeCount > 0) {
+        return;
+    }
+    for (size_t i = 0; i < PLATFORM_MAX_UARTS; i++) {
+        if (_buses[i] == bus) {
+            _buses[i] = nullptr;
+        }
+    }
+    if (bus->_open) {
+        bus->_port.end();
+    }
+    delete bus;
+}
+
+void CIVBus::start(uint32_t baud) {
+    if (_open && baud == _baud) {
+        return;
+    }
+    if (_open) {
+        _port.end();
+    }
+    _port.begin(baud);
+    _open = true;
+    _baud = baud;
+    _lineUs = 0;
+    _lineAtUs = micros();
+    _rxState = RxState::IDLE;
+    _carryLen = 0;
+}
+
+void CIVBus::stop() {
+    if (!_open || isRunning()) {
+        return;
+    }
+    _port.end();
+    _open = false;
+}
+
+bool CIVBus::isRunning() const {
+    for (size_t i = 0; i < _nodeCount; i++) {
+        if (_nodes[i]->isOnBus()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+CIVNode* CIVBus::findNode(uint8_t address, const CIVNode* except) const {
+    for (size_t i = 0; i < _nodeCount; i++) {
+        if (_nodes[i] != except && _nodes[i]->getCivAddress() == address) {
+            return _nodes[i];
+        }
+    }
+    return nullptr;
+}
+
+// Every running radio calls this once per loop; the first one drains the
+// port, so the bus is read once however many radios share it
+void CIVBus::update(const CIVNode* node) {
+    for (size_t i = 0; i < _nodeCount; i++) {
+        if (_nodes[i]->isOnBus()) {
+            if (_nodes[i] != node) {
+                return;
+            }
+            break;
+        }
+    }
+
+    bool echo = false;
+    for (size_t i = 0; i < _nodeCount; i++) {
+        if (_nodes[i]->isOnBus() && _nodes[i]->wantsEcho()) {
+            echo = true;
+            break;
+        }
+    }
+
+    uint8_t chunk[SERIAL_RX_CHUNK_SIZE];
+    size_t count;
+
+    // Bring the line budget up to date before echo and replies spend it
+    refill(micros());
+
+    char staged[REPLY_BATCH_SIZE];
+    ReplyBatch replies(_port, staged, sizeof(staged), _replyStats);
+
+    while ((count = _port.readAvailable(chunk, sizeof(chunk))) > 0) {
+        // The controller hears its own bytes before any reply to them
+        if (echo) {
+            replies.flush();
+            _port.write(chunk, count);
+            spend(count);
+        }
+        receive(chunk, count, replies);
+    }
+
+    replies.flush();
+}
+
+void CIVBus::receive(const uint8_t* data, size_t count, ReplyBatch& out) {
+    size_t start = 0;  // Where the frame body starts in data (FRAME state)
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t b = data[i];
+
+        switch (_rxState) {
+            case RxState::IDLE:
+                if (b == CIV_PREAMBLE) {
+                    _rxState = RxState::PREAMBLE;
+                }
+                break;
+
+            case RxState::PREAMBLE:
+                if (b == CIV_PREAMBLE) {
+                    _rxState = RxState::FRAME;
+                    _carryLen = 0;
+                    start = i + 1;
+                } else {
+                    _rxState = RxState::IDLE;
+                }
+                break;
+
+            case RxState::FRAME:
+                if (b == CIV_PREAMBLE && i == start && _carryLen == 0) {
+                    start = i + 1;  // Extra preamble byte
+                } else if (b == CIV_JAM) {
+                    // Another station jammed this frame
+                    _stats.dropped++;
+                    _rxState = RxState::DISCARD;
+                } else if (b == CIV_END) {
+                    _rxState = RxState::IDLE;
+                    bool busy = (i + 1 < count);
+                    if (_carryLen == 0) {
+                        dispatch(data + start, i - start, busy, out);
+                    } else if (carry(data + start, i - start)) {
+                        dispatch(_carry, _carryLen, busy, out);
+                    }
+                    _carryLen = 0;
+                }
+                break;
+
+            case RxState::DISCARD:
+                if (b == CIV_END) {
+                    _rxState = RxState::IDLE;
+                }
+                break;
+        }
+    }
+
+    // Keep the start of a frame that continues in the next read
+    if (_rxState == RxState::FRAME && !carry(data + start, count - start)) {
+        _rxState = RxState::DISCARD;
+    }
+}
+
+bool CIVBus::carry(const uint8_t* data, size_t len) {
+    if (_carryLen + len > sizeof(_carry)) {
+        _stats.dropped++;
+        _carryLen = 0;
+        return false;
+    }
+    memcpy(_carry + _carryLen, data, len);
+    _carryLen += len;
+    return true;
+}
+
+void CIVBus::dispatch(const uint8_t* body, size_t len, bool busy, ReplyBatch& out) {
+    if (len < 3 || len > CIV_FRAME_MAX) {
+        _stats.dropped++;
+        return;
+    }
+
+    CIVFrame frame;
+    frame.to = body[0];
+    frame.from = body[1];
+    frame.cmd = body[2];
+    frame.data = body + 3;
+    frame.len = (uint8_t)(len - 3);
+    _stats.frames++;
+
+    // Address 00 reaches every radio, and none of them answers
+    if (frame.to == CIV_BROADCAST) {
+        for (size_t i = 0; i < _nodeCount; i++) {
+            if (_nodes[i]->isOnBus()) {
+                CIVWriter none(nullptr, 0, frame.from, frame.to);
+                _nodes[i]->handleFrame(frame, none);
+            }
+        }
+        return;
+    }
+
+    CIVNode* node = findNode(frame.to);
+    if (node == nullptr || !node->isOnBus()) {
+        _stats.unclaimed++;
+        return;
+    }
+
+    uint8_t* space = (uint8_t*)out.reserve(CIV_REPLY_MAX);
+    CIVWriter reply(space, CIV_REPLY_MAX, frame.from, frame.to);
+    node->handleFrame(frame, reply);
+    if (reply.isEmpty()) {
+        return;
+    }
+
+    // The controller started its next frame before the reply: both are
+    // lost, and the radio sends the jammer in place of its reply
+    if (busy || _port.available() > 0) {
+        _stats.collisions++;
+        memcpy(space, JAMMER, sizeof(JAMMER));
+        out.commit(sizeof(JAMMER));
+        spend(sizeof(JAMMER));
+        _rxState = RxState::DISCARD;
+        return;
+    }
+    size_t replyLen = reply.finish();
+    out.commit(replyLen);
+    spend(replyLen);
+}
+
+bool CIVBus::transmit(const uint8_t* frame, size_t len) {
+    if (!_open) {
+        return true;  // Nobody to hear it
+    }
+
+    // The controller is mid-frame or has more on the way
+    if (isBusy()) {
+        _stats.collisions++;
+        _port.write(JAMMER, sizeof(JAMMER));
+        spend(sizeof(JAMMER));
+        _rxState = RxState::DISCARD;
+        return false;
+    }
+
+    _port.write(frame, len);
+    spend(len);
+    _stats.broadcasts++;
+    return true;
+}
+
+bool CIVBus::stream(const uint8_t* frame, size_t len, uint32_t nowUs) {
+    if (!_open) {
+        return false;
+    }
+
+    refill(nowUs);
+
+    // Streamed frames give way to the controller instead of jamming it
+    if (_lineUs < (int32_t)lineTimeUs(len) || isBusy()) {
+        return false;
+    }
+
+    _port.write(frame, len);
+    spend(len);
+    return true;
+}
+
+// Time passed is line time; an idle line saves up no more than one
+// frame's worth, so a stream never bursts past the baud rate
+void CIVBus::refill(uint32_t nowUs) {
+    uint32_t elapsedUs = nowUs - _lineAtUs;
+    _lineAtUs = nowUs;
+    if (elapsedUs > 1000000UL) {
+        elapsedUs = 1000000UL;
+    }
+
+    int32_t burstUs = (int32_t)lineTimeUs(CIV_FRAME_MAX);
+    _lineUs += (int32_t)elapsedUs;
+    if (_lineUs > burstUs) {
+        _lineUs = burstUs;
+    }
+}
+
+bool CIVBus::isBusy() {
+    return _rxState == RxState::PREAMBLE || _rxState == RxState::FRAME ||
+           _port.available() > 0;
+}
+
+// 8N1: ten bits on the line per byte
+uint32_t CIVBus::lineTimeUs(size_t len) const {
+    if (_baud < 10) {
+        return 0;
+    }
+    return (uint32_t)len * 1000000UL / (_baud / 10);
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "ISerialPort.h"
+#include "platform_config.h"
+#include "core/ReplyBatch.h"
+#include "CIVFrame.h"
+
+// A radio on a CI-V bus
+class CIVNode {
+public:
+    virtual ~CIVNode() = default;
+
+    // Current CI-V address (an option, so it may change while on the bus)
+    virtual uint8_t getCivAddress() const = 0;
+
+    // Running radios receive frames; stopped ones stay silent
+    virtual bool isOnBus() const = 0;
+
+    // True if this radio echoes bus traffic back to the controller
+    virtual bool wantsEcho() const = 0;
+
+    // Carry out a frame addressed to this radio and write the reply (OK,
+    // NG or data) into reply. Broadcast frames come with a reply that has
+    // no buffer, as a radio never answers them.
+    virtual void handleFrame(const CIVFrame& frame, CIVWriter& reply) = 0;
+};
+
+// Traffic counters for one bus
+struct CIVBusStats {
+    uint32_t frames;      // Frames received from the controller
+    uint32_t unclaimed;   // Frames for an address no radio on the bus has
+    uint32_t broadcasts;  // Transceive frames sent by radios
+    uint32_t collisions;  // Replies and broadcasts jammed by controller traffic
+    uint32_t dropped;     // Overlong, short or jammed frames discarded
+};
+
+// CI-V multi-drop bus on one UART
+// CI-V is a single-wire open-collector bus: every station hears every
+// byte, including its own, and frames carry the addresses of the radio and
+// the controller. Several radios therefore share one UART here; the bus
+// reads the port once per loop and hands each frame to the radio it is
+// addressed to, or to all of them for address 00.
+//
+// Frames are parsed in place in the receive chunk and handed over as a
+// CIVFrame pointing into it; only a frame split across two reads is
+// copied, into a carry buffer. Replies are built in place in a ReplyBatch
+// reservation and sent in one write per burst.
+//
+// Bus behaviour the radios emulate:
+// - Echo: with CI-V echo on, the controller hears its own bytes back, as
+//   on the real single-wire bus.
+// - Collisions: a radio that has to transmit while the controller is
+//   sending (more input already waiting) sends the jammer FC FC FC instead,
+//   and the controller's frame it ran into is discarded. Controllers
+//   detect the jammer and repeat the command.
+// - Transceive: radios send unsolicited frequency and mode frames to
+//   address 00; one that collides is jammed and retried later.
+// - Streaming: scope waveform frames are paced at the bus baud rate and
+//   wait for the controller to finish, so a stream runs at the line's
+//   real capacity whatever the port underneath can take.
+class CIVBus {
+public:
+    // The bus on port, created for the first radio to join; radios created
+    // on the same UART get the same port, and so the same bus. Returns
+    // nullptr if the bus is full.
+    static CIVBus* join(ISerialPort* port, CIVNode* node);
+
+    // Remove a radio; the bus is deleted with its last radio
+    static void leave(CIVBus* bus, CIVNode* node);
+
+    // A radio started: opens the port at baud, or reopens it if the radio
+    // uses another rate (the last radio started or configured sets it)
+    void start(uint32_t baud);
+
+    // A radio stopped: closes the port once no radio on it is running
+    void stop();
+
+    // Receive controller frames and answer them; call from every radio's
+    // update(), only the first running radio's call does the work
+    void update(const CIVNode* node);
+
+    // Send an unsolicited frame. Returns false if controller traffic was
+    // on the bus: the jammer is sent instead, and the caller retries later.
+    bool transmit(const uint8_t* frame, size_t len);
+
+    // Send a streamed frame if the line is free for it: the controller is
+    // not sending, and everything sent before has had its time on the
+    // line at the bus baud rate. Returns false, sending nothing, otherwise.
+    bool stream(const uint8_t* frame, size_t len, uint32_t nowUs);
+
+    // The radio with address, other than except, or nullptr
+    CIVNode* findNode(uint8_t address, const CIVNode* except = nullptr) const;
+
+    size_t getNodeCount() const { return _nodeCount; }
+    const CIVBusStats& getStats() const { return _stats; }
+    const ReplyStats& getReplyStats() const { return _replyStats; }
+
+private:
+    enum class RxState : uint8_t {
+        IDLE,       // Waiting for the first FE
+        PREAMBLE,   // One FE seen
+        FRAME,      // Inside a frame, waiting for FD
+        DISCARD     // Skipping a broken frame up to its FD
+    };
+
+    ISerialPort& _port;
+    CIVNode* _nodes[CIV_BUS_MAX_RADIOS];
+    size_t _nodeCount;
+    bool _open;
+    uint32_t _baud;
+
+    // Line time budget for streamed frames (us): grows with the clock up
+    // to one frame's time, and every byte sent spends its character time
+    int32_t _lineUs;
+    uint32_t _lineAtUs;
+
+    RxState _rxState;
+    uint8_t _carry[CIV_FRAME_MAX];  // Start of a frame split across reads
+    size_t _carryLen;
+
+    CIVBusStats _stats;
+    ReplyStats _replyStats;
+
+    static CIVBus* _buses[PLATFORM_MAX_UARTS];
+
+    explicit CIVBus(ISerialPort& port);
+
+    // True if any radio on the bus is running
+    bool isRunning() const;
+
+    // True while the controller is sending: mid-frame or more input waiting
+    bool isBusy();
+
+    // Time len characters take on the line at the bus baud rate (us)
+    uint32_t lineTimeUs(size_t len) const;
+
+    // Add the line time passed since the last refill to the budget
+    void refill(uint32_t nowUs);
+
+    // Charge bytes sent on the line to the streaming budget
+    void spend(size_t len) { _lineUs -= (int32_t)lineTimeUs(len); }
+
+    // Parse one chunk of input, dispatching every complete frame
+    void receive(const uint8_t* data, size_t count, ReplyBatch& out);
+
+    // Carry a frame body over to the next read; false if it is too long
+    bool carry(const uint8_t* data, size_t len);
+
+    // Dispatch one frame body (to, from, cmd, data); busy is true if the
+    // controller is already sending more
+    void dispatch(const uint8_t* body, size_t len, bool busy, ReplyBatch& out);
+
+    // Not copyable
+    CIVBus(const CIVBus&);
+    CIVBus& operator=(const CIVBus&);
+};
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// CI-V framing bytes
+#define CIV_PREAMBLE 0xFE
+#define CIV_END 0xFD
+#define CIV_JAM 0xFC          // Sent by a station that detects a collision
+#define CIV_OK 0xFB
+#define CIV_NG 0xFA
+
+// Well-known addresses
+#define CIV_BROADCAST 0x00    // Every radio, which never replies
+#define CIV_CONTROLLER 0xE0   // Default controller (PC) address
+#define CIV_ADDRESS_MAX 0xDF  // Highest radio address
+
+// Longest frame body (to, from, cmd and data) accepted from the bus
+#define CIV_FRAME_MAX 64
+
+// Longest reply or transceive frame a radio sends, preamble to FD
+#define CIV_REPLY_MAX 24
+
+// Jammer length: a station that detects a collision sends FC FC FC
+#define CIV_JAM_LEN 3
+
+// A received frame: FE FE to from cmd data... FD
+// data points into the bus's receive buffer, which is only valid while the
+// frame is being handled; the sub-command, if any, is data[0].
+struct CIVFrame {
+    uint8_t to;
+    uint8_t from;
+    uint8_t cmd;
+    const uint8_t* data;
+    uint8_t len;
+};
+
+// Builds one CI-V frame in a caller-owned buffer (a ReplyBatch
+// reservation), preamble and addresses first. Nothing is written without a
+// buffer, so a broadcast command runs the same handler with its reply
+// discarded. Output that does not fit is dropped and finish() returns 0.
+class CIVWriter {
+public:
+    CIVWriter(uint8_t* buffer, size_t size, uint8_t to, uint8_t from)
+        : _buf(buffer)
+        , _size(size)
+        , _len(0)
+        , _overflow(false)
+    {
+        put(CIV_PREAMBLE).put(CIV_PREAMBLE).put(to).put(from);
+    }
+
+    CIVWriter& put(uint8_t b) {
+        if (_buf == nullptr || _len >= _size) {
+            _overflow = true;
+            return *this;
+        }
+        _buf[_len++] = b;
+        return *this;
+    }
+
+    // value as 2 * bytes BCD digits, most significant byte first
+    // (levels and meters: 0-255 is 00 00 to 02 55)
+    CIVWriter& bcd(uint32_t value, uint8_t bytes) {
+        uint8_t packed[5];
+        for (uint8_t i = bytes; i > 0; i--) {
+            packed[i - 1] = toBCD(value);
+            value /= 100;
+        }
+        for (uint8_t i = 0; i < bytes; i++) {
+            put(packed[i]);
+        }
+        return *this;
+    }
+
+    // Frequency in Hz as 10 BCD digits, least significant byte first
+    CIVWriter& freq(uint32_t hz) {
+        for (uint8_t i = 0; i < 5; i++) {
+            put(toBCD(hz));
+            hz /= 100;
+        }
+        return *this;
+    }
+
+    // Nothing written yet past the header (the handler did not reply)
+    bool isEmpty() const { return _len <= 4; }
+
+    // Append FD and return the frame length, 0 if there was no buffer or
+    // the frame did not fit
+    size_t finish() {
+        put(CIV_END);
+        return _overflow ? 0 : _len;
+    }
+
+    // Two decimal digits packed in one byte
+    static uint8_t toBCD(uint32_t value) {
+        uint8_t low = (uint8_t)(value % 100);
+        return (uint8_t)(((low / 10) << 4) | (low % 10));
+    }
+
+    // Decode bytes of BCD, most significant first; false on a non-decimal nibble
+    static bool fromBCD(const uint8_t* data, uint8_t bytes, uint32_t& value) {
+        uint32_t result = 0;
+        for (uint8_t i = 0; i < bytes; i++) {
+            uint8_t hi = data[i] >> 4;
+            uint8_t lo = data[i] & 0x0F;
+            if (hi > 9 || lo > 9) {
+                return false;
+            }
+            result = result * 100 + hi * 10 + lo;
+        }
+        value = result;
+        return true;
+    }
+
+    // Decode a 5-byte frequency, least significant byte first
+    static bool freqFromBCD(const uint8_t* data, uint32_t& hz) {
+        uint8_t reversed[5];
+        for (uint8_t i = 0; i < 5; i++) {
+            reversed[i] = data[4 - i];
+        }
+        uint32_t result;
+        // 10 digits can exceed 32 bits; radios here stop well below 4 GHz
+        if (reversed[0] >= 0x40 || !fromBCD(reversed, 5, result)) {
+            return false;
+        }
+        hz = result;
+        return true;
+    }
+
+private:
+    uint8_t* _buf;
+    size_t _size;
+    size_t _len;
+    bool _overflow;
+};
@@ -0,0 +1,895 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "IcomDevice.h"
+#include <string.h>
+#include "core/FixedWriter.h"
+
+// Table entry for a command without a sub-command
+#define ICOM_NO_SUB 0xFF
+
+// Mode code n supported: bit n
+#define MODE_BIT(m) (1UL << (uint8_t)(IcomMode::m))
+#define HF_MODES (MODE_BIT(LSB) | MODE_BIT(USB) | MODE_BIT(AM) | MODE_BIT(CW) | \
+                  MODE_BIT(RTTY) | MODE_BIT(FM) | MODE_BIT(CW_R) | MODE_BIT(RTTY_R))
+
+// IC-7300: HF/6m/4m, receive coverage 30 kHz to 74.8 MHz
+const IcomModel ICOM_IC7300 = {
+    "ic-7300",
+    "Icom IC-7300 (CI-V)",
+    0x94,
+    14074000UL,
+    {{30000UL, 74800000UL}, {0, 0}, {0, 0}},
+    HF_MODES,
+    false
+};
+
+// IC-9700: 2m/70cm/23cm with D-STAR, Main and Sub bands
+const IcomModel ICOM_IC9700 = {
+    "ic-9700",
+    "Icom IC-9700 (CI-V)",
+    0xA2,
+    144174000UL,
+    {{144000000UL, 148000000UL}, {430000000UL, 450000000UL}, {1240000000UL, 1300000000UL}},
+    HF_MODES | MODE_BIT(DV),
+    true
+};
+
+// Baud rate options (CI-V Baud Rate menu)
+static const char* BAUD_RATE_OPTIONS[] = {"4800", "9600", "19200", "38400", "57600", "115200"};
+static const uint32_t BAUD_RATE_VALUES[] = {4800, 9600, 19200, 38400, 57600, 115200};
+static const size_t NUM_BAUD_RATES = 6;
+static const uint8_t DEFAULT_BAUD_INDEX = 2;  // 19200 baud default
+
+// Scope sweep speeds (27 1A): fast, mid, slow
+static const uint8_t SCOPE_SPEED_FPS[] = {30, 20, 10};
+static const size_t NUM_SCOPE_SPEEDS = 3;
+
+// Command table, searched in order; commands with sub-commands have a row
+// per sub-command
+const IcomDevice::Command IcomDevice::COMMANDS[] PROGMEM = {
+    {0x00, ICOM_NO_SUB, &IcomDevice::setFreq},     // Frequency, no reply (transceive form)
+    {0x01, ICOM_NO_SUB, &IcomDevice::setMode},     // Mode, no reply (transceive form)
+    {0x03, ICOM_NO_SUB, &IcomDevice::readFreq},
+    {0x04, ICOM_NO_SUB, &IcomDevice::readMode},
+    {0x05, ICOM_NO_SUB, &IcomDevice::setFreq},
+    {0x06, ICOM_NO_SUB, &IcomDevice::setMode},
+    {0x07, ICOM_NO_SUB, &IcomDevice::selectVfo},
+    {0x0F, ICOM_NO_SUB, &IcomDevice::splitOnOff},
+    {0x14, 0x01, &IcomDevice::level},              // AF gain
+    {0x14, 0x02, &IcomDevice::level},              // RF gain
+    {0x14, 0x03, &IcomDevice::level},              // Squelch
+    {0x14, 0x0A, &IcomDevice::level},              // RF power
+    {0x15, 0x02, &IcomDevice::meter},              // S-meter
+    {0x15, 0x11, &IcomDevice::meter},              // Po
+    {0x15, 0x12, &IcomDevice::meter},              // SWR
+    {0x15, 0x13, &IcomDevice::meter},              // ALC
+    {0x15, 0x14, &IcomDevice::meter},              // COMP
+    {0x19, 0x00, &IcomDevice::readId},
+    {0x1C, 0x00, &IcomDevice::transmit},
+    {0x25, 0x00, &IcomDevice::vfoFreq},            // Selected VFO
+    {0x25, 0x01, &IcomDevice::vfoFreq},            // Unselected VFO
+    {0x26, 0x00, &IcomDevice::vfoMode},
+    {0x26, 0x01, &IcomDevice::vfoMode},
+    {0x27, 0x10, &IcomDevice::scopeSwitch},        // Scope off/on
+    {0x27, 0x11, &IcomDevice::scopeSwitch},        // Waveform data output off/on
+    {0x27, 0x14, &IcomDevice::scopeSetting},       // Centre/fixed mode
+    {0x27, 0x15, &IcomDevice::scopeSetting},       // Span
+    {0x27, 0x1A, &IcomDevice::scopeSetting},       // Sweep speed
+};
+
+const size_t IcomDevice::COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+
+// Mode names for status display, by mode code
+static const char* modeName(IcomMode mode) {
+    switch (mode) {
+        case IcomMode::LSB: return "LSB";
+        case IcomMode::USB: return "USB";
+        case IcomMode::AM: return "AM";
+        case IcomMode::CW: return "CW";
+        case IcomMode::RTTY: return "RTTY";
+        case IcomMode::FM: return "FM";
+        case IcomMode::WFM: return "WFM";
+        case IcomMode::CW_R: return "CW-R";
+        case IcomMode::RTTY_R: return "RTTY-R";
+        case IcomMode::DV: return "DV";
+        default: return "?";
+    }
+}
+
+IcomDevice::IcomDevice(ISerialPort* serial, uint8_t uartIndex, const IcomModel& model)
+    : _model(model)
+    , _bus(nullptr)
+    , _uartIndex(uartIndex)
+    , _deviceId(0xFF)
+    , _running(false)
+    , _logger(nullptr)
+    , _pending(0)
+    , _retryMs(0)
+    , _backoff(false)
+    , _controller(CIV_CONTROLLER)
+    , _scopeOn(true)
+{
+    _state.reset(_model.defaultFreq);
+    initOptions();
+
+    // Radios already on the bus keep their addresses; take the next free one
+    _bus = CIVBus::join(serial, this);
+    if (_bus != nullptr) {
+        uint32_t address = _model.address;
+        while (_bus->findNode((uint8_t)address, this) != nullptr) {
+            address = (address >= CIV_ADDRESS_MAX) ? 1 : address + 1;
+            if (address == _model.address) {
+                break;  // Bus full of addresses; cannot happen with CIV_BUS_MAX_RADIOS
+            }
+        }
+        _options[1].value.uint32Val.current = address;
+    }
+}
+
+IcomDevice::~IcomDevice() {
+    if (_running) {
+        end();
+    }
+    CIVBus::leave(_bus, this);
+}
+
+bool IcomDevice::attachPort(ISerialPort* serial, uint8_t uartIndex) {
+    (void)serial;
+    (void)uartIndex;
+    return false;
+}
+
+bool IcomDevice::detachPort(uint8_t uartIndex) {
+    (void)uartIndex;
+    return false;
+}
+
+void IcomDevice::initOptions() {
+    // Option 0: Baud rate
+    _options[0] = makeEnumOption(
+        "baud_rate",
+        "Serial baud rate",
+        BAUD_RATE_OPTIONS,
+        NUM_BAUD_RATES,
+        DEFAULT_BAUD_INDEX
+    );
+
+    // Option 1: CI-V address, unique on the bus (set as 148 or 0x94)
+    _options[1] = makeUint32Option(
+        "address",
+        "CI-V address",
+        1,
+        CIV_ADDRESS_MAX,
+        _model.address
+    );
+
+    // Option 2: CI-V Transceive, report front-panel changes to address 00
+    _options[2] = makeBoolOption(
+        "transceive",
+        "Broadcast frequency/mode changes",
+        true
+    );
+
+    // Option 3: CI-V echo back, as the single-wire bus does
+    _options[3] = makeBoolOption(
+        "civ_echo",
+        "Echo controller bytes back",
+        true
+    );
+
+    // Option 4: Scope waveform data output to CI-V (27 11)
+    _options[4] = makeBoolOption(
+        "scope",
+        "Stream spectrum scope data",
+        false
+    );
+
+    // Option 5: Scope sweeps per second (27 1A sets 30, 20 or 10)
+    _options[5] = makeUint32Option(
+        "scope_fps",
+        "Scope sweeps per second",
+        ICOM_SCOPE_FPS_MIN,
+        ICOM_SCOPE_FPS_MAX,
+        ICOM_SCOPE_FPS_MAX
+    );
+}
+
+bool IcomDevice::begin() {
+    if (_bus == nullptr) {
+        return false;
+    }
+
+    _state.reset(_model.defaultFreq);
+    _pending = 0;
+    _backoff = false;
+    _scope.reset();
+    _scope.setRate((uint8_t)_options[5].value.uint32Val.current);
+    _scopeOn = true;
+    _running = true;
+    _bus->start(getBaudRate());
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "Icom", "%s at %02Xh started on UART %d at %lu baud",
+                      _model.typeName, getCivAddress(), _uartIndex,
+                      (unsigned long)getBaudRate());
+    }
+    return true;
+}
+
+void IcomDevice::end() {
+    _running = false;
+    if (_bus != nullptr) {
+        _bus->stop();
+    }
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "Icom", "%s at %02Xh stopped on UART %d",
+                      _model.typeName, getCivAddress(), _uartIndex);
+    }
+}
+
+void IcomDevice::update() {
+    if (!_running) {
+        return;
+    }
+
+    // Frames for every radio on the bus are handled in the first radio's
+    // update(), this radio's included
+    _bus->update(this);
+    sendTransceive();
+
+    // Waveform data streams while the scope is on and its output enabled
+    if (_scopeOn && _options[4].value.boolVal) {
+        _scope.update(*_bus, getCivAddress(), _state.freq[_state.selected()], micros());
+    } else {
+        _scope.stop();
+    }
+}
+
+void IcomDevice::sendTransceive() {
+    uint8_t changes = _state.takeChanges();
+    if (!_options[2].value.boolVal) {
+        _pending = 0;
+        return;
+    }
+
+    // Switching VFO changes the operating frequency and mode
+    if (changes & ICOM_CHANGED_VFO) {
+        changes |= ICOM_CHANGED_FREQ | ICOM_CHANGED_MODE;
+    }
+    _pending |= changes & (ICOM_CHANGED_FREQ | ICOM_CHANGED_MODE);
+    if (_pending == 0) {
+        return;
+    }
+
+    uint32_t now = millis();
+    if (_backoff && now - _retryMs < ICOM_TRANSCEIVE_RETRY_MS) {
+        return;
+    }
+    _backoff = false;
+
+    uint8_t frame[CIV_REPLY_MAX];
+    uint8_t vfo = _state.selected();
+
+    if (_pending & ICOM_CHANGED_FREQ) {
+        CIVWriter out(frame, sizeof(frame), CIV_BROADCAST, getCivAddress());
+        out.put(0x00).freq(_state.freq[vfo]);
+        if (!_bus->transmit(frame, out.finish())) {
+            _backoff = true;
+            _retryMs = now;
+            return;
+        }
+        _pending &= ~ICOM_CHANGED_FREQ;
+    }
+
+    if (_pending & ICOM_CHANGED_MODE) {
+        CIVWriter out(frame, sizeof(frame), CIV_BROADCAST, getCivAddress());
+        out.put(0x01).put((uint8_t)_state.mode[vfo]).put(_state.filter[vfo]);
+        if (!_bus->transmit(frame, out.finish())) {
+            _backoff = true;
+            _retryMs = now;
+            return;
+        }
+        _pending &= ~ICOM_CHANGED_MODE;
+    }
+}
+
+bool IcomDevice::tune(uint32_t freqHz) {
+    if (!isInRange(freqHz)) {
+        return false;
+    }
+    _state.set(_state.freq[_state.selected()], freqHz, ICOM_CHANGED_FREQ);
+    return true;
+}
+
+// === CI-V commands ===
+
+void IcomDevice::handleFrame(const CIVFrame& frame, CIVWriter& reply) {
+    // Every station on the bus heard a change made through it; transceive
+    // only reports changes made elsewhere
+    uint8_t external = _state.takeChanges();
+    _controller = frame.from;
+
+    bool found = false;
+    for (size_t i = 0; i < COMMAND_COUNT && !found; i++) {
+        Command row;
+        memcpy_P(&row, &COMMANDS[i], sizeof(row));
+        if (row.cmd != frame.cmd) {
+            continue;
+        }
+        if (row.sub == ICOM_NO_SUB) {
+            (this->*row.handler)(frame.cmd, 0, frame.data, frame.len, reply);
+            found = true;
+        } else if (frame.len > 0 && frame.data[0] == row.sub) {
+            (this->*row.handler)(frame.cmd, row.sub, frame.data + 1, frame.len - 1, reply);
+            found = true;
+        }
+    }
+    if (!found) {
+        reply.put(CIV_NG);
+    }
+
+    _state.changed = external;
+}
+
+// 03: operating frequency
+void IcomDevice::readFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                          CIVWriter& reply) {
+    (void)sub;
+    (void)args;
+    if (len != 0) {
+        reply.put(CIV_NG);
+        return;
+    }
+    reply.put(cmd).freq(_state.freq[_state.selected()]);
+}
+
+// 04: operating mode and filter
+void IcomDevice::readMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                          CIVWriter& reply) {
+    (void)sub;
+    (void)args;
+    if (len != 0) {
+        reply.put(CIV_NG);
+        return;
+    }
+    uint8_t vfo = _state.selected();
+    reply.put(cmd).put((uint8_t)_state.mode[vfo]).put(_state.filter[vfo]);
+}
+
+// 05 (and 00, which is never answered): operating frequency
+void IcomDevice::setFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                         CIVWriter& reply) {
+    (void)sub;
+    uint32_t hz;
+    bool ok = (len == 5 && CIVWriter::freqFromBCD(args, hz) && isInRange(hz));
+    if (ok) {
+        _state.set(_state.freq[_state.selected()], hz, ICOM_CHANGED_FREQ);
+    }
+    if (cmd != 0x00) {
+        reply.put(ok ? CIV_OK : CIV_NG);
+    }
+}
+
+// 06 (and 01, which is never answered): operating mode, optional filter
+void IcomDevice::setMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                         CIVWriter& reply) {
+    (void)sub;
+    uint8_t vfo = _state.selected();
+    bool ok = (len == 1 || len == 2) && isModeSupported(args[0]);
+    uint8_t filter = _state.filter[vfo];
+    if (ok && len == 2) {
+        filter = args[1];
+        ok = (filter >= ICOM_FILTER_MIN && filter <= ICOM_FILTER_MAX);
+    }
+    if (ok) {
+        _state.set(_state.mode[vfo], (IcomMode)args[0], ICOM_CHANGED_MODE);
+        _state.set(_state.filter[vfo], filter, ICOM_CHANGED_MODE);
+    }
+    if (cmd != 0x01) {
+        reply.put(ok ? CIV_OK : CIV_NG);
+    }
+}
+
+// 07: VFO mode, select A/B (or Main/Sub), A=B, swap A/B
+void IcomDevice::selectVfo(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                           CIVWriter& reply) {
+    (void)cmd;
+    (void)sub;
+    if (len == 0) {
+        reply.put(CIV_OK);  // VFO mode: there are no memory channels to leave
+        return;
+    }
+    if (len != 1) {
+        reply.put(CIV_NG);
+        return;
+    }
+
+    switch (args[0]) {
+        case 0x00:
+        case 0x01:
+            _state.set(_state.vfo, args[0], ICOM_CHANGED_VFO);
+            break;
+        case 0xD0:
+        case 0xD1:
+            if (!_model.hasSubBand) {
+                reply.put(CIV_NG);
+                return;
+            }
+            _state.set(_state.vfo, (uint8_t)(args[0] - 0xD0), ICOM_CHANGED_VFO);
+            break;
+        case 0xA0: {
+            // Copy the operating VFO to the other one
+            uint8_t from = _state.selected();
+            uint8_t to = _state.unselected();
+            _state.freq[to] = _state.freq[from];
+            _state.mode[to] = _state.mode[from];
+            _state.filter[to] = _state.filter[from];
+            _state.dataMode[to] = _state.dataMode[from];
+            break;
+        }
+        case 0xB0: {
+            uint32_t freq = _state.freq[0];
+            IcomMode mode = _state.mode[0];
+            uint8_t filter = _state.filter[0];
+            uint8_t data = _state.dataMode[0];
+            _state.freq[0] = _state.freq[1];
+            _state.mode[0] = _state.mode[1];
+            _state.filter[0] = _state.filter[1];
+            _state.dataMode[0] = _state.dataMode[1];
+            _state.freq[1] = freq;
+            _state.mode[1] = mode;
+            _state.filter[1] = filter;
+            _state.dataMode[1] = data;
+            _state.changed |= ICOM_CHANGED_VFO;
+            break;
+        }
+        default:
+            reply.put(CIV_NG);
+            return;
+    }
+    reply.put(CIV_OK);
+}
+
+// 0F: split off/on
+void IcomDevice::splitOnOff(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                            CIVWriter& reply) {
+    (void)sub;
+    if (len == 0) {
+        reply.put(cmd).put(_state.split ? 0x01 : 0x00);
+        return;
+    }
+    if (len != 1 || args[0] > 0x01) {
+        reply.put(CIV_NG);
+        return;
+    }
+    _state.set(_state.split, args[0] == 0x01, ICOM_CHANGED_SPLIT);
+    reply.put(CIV_OK);
+}
+
+// 14 xx: levels, 0000-0255
+void IcomDevice::level(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                       CIVWriter& reply) {
+    uint8_t* field = nullptr;
+    switch (sub) {
+        case 0x01: field = &_state.afGain; break;
+        case 0x02: field = &_state.rfGain; break;
+        case 0x03: field = &_state.squelch; break;
+        case 0x0A: field = &_state.rfPower; break;
+        default: break;
+    }
+    if (field == nullptr) {
+        reply.put(CIV_NG);
+        return;
+    }
+
+    if (len == 0) {
+        reply.put(cmd).put(sub).bcd(*field, 2);
+        return;
+    }
+    uint32_t value;
+    if (len != 2 || !CIVWriter::fromBCD(args, 2, value) || value > 255) {
+        reply.put(CIV_NG);
+        return;
+    }
+    _state.set(*field, (uint8_t)value, ICOM_CHANGED_LEVELS);
+    reply.put(CIV_OK);
+}
+
+// 15 xx: meters, read only
+void IcomDevice::meter(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                       CIVWriter& reply) {
+    (void)args;
+    uint8_t value = 0;
+    switch (sub) {
+        case 0x02: value = _state.smeter; break;
+        case 0x11: value = _state.ptt ? _state.powerMeter : 0; break;
+        case 0x12: value = _state.ptt ? _state.swrMeter : 0; break;
+        case 0x13: value = _state.ptt ? _state.alcMeter : 0; break;
+        case 0x14: value = _state.ptt ? _state.compMeter : 0; break;
+        default: break;
+    }
+    if (len != 0) {
+        reply.put(CIV_NG);
+        return;
+    }
+    reply.put(cmd).put(sub).bcd(value, 2);
+}
+
+// 19 00: transceiver ID, the radio's CI-V address
+void IcomDevice::readId(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                        CIVWriter& reply) {
+    (void)args;
+    if (len != 0) {
+        reply.put(CIV_NG);
+        return;
+    }
+    reply.put(cmd).put(sub).put(getCivAddress());
+}
+
+// 1C 00: receive/transmit
+void IcomDevice::transmit(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                          CIVWriter& reply) {
+    if (len == 0) {
+        reply.put(cmd).put(sub).put(_state.ptt ? 0x01 : 0x00);
+        return;
+    }
+    if (len != 1 || args[0] > 0x01) {
+        reply.put(CIV_NG);
+        return;
+    }
+    _state.set(_state.ptt, args[0] == 0x01, ICOM_CHANGED_PTT);
+    reply.put(CIV_OK);
+}
+
+// 25 00/01: frequency of the selected or unselected VFO
+void IcomDevice::vfoFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                         CIVWriter& reply) {
+    uint8_t vfo = (sub == 0x00) ? _state.selected() : _state.unselected();
+    if (len == 0) {
+        reply.put(cmd).put(sub).freq(_state.freq[vfo]);
+        return;
+    }
+    uint32_t hz;
+    if (len != 5 || !CIVWriter::freqFromBCD(args, hz) || !isInRange(hz)) {
+        reply.put(CIV_NG);
+        return;
+    }
+    _state.set(_state.freq[vfo], hz, ICOM_CHANGED_FREQ);
+    reply.put(CIV_OK);
+}
+
+// 26 00/01: mode, data mode and filter of the selected or unselected VFO
+void IcomDevice::vfoMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                         CIVWriter& reply) {
+    uint8_t vfo = (sub == 0x00) ? _state.selected() : _state.unselected();
+    if (len == 0) {
+        reply.put(cmd).put(sub).put((uint8_t)_state.mode[vfo])
+             .put(_state.dataMode[vfo]).put(_state.filter[vfo]);
+        return;
+    }
+
+    uint8_t data = (len >= 2) ? args[1] : _state.dataMode[vfo];
+    uint8_t filter = (len >= 3) ? args[2] : _state.filter[vfo];
+    if (len > 3 || !isModeSupported(args[0]) || data > 3 ||
+        filter < ICOM_FILTER_MIN || filter > ICOM_FILTER_MAX) {
+        reply.put(CIV_NG);
+        return;
+    }
+    _state.set(_state.mode[vfo], (IcomMode)args[0], ICOM_CHANGED_MODE);
+    _state.set(_state.dataMode[vfo], data, ICOM_CHANGED_MODE);
+    _state.set(_state.filter[vfo], filter, ICOM_CHANGED_MODE);
+    reply.put(CIV_OK);
+}
+
+// 27 10: scope off/on; 27 11: waveform data output off/on, to the
+// controller that turned it on
+void IcomDevice::scopeSwitch(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                             CIVWriter& reply) {
+    bool on = (sub == 0x10) ? _scopeOn : _options[4].value.boolVal;
+    if (len == 0) {
+        reply.put(cmd).put(sub).put(on ? 0x01 : 0x00);
+        return;
+    }
+    if (len != 1 || args[0] > 0x01) {
+        reply.put(CIV_NG);
+        return;
+    }
+
+    if (sub == 0x10) {
+        _scopeOn = (args[0] == 0x01);
+    } else {
+        _options[4].value.boolVal = (args[0] == 0x01);
+        _scope.setDestination(_controller);
+    }
+    reply.put(CIV_OK);
+}
+
+// 27 14/15/1A 00: centre mode, span and sweep speed of the (Main) scope
+void IcomDevice::scopeSetting(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len,
+                              CIVWriter& reply) {
+    if (len == 0 || args[0] != 0x00) {
+        reply.put(CIV_NG);
+        return;
+    }
+    args++;
+    len--;
+
+    bool ok = false;
+    switch (sub) {
+        case 0x14:
+            // Centre mode only: the sweep follows the operating frequency
+            if (len == 0) {
+                reply.put(cmd).put(sub).put(0x00).put(0x00);
+                return;
+            }
+            ok = (len == 1 && args[0] == 0x00);
+            break;
+
+        case 0x15: {
+            if (len == 0) {
+                reply.put(cmd).put(sub).put(0x00).freq(_scope.getSpan());
+                return;
+            }
+            uint32_t span;
+            ok = (len == 5 && CIVWriter::freqFromBCD(args, span) && _scope.setSpan(span));
+            break;
+        }
+
+        case 0x1A: {
+            uint8_t fps = _scope.getRate();
+            if (len == 0) {
+                uint8_t speed = (fps >= 25) ? 0x00 : (fps >= 15) ? 0x01 : 0x02;
+                reply.put(cmd).put(sub).put(0x00).put(speed);
+                return;
+            }
+            ok = (len == 1 && args[0] < NUM_SCOPE_SPEEDS);
+            if (ok) {
+                _options[5].value.uint32Val.current = SCOPE_SPEED_FPS[args[0]];
+                _scope.setRate(SCOPE_SPEED_FPS[args[0]]);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+    reply.put(ok ? CIV_OK : CIV_NG);
+}
+
+bool IcomDevice::isInRange(uint32_t freqHz) const {
+    for (size_t i = 0; i < ICOM_MAX_RANGES; i++) {
+        const IcomRange& range = _model.ranges[i];
+        if (range.maxHz != 0 && freqHz >= range.minHz && freqHz <= range.maxHz) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool IcomDevice::isModeSupported(uint8_t mode) const {
+    return mode < 32 && (_model.modes & (1UL << mode)) != 0;
+}
+
+// === Options ===
+
+uint8_t IcomDevice::getCivAddress() const {
+    return (uint8_t)_options[1].value.uint32Val.current;
+}
+
+uint32_t IcomDevice::getBaudRate() const {
+    uint8_t baudIndex = _options[0].value.enumVal.current;
+    if (baudIndex >= NUM_BAUD_RATES) {
+        baudIndex = DEFAULT_BAUD_INDEX;
+    }
+    return BAUD_RATE_VALUES[baudIndex];
+}
+
+const DeviceOption* IcomDevice::getOption(size_t index) const {
+    if (index >= ICOM_OPTION_COUNT) {
+        return nullptr;
+    }
+    return &_options[index];
+}
+
+DeviceOption* IcomDevice::findOption(const char* name) {
+    for (size_t i = 0; i < ICOM_OPTION_COUNT; i++) {
+        if (strcmp(_options[i].name, name) == 0) {
+            return &_options[i];
+        }
+    }
+    return nullptr;
+}
+
+bool IcomDevice::setOption(const char* name, const char* value) {
+    DeviceOption* opt = findOption(name);
+    if (opt == nullptr) {
+        return false;
+    }
+
+    // Parse into a copy: an address another radio on the bus has is refused
+    DeviceOption parsed = *opt;
+    if (!parseOptionValue(parsed, value)) {
+        return false;
+    }
+    if (opt == &_options[1] && _bus != nullptr &&
+        _bus->findNode((uint8_t)parsed.value.uint32Val.current, this) != nullptr) {
+        if (_logger) {
+            _logger->logf(LogLevel::WARN, "Icom", "Address %02Xh is taken on UART %d",
+                          (unsigned)parsed.value.uint32Val.current, _uartIndex);
+        }
+        return false;
+    }
+    *opt = parsed;
+
+    // Apply baud rate change immediately if running
+    if (opt == &_options[0] && _running) {
+        _bus->start(getBaudRate());
+    }
+    if (opt == &_options[5]) {
+        _scope.setRate((uint8_t)_options[5].value.uint32Val.current);
+    }
+    return true;
+}
+
+bool IcomDevice::getOptionValue(const char* name, char* buffer, size_t bufLen) const {
+    for (size_t i = 0; i < ICOM_OPTION_COUNT; i++) {
+        if (strcmp(_options[i].name, name) == 0) {
+            formatOptionValue(_options[i], buffer, bufLen);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t IcomDevice::serializeOptions(uint8_t* buffer, size_t bufLen) const {
+    // Format: [baud_index (1 byte)][address (1 byte)][transceive (1 byte)]
+    //         [civ_echo (1 byte)][scope (1 byte)][scope_fps (1 byte)]
+    if (bufLen < 6) {
+        return 0;
+    }
+
+    buffer[0] = _options[0].value.enumVal.current;
+    buffer[1] = getCivAddress();
+    buffer[2] = _options[2].value.boolVal ? 1 : 0;
+    buffer[3] = _options[3].value.boolVal ? 1 : 0;
+    buffer[4] = _options[4].value.boolVal ? 1 : 0;
+    buffer[5] = (uint8_t)_options[5].value.uint32Val.current;
+    return 6;
+}
+
+bool IcomDevice::deserializeOptions(const uint8_t* buffer, size_t len) {
+    if (len < 4) {
+        return false;
+    }
+
+    uint8_t baudIndex = buffer[0];
+    if (baudIndex >= NUM_BAUD_RATES) {
+        baudIndex = DEFAULT_BAUD_INDEX;
+    }
+    _options[0].value.enumVal.current = baudIndex;
+
+    // Keep the address given at creation if the stored one is invalid
+    // or taken by another radio on the bus
+    uint8_t address = buffer[1];
+    if (address >= 1 && address <= CIV_ADDRESS_MAX &&
+        (_bus == nullptr || _bus->findNode(address, this) == nullptr)) {
+        _options[1].value.uint32Val.current = address;
+    }
+
+    _options[2].value.boolVal = (buffer[2] != 0);
+    _options[3].value.boolVal = (buffer[3] != 0);
+
+    // Scope settings (absent in configs saved before they existed)
+    _options[4].value.boolVal = (len >= 6) && (buffer[4] != 0);
+    uint8_t fps = (len >= 6) ? buffer[5] : ICOM_SCOPE_FPS_MAX;
+    if (fps < ICOM_SCOPE_FPS_MIN || fps > ICOM_SCOPE_FPS_MAX) {
+        fps = ICOM_SCOPE_FPS_MAX;
+    }
+    _options[5].value.uint32Val.current = fps;
+    _scope.setRate(fps);
+    return true;
+}
+
+// === Meters ===
+
+bool IcomDevice::setMeter(MeterType type, uint8_t value) {
+    switch (type) {
+        case MeterType::SMETER: _state.smeter = value; break;
+        case MeterType::POWER: _state.powerMeter = value; break;
+        case MeterType::SWR: _state.swrMeter = value; break;
+        case MeterType::ALC: _state.alcMeter = value; break;
+        case MeterType::COMPRESSION: _state.compMeter = value; break;
+        default: return false;
+    }
+
+    if (_logger) {
+        _logger->logf(LogLevel::DEBUG, "Icom", "Meter %d set to %d", (int)type, value);
+    }
+    return true;
+}
+
+uint8_t IcomDevice::getMeter(MeterType type) const {
+    switch (type) {
+        case MeterType::SMETER: return _state.smeter;
+        case MeterType::POWER: return _state.powerMeter;
+        case MeterType::SWR: return _state.swrMeter;
+        case MeterType::ALC: return _state.alcMeter;
+        case MeterType::COMPRESSION: return _state.compMeter;
+        default: return 0;
+    }
+}
+
+// === Status ===
+
+void IcomDevice::getStatus(char* buffer, size_t bufLen) const {
+    static const char* const VFO_NAMES[2][2] = {{"VFO A", "VFO B"}, {"Main", "Sub"}};
+    const char* const* names = VFO_NAMES[_model.hasSubBand ? 1 : 0];
+
+    // Frequencies as MHz.kHz.Hz
+    unsigned long mhz[2], khz[2], hz[2];
+    for (size_t i = 0; i < 2; i++) {
+        mhz[i] = (unsigned long)(_state.freq[i] / 1000000UL);
+        khz[i] = (unsigned long)((_state.freq[i] / 1000UL) % 1000UL);
+        hz[i] = (unsigned long)(_state.freq[i] % 1000UL);
+    }
+
+    CIVBusStats bus;
+    ReplyStats replies;
+    size_t radios = 0;
+    memset(&bus, 0, sizeof(bus));
+    memset(&replies, 0, sizeof(replies));
+    if (_bus != nullptr) {
+        bus = _bus->getStats();
+        replies = _bus->getReplyStats();
+        radios = _bus->getNodeCount();
+    }
+
+    const IcomScopeStats& scope = _scope.getStats();
+    const char* scopeState = !_scopeOn ? "off"
+                           : _options[4].value.boolVal ? "streaming" : "on, output off";
+
+    FixedWriter(buffer, bufLen).format(
+             "  CI-V address: %02Xh, %u radio%s on the bus\r\n"
+             "  %s: %lu.%03lu.%03lu %s FIL%u%s\r\n"
+             "  %s: %lu.%03lu.%03lu %s FIL%u%s\r\n"
+             "  PTT: %s, Split: %s\r\n"
+             "  Transceive: %s, Echo: %s\r\n"
+             "  Bus frames: %lu, unclaimed %lu, dropped %lu\r\n"
+             "  Collisions: %lu, transceive frames %lu\r\n"
+             "  Replies: %lu in %lu writes\r\n"
+             "  Scope: %s, span +/-%lu Hz, %u sweeps/s set, %u sent\r\n"
+             "  Scope sweeps: %lu in %lu frames, %lu dropped",
+             getCivAddress(), (unsigned)radios, (radios == 1) ? "" : "s",
+             names[0], mhz[0], khz[0], hz[0], modeName(_state.mode[0]),
+             (unsigned)_state.filter[0], (_state.vfo == 0) ? " (selected)" : "",
+             names[1], mhz[1], khz[1], hz[1], modeName(_state.mode[1]),
+             (unsigned)_state.filter[1], (_state.vfo == 1) ? " (selected)" : "",
+             _state.ptt ? "TX" : "RX", _state.split ? "on" : "off",
+             _options[2].value.boolVal ? "on" : "off",
+             _options[3].value.boolVal ? "on" : "off",
+             (unsigned long)bus.frames, (unsigned long)bus.unclaimed,
+             (unsigned long)bus.dropped,
+             (unsigned long)bus.collisions, (unsigned long)bus.broadcasts,
+             (unsigned long)replies.replies, (unsigned long)replies.writes,
+             scopeState, (unsigned long)_scope.getSpan(), (unsigned)_scope.getRate(),
+             (unsigned)scope.rate,
+             (unsigned long)scope.sweeps, (unsigned long)scope.frames,
+             (unsigned long)scope.dropped);
+}
+
+// === Factory Implementation ===
+
+IEmulatedDevice* IcomDeviceFactory::create(ISerialPort* serial, uint8_t uartIndex) {
+    IcomDevice* device = new IcomDevice(serial, uartIndex, _model);
+    if (!device->isValid()) {
+        delete device;
+        return nullptr;
+    }
+    return device;
+}
+
+void IcomDeviceFactory::destroy(IEmulatedDevice* device) {
+    delete device;
+}
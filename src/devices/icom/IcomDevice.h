@@ -0,0 +1,195 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "IEmulatedDevice.h"
+#include "ISerialPort.h"
+#include "IcomState.h"
+#include "CIVBus.h"
+#include "IcomScope.h"
+#include "platform_config.h"
+
+// Number of configurable options
+#define ICOM_OPTION_COUNT 6
+
+// Frequency ranges a model tunes (unused entries are 0-0)
+#define ICOM_MAX_RANGES 3
+
+// Wait before sending a transceive frame again after it collided (ms)
+#define ICOM_TRANSCEIVE_RETRY_MS 20
+
+// Frequency range, inclusive
+struct IcomRange {
+    uint32_t minHz;
+    uint32_t maxHz;
+};
+
+// What differs between the Icom radios served: CI-V address, coverage
+// and modes. The command set is shared.
+struct IcomModel {
+    const char* typeName;       // e.g. "ic-7300"
+    const char* description;
+    uint8_t address;            // Factory default CI-V address
+    uint32_t defaultFreq;       // Hz, both VFOs after reset
+    IcomRange ranges[ICOM_MAX_RANGES];
+    uint32_t modes;             // Bit n set if mode code n is supported
+    bool hasSubBand;            // 07 D0/D1 select the Main/Sub band
+};
+
+extern const IcomModel ICOM_IC7300;
+extern const IcomModel ICOM_IC9700;
+
+// Icom radio emulator speaking CI-V
+// Radios share their UART with any other Icom radio created on it; the
+// CIVBus reads the port and hands each radio the frames addressed to it.
+// Set the address option so every radio on one bus has its own.
+class IcomDevice : public IEmulatedDevice, public CIVNode {
+public:
+    IcomDevice(ISerialPort* serial, uint8_t uartIndex, const IcomModel& model);
+    ~IcomDevice() override;
+
+    // False if the radio could not join the bus on its UART (bus full)
+    bool isValid() const { return _bus != nullptr; }
+
+    // === Lifecycle ===
+    bool begin() override;
+    void end() override;
+    void update() override;
+
+    // === Identity ===
+    const char* getName() const override { return _model.typeName; }
+    const char* getDescription() const override { return _model.description; }
+    uint8_t getDeviceId() const override { return _deviceId; }
+    void setDeviceId(uint8_t id) override { _deviceId = id; }
+    uint8_t getUartIndex() const override { return _uartIndex; }
+
+    // === Ports ===
+    // A CI-V radio is one station on one bus: to reach it from several
+    // programs, share the bus instead
+    bool attachPort(ISerialPort* serial, uint8_t uartIndex) override;
+    bool detachPort(uint8_t uartIndex) override;
+    size_t getPortCount() const override { return (_bus != nullptr) ? 1 : 0; }
+    uint8_t getPortUart(size_t index) const override { return (index == 0) ? _uartIndex : 0; }
+
+    // === Options ===
+    size_t getOptionCount() const override { return ICOM_OPTION_COUNT; }
+    const DeviceOption* getOption(size_t index) const override;
+    DeviceOption* findOption(const char* name) override;
+    bool setOption(const char* name, const char* value) override;
+    bool getOptionValue(const char* name, char* buffer, size_t bufLen) const override;
+
+    // === Persistence ===
+    size_t serializeOptions(uint8_t* buffer, size_t bufLen) const override;
+    bool deserializeOptions(const uint8_t* buffer, size_t len) override;
+
+    // === Meter Simulation ===
+    bool setMeter(MeterType type, uint8_t value) override;
+    uint8_t getMeter(MeterType type) const override;
+
+    // === Logging ===
+    void setLogger(ILogger* logger) override { _logger = logger; }
+
+    // === Status ===
+    bool isRunning() const override { return _running; }
+    void getStatus(char* buffer, size_t bufLen) const override;
+
+    // === CI-V bus ===
+    uint8_t getCivAddress() const override;
+    bool isOnBus() const override { return _running; }
+    bool wantsEcho() const override { return _options[3].value.boolVal; }
+    void handleFrame(const CIVFrame& frame, CIVWriter& reply) override;
+
+    // === Radio-specific accessors ===
+
+    // Turn the main dial: tune the operating VFO as the front panel would,
+    // so transceive reports it. Returns false outside the radio's coverage.
+    bool tune(uint32_t freqHz);
+
+    IcomState& getState() { return _state; }
+    const IcomState& getState() const { return _state; }
+
+    // The bus the radio is a station on
+    const CIVBus* getCivBus() const { return _bus; }
+
+    const IcomScope& getScope() const { return _scope; }
+
+private:
+    // A command handler carries out one frame; args follow the
+    // sub-command if the command has one
+    typedef void (IcomDevice::*Handler)(uint8_t cmd, uint8_t sub,
+                                        const uint8_t* args, uint8_t len, CIVWriter& reply);
+
+    struct Command {
+        uint8_t cmd;
+        uint8_t sub;        // ICOM_NO_SUB for commands without one
+        Handler handler;
+    };
+
+    static const Command COMMANDS[];
+    static const size_t COMMAND_COUNT;
+
+    const IcomModel& _model;
+    CIVBus* _bus;
+    uint8_t _uartIndex;
+    uint8_t _deviceId;
+    bool _running;
+    ILogger* _logger;
+
+    IcomState _state;
+    uint8_t _pending;           // Transceive reports not sent yet (IcomChange flags)
+    uint32_t _retryMs;          // When the last one collided
+    bool _backoff;              // Waiting ICOM_TRANSCEIVE_RETRY_MS after a collision
+    uint8_t _controller;        // Sender of the frame being handled
+
+    IcomScope _scope;
+    bool _scopeOn;              // 27 10; waveform data also needs the scope option (27 11)
+
+    // Options
+    DeviceOption _options[ICOM_OPTION_COUNT];
+
+    void initOptions();
+    uint32_t getBaudRate() const;
+
+    // Send frequency and mode changes made outside the bus to address 00
+    void sendTransceive();
+
+    bool isInRange(uint32_t freqHz) const;
+    bool isModeSupported(uint8_t mode) const;
+
+    // Handlers
+    void readFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void readMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void setFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void setMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void selectVfo(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void splitOnOff(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void level(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void meter(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void readId(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void transmit(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void vfoFreq(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void vfoMode(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void scopeSwitch(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+    void scopeSetting(uint8_t cmd, uint8_t sub, const uint8_t* args, uint8_t len, CIVWriter& reply);
+
+    // Not copyable
+    IcomDevice(const IcomDevice&);
+    IcomDevice& operator=(const IcomDevice&);
+};
+
+// Factory for one Icom model; every model shares the "civ" bus
+class IcomDeviceFactory : public IDeviceFactory {
+public:
+    explicit IcomDeviceFactory(const IcomModel& model) : _model(model) {}
+
+    const char* getTypeName() const override { return _model.typeName; }
+    const char* getDescription() const override { return _model.description; }
+    DeviceCategory getCategory() const override { return DeviceCategory::RADIO; }
+    const char* getBus() const override { return "civ"; }
+    IEmulatedDevice* create(ISerialPort* serial, uint8_t uartIndex) override;
+    void destroy(IEmulatedDevice* device) override;
+
+private:
+    const IcomModel& _model;
+};
@@ -0,0 +1,223 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "IcomScope.h"
+#include <string.h>
+
+static_assert((ICOM_SCOPE_DIVISIONS - 1) * ICOM_SCOPE_CHUNK >= ICOM_SCOPE_POINTS,
+              "The divisions must carry every point");
+static_assert(ICOM_SCOPE_CHUNK + 10 <= CIV_FRAME_MAX, "A division must fit in a CI-V frame");
+
+// Spans the radio offers (27 15), half the swept width
+static const uint32_t SPANS[] = {2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000};
+static const size_t NUM_SPANS = sizeof(SPANS) / sizeof(SPANS[0]);
+static const uint32_t DEFAULT_SPAN = 25000;
+
+// Occupied bandwidth of a simulated station: data, CW, RTTY, SSB (Hz)
+static const int32_t STATION_WIDTHS[4] = {50, 150, 500, 2400};
+static const int32_t STATION_REACH = 1200;  // Half the widest
+
+// Stations are 40-139 on the 0-160 waveform scale
+#define STATION_LEVEL_MIN 40
+#define STATION_LEVEL_RANGE 100
+static_assert(STATION_LEVEL_MIN + STATION_LEVEL_RANGE <= ICOM_SCOPE_LEVEL_MAX,
+              "Station levels must stay on the waveform scale");
+
+// Integer hash: the station on a channel, and whether it is on the air
+static uint32_t mix(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352DUL;
+    x ^= x >> 15;
+    x *= 0x846CA68BUL;
+    x ^= x >> 16;
+    return x;
+}
+
+IcomScope::IcomScope()
+    : _fps(ICOM_SCOPE_FPS_MAX)
+    , _intervalUs(0)
+    , _spanHz(DEFAULT_SPAN)
+    , _to(CIV_CONTROLLER)
+    , _streaming(false)
+    , _nextUs(0)
+    , _waiting(false)
+    , _division(0)
+    , _from(0)
+    , _sweepCenter(0)
+    , _sweepSpan(0)
+    , _sweepSlot(0)
+    , _frameLen(0)
+    , _noise(0x2545F491UL)
+    , _windowUs(0)
+    , _windowSweeps(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+    reset();
+}
+
+void IcomScope::reset() {
+    setRate(ICOM_SCOPE_FPS_MAX);
+    _spanHz = DEFAULT_SPAN;
+    _to = CIV_CONTROLLER;
+    stop();
+}
+
+void IcomScope::setRate(uint8_t fps) {
+    if (fps < ICOM_SCOPE_FPS_MIN) {
+        fps = ICOM_SCOPE_FPS_MIN;
+    } else if (fps > ICOM_SCOPE_FPS_MAX) {
+        fps = ICOM_SCOPE_FPS_MAX;
+    }
+    _fps = fps;
+    _intervalUs = 1000000UL / fps;
+}
+
+bool IcomScope::setSpan(uint32_t spanHz) {
+    for (size_t i = 0; i < NUM_SPANS; i++) {
+        if (SPANS[i] == spanHz) {
+            _spanHz = spanHz;
+            return true;
+        }
+    }
+    return false;
+}
+
+void IcomScope::stop() {
+    _streaming = false;
+    _waiting = false;
+    _division = 0;
+    _frameLen = 0;
+    _stats.rate = 0;
+}
+
+void IcomScope::update(CIVBus& bus, uint8_t from, uint32_t centerHz, uint32_t nowUs) {
+    if (!_streaming) {
+        _streaming = true;
+        _nextUs = nowUs;
+        _windowUs = nowUs;
+        _windowSweeps = 0;
+    }
+
+    // A sweep falls due every 1/fps s. The newest one due waits for the
+    // line to free up; older ones it replaces are dropped.
+    if ((int32_t)(nowUs - _nextUs) >= 0) {
+        uint32_t due = (nowUs - _nextUs) / _intervalUs + 1;
+        _nextUs += due * _intervalUs;
+        _stats.dropped += due - 1 + (_waiting ? 1 : 0);
+        _waiting = true;
+    }
+
+    // Send divisions as fast as the line takes them
+    while (_waiting || _division != 0) {
+        if (_division == 0) {
+            _waiting = false;
+            _division = 1;
+            _from = from;
+            _sweepCenter = centerHz;
+            _sweepSpan = _spanHz;
+            _sweepSlot = (uint8_t)(nowUs / 1000UL / ICOM_SCOPE_SLOT_MS);
+        }
+        if (_frameLen == 0) {
+            buildFrame();
+        }
+        if (!bus.stream(_frame, _frameLen, nowUs)) {
+            break;
+        }
+        _frameLen = 0;
+        _stats.frames++;
+        if (++_division > ICOM_SCOPE_DIVISIONS) {
+            _division = 0;
+            _stats.sweeps++;
+            _windowSweeps++;
+        }
+    }
+
+    uint32_t windowUs = nowUs - _windowUs;
+    if (windowUs >= 1000000UL) {
+        _stats.rate = (uint16_t)((uint32_t)_windowSweeps * 1000UL / (windowUs / 1000UL));
+        _windowUs = nowUs;
+        _windowSweeps = 0;
+    }
+}
+
+// 27 00 00 <division> <divisions>, then for division 1 the centre mode
+// (00), centre frequency, span and out-of-range flag, and for the others
+// up to ICOM_SCOPE_CHUNK points
+void IcomScope::buildFrame() {
+    CIVWriter out(_frame, sizeof(_frame), _to, _from);
+    out.put(0x27).put(0x00).put(0x00)
+       .bcd(_division, 1).bcd(ICOM_SCOPE_DIVISIONS, 1);
+
+    if (_division == 1) {
+        bool outOfRange = (_sweepCenter < _sweepSpan);
+        out.put(0x00).freq(_sweepCenter).freq(_sweepSpan).put(outOfRange ? 0x01 : 0x00);
+    } else {
+        uint16_t first = (uint16_t)((_division - 2) * ICOM_SCOPE_CHUNK);
+        uint8_t count = ICOM_SCOPE_CHUNK;
+        if (first + count > ICOM_SCOPE_POINTS) {
+            count = (uint8_t)(ICOM_SCOPE_POINTS - first);
+        }
+        uint8_t levels[ICOM_SCOPE_CHUNK];
+        render(first, levels, count);
+        for (uint8_t i = 0; i < count; i++) {
+            out.put(levels[i]);
+        }
+    }
+    _frameLen = out.finish();
+}
+
+void IcomScope::render(uint16_t first, uint8_t* levels, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        levels[i] = (uint8_t)(ICOM_SCOPE_FLOOR + (nextNoise() & 0x0F));
+    }
+
+    // Offsets (Hz) are from the low edge of the sweep, which is below 0 Hz
+    // when the span reaches past the bottom of the coverage
+    int32_t width = (int32_t)(2 * _sweepSpan);
+    int32_t low = (int32_t)_sweepCenter - (int32_t)_sweepSpan;
+    int32_t from = low + (int32_t)((uint32_t)first * (uint32_t)width / ICOM_SCOPE_POINTS);
+    int32_t to = low + (int32_t)((uint32_t)(first + count) * (uint32_t)width / ICOM_SCOPE_POINTS);
+
+    int32_t firstChannel = (from - STATION_REACH < 0) ? 0 : (from - STATION_REACH) / (int32_t)ICOM_SCOPE_GRID;
+    int32_t lastChannel = (to + STATION_REACH) / (int32_t)ICOM_SCOPE_GRID;
+
+    for (int32_t channel = firstChannel; channel <= lastChannel; channel++) {
+        uint32_t h = mix((uint32_t)channel);
+        if ((h & 0x0F) != 0 || (mix(h ^ _sweepSlot) & 0x03) == 0) {
+            continue;  // No station on the channel, or it is off the air
+        }
+
+        int32_t center = channel * (int32_t)ICOM_SCOPE_GRID + (int32_t)((h >> 4) % ICOM_SCOPE_GRID);
+        int32_t half = STATION_WIDTHS[(h >> 14) & 0x03] / 2;
+        uint8_t level = (uint8_t)(STATION_LEVEL_MIN + (h >> 16) % STATION_LEVEL_RANGE);
+
+        // Points the station covers, at least the one it is in
+        int32_t start = center - half - low;
+        int32_t end = center + half - low;
+        if (end < 0) {
+            continue;
+        }
+        int32_t p0 = (start < 0) ? 0 : start * ICOM_SCOPE_POINTS / width;
+        int32_t p1 = end * ICOM_SCOPE_POINTS / width;
+        if (p0 < first) {
+            p0 = first;
+        }
+        if (p1 >= first + count) {
+            p1 = first + count - 1;
+        }
+        for (int32_t p = p0; p <= p1; p++) {
+            uint8_t value = (uint8_t)(level - (nextNoise() & 0x07));
+            if (value > levels[p - first]) {
+                levels[p - first] = value;
+            }
+        }
+    }
+}
+
+// xorshift32
+uint32_t IcomScope::nextNoise() {
+    _noise ^= _noise << 13;
+    _noise ^= _noise >> 17;
+    _noise ^= _noise << 5;
+    return _noise;
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "CIVBus.h"
+
+// Waveform points in one sweep, and the CI-V frames (divisions) carrying
+// it: a header division, then ICOM_SCOPE_CHUNK points per division
+#define ICOM_SCOPE_POINTS 475
+#define ICOM_SCOPE_CHUNK 50
+#define ICOM_SCOPE_DIVISIONS 11
+
+// Sweep rate range (sweeps/s); 27 1A sets fast, mid and slow
+#define ICOM_SCOPE_FPS_MIN 10
+#define ICOM_SCOPE_FPS_MAX 30
+
+// Waveform levels: points are 00-A0, the noise floor sits near the bottom
+#define ICOM_SCOPE_LEVEL_MAX 0xA0
+#define ICOM_SCOPE_FLOOR 16
+
+// Simulated stations: at most one per ICOM_SCOPE_GRID Hz, on the air
+// or not for ICOM_SCOPE_SLOT_MS at a time
+#define ICOM_SCOPE_GRID 1000UL
+#define ICOM_SCOPE_SLOT_MS 2000UL
+
+// Spectrum scope counters
+struct IcomScopeStats {
+    uint32_t sweeps;    // Complete sweeps sent
+    uint32_t frames;    // CI-V frames sent (ICOM_SCOPE_DIVISIONS per sweep)
+    uint32_t dropped;   // Sweeps replaced by a newer one before the line was free
+    uint16_t rate;      // Sweeps sent per second, over the last second
+};
+
+// Spectrum scope waveform stream (CI-V command 27 00)
+// The scope sweeps span Hz either side of the operating frequency. Each
+// sweep goes out as ICOM_SCOPE_DIVISIONS frames: division 1 carries the
+// centre frequency and span, divisions 2-11 the waveform points.
+//
+// The spectrum is synthetic: a noise floor with a station on some of the
+// 1 kHz channels, picked by a hash of the channel so the same stations
+// show up at the same place on every sweep and at every span, and keyed
+// on and off in ICOM_SCOPE_SLOT_MS slots.
+//
+// Nothing is generated ahead: one frame buffer is filled with the next
+// division when the last one has gone out. A sweep is due every 1/fps s;
+// when the bus cannot keep up (slow baud rate, busy controller) the next
+// sweep starts as soon as the last one is out, so the stream runs at the
+// line's capacity, and the sweeps that fall due in the meantime are
+// dropped and counted rather than queued.
+class IcomScope {
+public:
+    IcomScope();
+
+    // Stop streaming and return to the default span and rate
+    void reset();
+
+    // Sweeps per second (ICOM_SCOPE_FPS_MIN to ICOM_SCOPE_FPS_MAX)
+    void setRate(uint8_t fps);
+    uint8_t getRate() const { return _fps; }
+
+    // Half the swept width (Hz); false unless it is one of the radio's spans
+    bool setSpan(uint32_t spanHz);
+    uint32_t getSpan() const { return _spanHz; }
+
+    // Address the waveform frames are sent to (the controller that asked)
+    void setDestination(uint8_t address) { _to = address; }
+
+    // Build and stream waveform frames, called every loop while the scope
+    // is on and its output is enabled; from is the radio's address and
+    // centerHz its operating frequency
+    void update(CIVBus& bus, uint8_t from, uint32_t centerHz, uint32_t nowUs);
+
+    // Abandon the sweep in progress; update() starts a new one
+    void stop();
+
+    const IcomScopeStats& getStats() const { return _stats; }
+
+private:
+    uint8_t _fps;
+    uint32_t _intervalUs;       // 1/fps
+    uint32_t _spanHz;
+    uint8_t _to;
+    bool _streaming;            // update() called since the last stop()
+    uint32_t _nextUs;           // When the next sweep is due
+    bool _waiting;              // A sweep is due, waiting for the line
+
+    // Sweep in progress: division 0 when idle
+    uint8_t _division;
+    uint8_t _from;
+    uint32_t _sweepCenter;
+    uint32_t _sweepSpan;
+    uint8_t _sweepSlot;         // Station schedule slot the sweep shows
+
+    uint8_t _frame[CIV_FRAME_MAX];
+    size_t _frameLen;           // 0 until the division is built
+
+    uint32_t _noise;            // Noise generator state
+    uint32_t _windowUs;         // Start of the rate measurement
+    uint16_t _windowSweeps;
+
+    IcomScopeStats _stats;
+
+    // Fill _frame with the current division
+    void buildFrame();
+
+    // Levels of count points from the first, noise floor and stations
+    void render(uint16_t first, uint8_t* levels, uint8_t count);
+
+    // Next noise sample
+    uint32_t nextNoise();
+};
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// CI-V operating mode codes (command 01/04/06)
+enum class IcomMode : uint8_t {
+    LSB = 0x00,
+    USB = 0x01,
+    AM = 0x02,
+    CW = 0x03,
+    RTTY = 0x04,
+    FM = 0x05,
+    WFM = 0x06,
+    CW_R = 0x07,
+    RTTY_R = 0x08,
+    DV = 0x17
+};
+
+// Filter settings FIL1-FIL3
+#define ICOM_FILTER_MIN 1
+#define ICOM_FILTER_MAX 3
+
+// State fields tracked for change reporting (bit flags for IcomState::changed)
+// Transceive mode broadcasts frequency and mode changes on the bus
+enum IcomChange : uint8_t {
+    ICOM_CHANGED_FREQ   = 0x01,   // freq
+    ICOM_CHANGED_MODE   = 0x02,   // mode, filter, dataMode
+    ICOM_CHANGED_VFO    = 0x04,   // vfo (the operating frequency and mode change with it)
+    ICOM_CHANGED_PTT    = 0x08,   // ptt
+    ICOM_CHANGED_SPLIT  = 0x10,   // split
+    ICOM_CHANGED_LEVELS = 0x20    // afGain, rfGain, squelch, rfPower
+};
+
+// State of an emulated Icom radio
+// Fields may be read directly; writers use set() so that changes are
+// recorded in changed
+struct IcomState {
+    // VFO A and B (Main and Sub band on radios that have one)
+    uint32_t freq[2];           // Hz
+    IcomMode mode[2];
+    uint8_t filter[2];          // ICOM_FILTER_MIN to ICOM_FILTER_MAX
+    uint8_t dataMode[2];        // 0 off, 1-3 D1-D3
+    uint8_t vfo;                // 0 = A, 1 = B
+
+    bool ptt;
+    bool split;
+
+    // Levels, 0-255 as CI-V sends them
+    uint8_t afGain;
+    uint8_t rfGain;
+    uint8_t squelch;
+    uint8_t rfPower;
+
+    // Meters (console-controlled simulation values), 0-255
+    uint8_t smeter;
+    uint8_t powerMeter;
+    uint8_t swrMeter;
+    uint8_t alcMeter;
+    uint8_t compMeter;
+
+    // Fields changed since the device last took them (IcomChange flags)
+    uint8_t changed;
+
+    // Set a field, recording a change if the value differs
+    template <typename T>
+    void set(T& field, T value, uint8_t change) {
+        if (field != value) {
+            field = value;
+            changed |= change;
+        }
+    }
+
+    // Return the changed flags and clear them
+    uint8_t takeChanges() {
+        uint8_t result = changed;
+        changed = 0;
+        return result;
+    }
+
+    // Initialize to default values, both VFOs on freqHz
+    void reset(uint32_t freqHz) {
+        for (uint8_t i = 0; i < 2; i++) {
+            freq[i] = freqHz;
+            mode[i] = IcomMode::USB;
+            filter[i] = ICOM_FILTER_MIN;
+            dataMode[i] = 0;
+        }
+        vfo = 0;
+        ptt = false;
+        split = false;
+        afGain = 128;
+        rfGain = 255;
+        squelch = 0;
+        rfPower = 255;
+        smeter = 0;
+        powerMeter = 0;
+        swrMeter = 0;
+        alcMeter = 0;
+        compMeter = 0;
+        changed = 0;
+    }
+
+    // The operating (selected) VFO, or the other one
+    uint8_t selected() const { return vfo; }
+    uint8_t unselected() const { return vfo ^ 1; }
+};
@@ -3,7 +3,7 @@
 
 #include "NMEAGPSDevice.h"
 #include <string.h>
-#include <stdio.h>
+#include "core/FixedWriter.h"
 #include <stdlib.h>
 
 // Helper to format float (printf %f not supported on all platforms)
@@ -25,13 +25,17 @@ static const size_t NUM_UPDATE_RATES = 3;
 static const uint8_t DEFAULT_RATE_INDEX = 0;  // 1 Hz default
 
 NMEAGPSDevice::NMEAGPSDevice(ISerialPort* serial, uint8_t uartIndex)
-    : _serial(serial)
-    , _uartIndex(uartIndex)
+    : _uartIndex(uartIndex)
     , _deviceId(0xFF)
     , _running(false)
     , _logger(nullptr)
-    , _generator(_state, *serial)
+    , _generator(_state, _ports)
+    , _outputPending(false)
+    , _outputDueUs(0)
 {
+    if (serial != nullptr) {
+        _ports.add(serial, uartIndex);
+    }
     _state.reset();
     initOptions();
 }
@@ -42,6 +46,34 @@ NMEAGPSDevice::~NMEAGPSDevice() {
     }
 }
 
+bool NMEAGPSDevice::attachPort(ISerialPort* serial, uint8_t uartIndex) {
+    if (!_ports.add(serial, uartIndex)) {
+        return false;
+    }
+
+    if (_running) {
+        serial->begin(getBaudRate());
+    }
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "NMEA", "Device %d also on UART %d", _deviceId, uartIndex);
+    }
+    return true;
+}
+
+bool NMEAGPSDevice::detachPort(uint8_t uartIndex) {
+    int index = _ports.indexOf(uartIndex);
+    if (index <= 0) {
+        return false;  // Not attached, or the primary port
+    }
+
+    if (_running) {
+        _ports.getPort(index)->end();
+    }
+    _ports.remove(uartIndex);
+    return true;
+}
+
 void NMEAGPSDevice::initOptions() {
     // Option 0: Baud rate
     _options[0] = makeEnumOption(
@@ -60,16 +92,36 @@ void NMEAGPSDevice::initOptions() {
         NUM_UPDATE_RATES,
         DEFAULT_RATE_INDEX
     );
+
+    // Option 2: Output latency after each fix (ms)
+    _options[2] = makeUint32Option(
+        "latency",
+        "Output latency (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
+
+    // Option 3: Random extra latency (ms)
+    _options[3] = makeUint32Option(
+        "jitter",
+        "Output latency jitter (ms)",
+        0,
+        REPLY_LATENCY_MAX_MS,
+        0
+    );
 }
 
 bool NMEAGPSDevice::begin() {
-    if (_serial == nullptr) {
+    if (_ports.count() == 0) {
         return false;
     }
 
     applyBaudRate();
+    applyLatency();
     _state.reset();
     _state.lastOutputMs = millis();
+    _outputPending = false;
     _running = true;
 
     if (_logger) {
@@ -84,7 +136,7 @@ bool NMEAGPSDevice::begin() {
 
 void NMEAGPSDevice::end() {
     _running = false;
-    _serial->end();
+    _ports.end();
 
     if (_logger) {
         _logger->logf(LogLevel::INFO, "NMEA", "Stopped on UART %d", _uartIndex);
@@ -97,17 +149,37 @@ void NMEAGPSDevice::update() {
     unsigned long now = millis();
     unsigned long interval = getUpdateIntervalMs();
 
+    // A report still waiting for its latency goes out before the next fix
+    if (_outputPending &&
+        ((int32_t)(micros() - _outputDueUs) >= 0 || now - _state.lastOutputMs >= interval)) {
+        _outputPending = false;
+        _generator.outputAll();
+    }
+
     if (now - _state.lastOutputMs >= interval) {
         _state.lastOutputMs = now;
 
         // Advance simulated time
         _state.advanceTime();
 
-        // Output all NMEA sentences
-        _generator.outputAll();
+        // Output all NMEA sentences, at once or after the latency
+        if (_latency.isZero()) {
+            _generator.outputAll();
+        } else {
+            _outputPending = true;
+            _outputDueUs = micros() + _latency.sampleUs();
+        }
     }
 }
 
+uint32_t NMEAGPSDevice::getNextEventUs() const {
+    if (!_running || !_outputPending) {
+        return DEVICE_IDLE_US;
+    }
+    int32_t wait = (int32_t)(_outputDueUs - micros());
+    return (wait > 0) ? (uint32_t)wait : 0;
+}
+
 unsigned long NMEAGPSDevice::getUpdateIntervalMs() const {
     uint8_t rateIndex = _options[1].value.enumVal.current;
     if (rateIndex >= NUM_UPDATE_RATES) {
@@ -117,13 +189,21 @@ unsigned long NMEAGPSDevice::getUpdateIntervalMs() const {
     return 1000 / hz;
 }
 
-void NMEAGPSDevice::applyBaudRate() {
+uint32_t NMEAGPSDevice::getBaudRate() const {
     uint8_t baudIndex = _options[0].value.enumVal.current;
     if (baudIndex >= NUM_BAUD_RATES) {
         baudIndex = DEFAULT_BAUD_INDEX;
     }
-    uint32_t baud = BAUD_RATE_VALUES[baudIndex];
-    _serial->begin(baud);
+    return BAUD_RATE_VALUES[baudIndex];
+}
+
+void NMEAGPSDevice::applyBaudRate() {
+    _ports.begin(getBaudRate());
+}
+
+void NMEAGPSDevice::applyLatency() {
+    _latency.set((uint16_t)_options[2].value.uint32Val.current,
+                 (uint16_t)_options[3].value.uint32Val.current);
 }
 
 const DeviceOption* NMEAGPSDevice::getOption(size_t index) const {
@@ -157,6 +237,10 @@ bool NMEAGPSDevice::setOption(const char* name, const char* value) {
         applyBaudRate();
     }
 
+    if (strcmp(name, "latency") == 0 || strcmp(name, "jitter") == 0) {
+        applyLatency();
+    }
+
     return true;
 }
 
@@ -172,14 +256,20 @@ bool NMEAGPSDevice::getOptionValue(const char* name, char* buffer, size_t bufLen
 
 size_t NMEAGPSDevice::serializeOptions(uint8_t* buffer, size_t bufLen) const {
     // Format: [baud_index (1 byte)][rate_index (1 byte)]
-    if (bufLen < 2) {
+    //         [latency (2 bytes)][jitter (2 bytes)], little-endian
+    if (bufLen < 6) {
         return 0;
     }
 
     buffer[0] = _options[0].value.enumVal.current;  // Baud rate index
     buffer[1] = _options[1].value.enumVal.current;  // Update rate index
+    for (size_t i = 0; i < 2; i++) {
+        uint32_t ms = _options[2 + i].value.uint32Val.current;  // Latency, jitter
+        buffer[2 + 2 * i] = (uint8_t)(ms & 0xFF);
+        buffer[3 + 2 * i] = (uint8_t)(ms >> 8);
+    }
 
-    return 2;
+    return 6;
 }
 
 bool NMEAGPSDevice::deserializeOptions(const uint8_t* buffer, size_t len) {
@@ -201,6 +291,15 @@ bool NMEAGPSDevice::deserializeOptions(const uint8_t* buffer, size_t len) {
     }
     _options[1].value.enumVal.current = rateIndex;
 
+    // Restore latency, none in configurations saved before the options
+    for (size_t i = 0; i < 2; i++) {
+        uint32_t ms = 0;
+        if (len >= 4 + 2 * i) {
+            ms = (uint32_t)buffer[2 + 2 * i] | ((uint32_t)buffer[3 + 2 * i] << 8);
+        }
+        _options[2 + i].value.uint32Val.current = (ms <= REPLY_LATENCY_MAX_MS) ? ms : 0;
+    }
+
     return true;
 }
 
@@ -257,7 +356,7 @@ void NMEAGPSDevice::getStatus(char* buffer, size_t bufLen) const {
     uint32_t rate = UPDATE_RATE_VALUES[_options[1].value.enumVal.current];
 
     char latStr[16], lonStr[16], altStr[12], speedStr[12], courseStr[12], hdopStr[8];
-    snprintf(buffer, bufLen,
+    FixedWriter(buffer, bufLen).format(
              "  Position: %s, %s\r\n"
              "  Altitude: %s m\r\n"
              "  Speed: %s knots\r\n"
@@ -266,7 +365,8 @@ void NMEAGPSDevice::getStatus(char* buffer, size_t bufLen) const {
              "  HDOP: %s\r\n"
              "  Time: %02d:%02d:%02d UTC\r\n"
              "  Date: %04d-%02d-%02d\r\n"
-             "  Update rate: %lu Hz",
+             "  Update rate: %lu Hz\r\n"
+             "  Latency: %lu ms + up to %lu ms",
              fmtFloat(latStr, _state.latitude, 1, 6),
              fmtFloat(lonStr, _state.longitude, 1, 6),
              fmtFloat(altStr, _state.altitude, 1, 1),
@@ -276,7 +376,9 @@ void NMEAGPSDevice::getStatus(char* buffer, size_t bufLen) const {
              fmtFloat(hdopStr, _state.hdop, 1, 1),
              _state.hour, _state.minute, _state.second,
              _state.year, _state.month, _state.day,
-             (unsigned long)rate);
+             (unsigned long)rate,
+             (unsigned long)_options[2].value.uint32Val.current,
+             (unsigned long)_options[3].value.uint32Val.current);
 }
 
 // === Factory Implementation ===
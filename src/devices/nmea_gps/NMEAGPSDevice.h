@@ -9,9 +9,11 @@
 #include "DeviceOption.h"
 #include "NMEAGPSState.h"
 #include "NMEAGenerator.h"
+#include "core/SerialFanOut.h"
+#include "core/ReplyDelay.h"
 
 // Number of configurable options
-#define NMEA_GPS_OPTION_COUNT 2
+#define NMEA_GPS_OPTION_COUNT 4
 
 // NMEA GPS device emulator
 class NMEAGPSDevice : public IEmulatedDevice {
@@ -32,6 +34,12 @@ public:
     void setDeviceId(uint8_t id) override { _deviceId = id; }
     uint8_t getDeviceId() const override { return _deviceId; }
 
+    // Ports
+    bool attachPort(ISerialPort* serial, uint8_t uartIndex) override;
+    bool detachPort(uint8_t uartIndex) override;
+    size_t getPortCount() const override { return _ports.count(); }
+    uint8_t getPortUart(size_t index) const override { return _ports.getUart(index); }
+
     // Options
     size_t getOptionCount() const override { return NMEA_GPS_OPTION_COUNT; }
     const DeviceOption* getOption(size_t index) const override;
@@ -50,6 +58,9 @@ public:
     // Logger
     void setLogger(ILogger* logger) override;
 
+    // Timing
+    uint32_t getNextEventUs() const override;
+
     // Status
     void getStatus(char* buffer, size_t bufLen) const override;
 
@@ -60,18 +71,25 @@ public:
     NMEAGPSState& getState() { return _state; }
 
 private:
-    ISerialPort* _serial;
+    SerialFanOut _ports;     // Every port the GPS is served on
     uint8_t _uartIndex;
     uint8_t _deviceId;
     bool _running;
     ILogger* _logger;
 
     NMEAGPSState _state;
-    NMEAGenerator _generator;
+    NMEAGenerator _generator;  // Formats each sentence once for all ports
     DeviceOption _options[NMEA_GPS_OPTION_COUNT];
 
+    // Output latency: each fix is reported this long after its time
+    LatencyModel _latency;
+    bool _outputPending;
+    uint32_t _outputDueUs;
+
     void initOptions();
+    uint32_t getBaudRate() const;
     void applyBaudRate();
+    void applyLatency();
 
     // Get update interval in milliseconds based on rate option
     unsigned long getUpdateIntervalMs() const;
@@ -2,17 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include "NMEAGenerator.h"
+#include "core/FixedWriter.h"
 #include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
 #include <math.h>
 
-// Helper to format float (printf %f not supported on all platforms)
-static char* fmtFloat(char* buf, double val, int width, int prec) {
-    dtostrf(val, width, prec, buf);
-    return buf;
-}
-
 NMEAGenerator::NMEAGenerator(NMEAGPSState& state, ISerialPort& serial)
     : _state(state)
     , _serial(serial)
@@ -45,191 +38,176 @@ uint8_t NMEAGenerator::calculateChecksum(const char* sentence) {
     return checksum;
 }
 
-void NMEAGenerator::sendSentence(const char* sentence) {
-    uint8_t checksum = calculateChecksum(sentence);
-
-    // Build complete sentence with checksum
-    char finalSentence[NMEA_SENTENCE_MAX_LEN];
-    snprintf(finalSentence, sizeof(finalSentence), "%s*%02X\r\n", sentence, checksum);
+void NMEAGenerator::sendSentence(FixedWriter& sentence) {
+    // Complete the sentence in place with checksum and CR LF
+    size_t bodyLen = sentence.length();
+    sentence.put('*').hex(calculateChecksum(sentence.c_str())).put("\r\n");
 
-    _serial.print(finalSentence);
+    if (sentence.overflowed()) {
+        if (_logger) {
+            _logger->logf(LogLevel::WARN, "NMEA", "Sentence too long, skipped");
+        }
+        return;
+    }
 
-    if (_logger) {
-        // Remove CR LF for logging
-        size_t len = strlen(finalSentence);
-        if (len >= 2) {
-            finalSentence[len - 2] = '\0';
+    // Skip the sentence rather than queue a truncated one when the link is saturated
+    if (_serial.availableForWrite() < (int)sentence.length()) {
+        _serial.noteDropped(sentence.length());
+        if (_logger) {
+            _logger->logf(LogLevel::DEBUG, "NMEA", "TX queue full, sentence skipped");
         }
-        _logger->logf(LogLevel::DEBUG, "NMEA", "TX: %s", finalSentence);
+        return;
     }
-}
 
-void NMEAGenerator::formatLatitude(char* buf, double lat) {
-    // Convert decimal degrees to DDMM.MMMM format
-    double absLat = fabs(lat);
-    int degrees = (int)absLat;
-    double minutes = (absLat - degrees) * 60.0;
-
-    // Format minutes with leading zero if needed (07.4 format = 7 chars, 4 decimals)
-    char minBuf[12];
-    dtostrf(minutes, 7, 4, minBuf);
-    // Replace leading spaces with zeros for NMEA format
-    for (int i = 0; minBuf[i] == ' '; i++) minBuf[i] = '0';
-    snprintf(buf, 12, "%02d%s", degrees, minBuf);
+    _serial.write((const uint8_t*)sentence.c_str(), sentence.length());
+
+    if (_logger) {
+        // Leave out CR LF
+        _logger->logf(LogLevel::DEBUG, "NMEA", "TX: %.*s", (int)(bodyLen + 3), sentence.c_str());
+    }
 }
 
-void NMEAGenerator::formatLongitude(char* buf, double lon) {
-    // Convert decimal degrees to DDDMM.MMMM format
-    double absLon = fabs(lon);
-    int degrees = (int)absLon;
-    double minutes = (absLon - degrees) * 60.0;
-
-    // Format minutes with leading zero if needed (07.4 format = 7 chars, 4 decimals)
-    char minBuf[12];
-    dtostrf(minutes, 7, 4, minBuf);
-    // Replace leading spaces with zeros for NMEA format
-    for (int i = 0; minBuf[i] == ' '; i++) minBuf[i] = '0';
-    snprintf(buf, 12, "%03d%s", degrees, minBuf);
+// Degrees and minutes in 1/10000 minute, rounded once so minutes never
+// come out as 60.0000
+void NMEAGenerator::formatAngle(FixedWriter& out, double value, bool longitude) {
+    uint32_t total = (uint32_t)(fabs(value) * 600000.0 + 0.5);
+    uint16_t degrees = (uint16_t)(total / 600000UL);
+    uint32_t minutes = total % 600000UL;
+
+    if (longitude) {
+        out.digits<3>(degrees);
+    } else {
+        out.digits<2>(degrees);
+    }
+    out.fixedDigits<2, 4>(minutes);
 }
 
-void NMEAGenerator::formatTime(char* buf) {
-    snprintf(buf, 11, "%02d%02d%02d.00",
-             _state.hour, _state.minute, _state.second);
+void NMEAGenerator::formatTime(FixedWriter& out) {
+    out.digits<2>(_state.hour)
+       .digits<2>(_state.minute)
+       .digits<2>(_state.second)
+       .put(".00");
 }
 
-void NMEAGenerator::formatDate(char* buf) {
-    snprintf(buf, 7, "%02d%02d%02d",
-             _state.day, _state.month, _state.year % 100);
+void NMEAGenerator::formatDate(FixedWriter& out) {
+    out.digits<2>(_state.day)
+       .digits<2>(_state.month)
+       .digits<2>((uint8_t)(_state.year % 100));
 }
 
 // GGA - GPS Fix Data
 // $GPGGA,HHMMSS.SS,DDMM.MMMM,N,DDDMM.MMMM,E,Q,NN,H.H,AAA.A,M,GGG.G,M,,*CC
 void NMEAGenerator::outputGGA() {
-    char time[12];
-    char lat[12];
-    char lon[12];
-    char hdopStr[8], altStr[12], geoidStr[12];
-
-    formatTime(time);
-    formatLatitude(lat, _state.latitude);
-    formatLongitude(lon, _state.longitude);
-
-    snprintf(_buffer, sizeof(_buffer),
-             "$GPGGA,%s,%s,%c,%s,%c,%d,%02d,%s,%s,M,%s,M,,",
-             time,
-             lat, _state.getLatHemisphere(),
-             lon, _state.getLonHemisphere(),
-             _state.fixQuality,
-             _state.numSatellites,
-             fmtFloat(hdopStr, _state.hdop, 1, 1),
-             fmtFloat(altStr, _state.altitude, 1, 1),
-             fmtFloat(geoidStr, _state.geoidSep, 1, 1));
-
-    sendSentence(_buffer);
+    FixedWriter out(_buffer, sizeof(_buffer));
+
+    out.put("$GPGGA,");
+    formatTime(out);
+    out.put(',');
+    formatAngle(out, _state.latitude, false);
+    out.put(',').put(_state.getLatHemisphere()).put(',');
+    formatAngle(out, _state.longitude, true);
+    out.put(',').put(_state.getLonHemisphere())
+       .put(',').number(_state.fixQuality)
+       .put(',').digits<2>(_state.numSatellites)
+       .put(',').fixed<1>(_state.hdop)
+       .put(',').fixed<1>(_state.altitude)
+       .put(",M,").fixed<1>(_state.geoidSep)
+       .put(",M,,");
+
+    sendSentence(out);
 }
 
 // RMC - Recommended Minimum Navigation Information
 // $GPRMC,HHMMSS.SS,A,DDMM.MMMM,N,DDDMM.MMMM,E,SSS.S,CCC.C,DDMMYY,VAR,D*CC
 void NMEAGenerator::outputRMC() {
-    char time[12];
-    char date[8];
-    char lat[12];
-    char lon[12];
-    char speedStr[12], courseStr[12], magVarStr[12];
-
-    formatTime(time);
-    formatDate(date);
-    formatLatitude(lat, _state.latitude);
-    formatLongitude(lon, _state.longitude);
+    FixedWriter out(_buffer, sizeof(_buffer));
 
     char status = _state.hasValidFix() ? 'A' : 'V';
     char magDir = _state.magVariation >= 0 ? 'E' : 'W';
 
-    snprintf(_buffer, sizeof(_buffer),
-             "$GPRMC,%s,%c,%s,%c,%s,%c,%s,%s,%s,%s,%c,A",
-             time,
-             status,
-             lat, _state.getLatHemisphere(),
-             lon, _state.getLonHemisphere(),
-             fmtFloat(speedStr, _state.speedKnots, 1, 1),
-             fmtFloat(courseStr, _state.courseTrue, 1, 1),
-             date,
-             fmtFloat(magVarStr, fabs(_state.magVariation), 1, 1), magDir);
-
-    sendSentence(_buffer);
+    out.put("$GPRMC,");
+    formatTime(out);
+    out.put(',').put(status).put(',');
+    formatAngle(out, _state.latitude, false);
+    out.put(',').put(_state.getLatHemisphere()).put(',');
+    formatAngle(out, _state.longitude, true);
+    out.put(',').put(_state.getLonHemisphere())
+       .put(',').fixed<1>(_state.speedKnots)
+       .put(',').fixed<1>(_state.courseTrue)
+       .put(',');
+    formatDate(out);
+    out.put(',').fixed<1>(fabsf(_state.magVariation))
+       .put(',').put(magDir)
+       .put(",A");
+
+    sendSentence(out);
 }
 
 // GSA - GPS DOP and Active Satellites
 // $GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39
 void NMEAGenerator::outputGSA() {
-    // Start building the sentence
-    int pos = snprintf(_buffer, sizeof(_buffer), "$GPGSA,A,%d", _state.fixMode);
+    FixedWriter out(_buffer, sizeof(_buffer));
+
+    out.put("$GPGSA,A,").number(_state.fixMode);
 
     // Add up to 12 satellite PRNs (or empty fields)
     for (int i = 0; i < 12; i++) {
+        out.put(',');
         if (i < _state.numSatsInView && _state.satPRN[i] > 0) {
-            pos += snprintf(_buffer + pos, sizeof(_buffer) - pos, ",%02d", _state.satPRN[i]);
-        } else {
-            pos += snprintf(_buffer + pos, sizeof(_buffer) - pos, ",");
+            out.digits<2>(_state.satPRN[i]);
         }
     }
 
     // Add DOP values
-    char pdopStr[8], hdopStr[8], vdopStr[8];
-    snprintf(_buffer + pos, sizeof(_buffer) - pos, ",%s,%s,%s",
-             fmtFloat(pdopStr, _state.pdop, 1, 1),
-             fmtFloat(hdopStr, _state.hdop, 1, 1),
-             fmtFloat(vdopStr, _state.vdop, 1, 1));
+    out.put(',').fixed<1>(_state.pdop)
+       .put(',').fixed<1>(_state.hdop)
+       .put(',').fixed<1>(_state.vdop);
 
-    sendSentence(_buffer);
+    sendSentence(out);
 }
 
 // GSV - Satellites in View
 // $GPGSV,2,1,08,01,40,083,46,02,17,308,41,12,07,344,39,14,22,228,45*75
 void NMEAGenerator::outputGSV() {
     // Calculate number of messages needed (4 satellites per message)
-    int numMsgs = (_state.numSatsInView + 3) / 4;
+    uint8_t numMsgs = (_state.numSatsInView + 3) / 4;
     if (numMsgs == 0) numMsgs = 1;
 
     int satIdx = 0;
 
-    for (int msg = 1; msg <= numMsgs; msg++) {
-        int pos = snprintf(_buffer, sizeof(_buffer), "$GPGSV,%d,%d,%02d",
-                          numMsgs, msg, _state.numSatsInView);
+    for (uint8_t msg = 1; msg <= numMsgs; msg++) {
+        FixedWriter out(_buffer, sizeof(_buffer));
+
+        out.put("$GPGSV,").number(numMsgs)
+           .put(',').number(msg)
+           .put(',').digits<2>(_state.numSatsInView);
 
         // Add up to 4 satellites per message
+        // Don't pad the last message - we only output what we have
         for (int i = 0; i < 4 && satIdx < _state.numSatsInView; i++, satIdx++) {
-            pos += snprintf(_buffer + pos, sizeof(_buffer) - pos,
-                           ",%02d,%02d,%03d,%02d",
-                           _state.satPRN[satIdx],
-                           _state.satElevation[satIdx],
-                           _state.satAzimuth[satIdx],
-                           _state.satSNR[satIdx]);
-        }
-
-        // Pad remaining satellite fields if needed (for last message)
-        int remaining = 4 - (satIdx % 4);
-        if (msg == numMsgs && remaining < 4) {
-            // Don't pad - we only output what we have
+            out.put(',').digits<2>(_state.satPRN[satIdx])
+               .put(',').digits<2>(_state.satElevation[satIdx])
+               .put(',').digits<3>(_state.satAzimuth[satIdx])
+               .put(',').digits<2>(_state.satSNR[satIdx]);
         }
 
-        sendSentence(_buffer);
+        sendSentence(out);
     }
 }
 
 // VTG - Velocity Made Good
 // $GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48
 void NMEAGenerator::outputVTG() {
+    FixedWriter out(_buffer, sizeof(_buffer));
+
     // Convert knots to km/h
     float speedKmh = _state.speedKnots * 1.852f;
 
-    char courseTStr[12], courseMStr[12], speedKnStr[12], speedKmStr[12];
-    snprintf(_buffer, sizeof(_buffer),
-             "$GPVTG,%s,T,%s,M,%s,N,%s,K,A",
-             fmtFloat(courseTStr, _state.courseTrue, 1, 1),
-             fmtFloat(courseMStr, _state.courseMag, 1, 1),
-             fmtFloat(speedKnStr, _state.speedKnots, 1, 1),
-             fmtFloat(speedKmStr, speedKmh, 1, 1));
+    out.put("$GPVTG,").fixed<1>(_state.courseTrue)
+       .put(",T,").fixed<1>(_state.courseMag)
+       .put(",M,").fixed<1>(_state.speedKnots)
+       .put(",N,").fixed<1>(speedKmh)
+       .put(",K,A");
 
-    sendSentence(_buffer);
+    sendSentence(out);
 }
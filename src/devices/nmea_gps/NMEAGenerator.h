@@ -8,6 +8,8 @@
 #include "ISerialPort.h"
 #include "ILogger.h"
 
+class FixedWriter;
+
 // NMEA sentence buffer size
 #define NMEA_SENTENCE_MAX_LEN 83  // 79 chars + $ + CR + LF + null
 
@@ -38,20 +40,15 @@ private:
     // Calculate NMEA checksum (XOR of all chars between $ and *)
     uint8_t calculateChecksum(const char* sentence);
 
-    // Send a complete NMEA sentence with checksum
-    void sendSentence(const char* sentence);
-
-    // Format latitude to NMEA format (DDMM.MMMM)
-    // buf must be at least 10 chars
-    void formatLatitude(char* buf, double lat);
+    // Append checksum and CR LF to a sentence and send it as one write
+    void sendSentence(FixedWriter& sentence);
 
-    // Format longitude to NMEA format (DDDMM.MMMM)
-    // buf must be at least 11 chars
-    void formatLongitude(char* buf, double lon);
+    // Format latitude (DDMM.MMMM) or longitude (DDDMM.MMMM), without sign
+    void formatAngle(FixedWriter& out, double value, bool longitude);
 
     // Format time as HHMMSS.SS
-    void formatTime(char* buf);
+    void formatTime(FixedWriter& out);
 
     // Format date as DDMMYY
-    void formatDate(char* buf);
+    void formatDate(FixedWriter& out);
 };
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "YaesuState.h"
+
+// Number of CAT radio models (descriptors in CATModels.cpp)
+#define CAT_MODEL_COUNT 5
+
+// Auto-Information reports a model sends, at most
+#define CAT_MAX_REPORTS 8
+
+// IF and OI layout length, with the terminator
+#define CAT_LAYOUT_SIZE 22
+
+// Compiled command table of one CAT dialect (CATParser.cpp): the rows and
+// their opcode index, in flash
+struct CATCommandSet;
+
+extern const CATCommandSet CAT_YAESU_COMMANDS PROGMEM;     // FT-991A, FTdx10
+extern const CATCommandSet CAT_KENWOOD_COMMANDS PROGMEM;   // TS-590, TS-2000
+extern const CATCommandSet CAT_ELECRAFT_COMMANDS PROGMEM;  // K3
+
+// Auto-Information report: the read command sent when any of the changes
+// happen. A report that lists both VFO frequencies follows the current
+// VFO's only (IF reports the VFO in use).
+struct CATReport {
+    char opcode[3];
+    uint16_t changes;   // YaesuChange flags
+};
+
+// What differs between the CAT radios served: the command set, reply
+// layouts, mode codes, identity and coverage. Every model shares the
+// parser and YaesuState; a model is this descriptor and nothing else.
+//
+// IF and OI layouts are strings of field letters, each written as
+//   F  frequency, freqDigits wide     C  memory channel, 3 digits
+//   O  RIT offset, sign and 4 digits  R  RIT on      X  XIT on
+//   M  mode code                      N  mode number, 2 digits
+//   T  transmitting                   V  VFO (0 = A, 1 = B)
+// and any other character as itself. IF reports the current VFO and OI
+// the other one.
+//
+// The descriptors are in flash, strings included, and a device works from
+// a copy in RAM (memcpy_P). The type name and description are the
+// exception: the device and factory interfaces hand them out as plain
+// strings, as every other device's are.
+struct CATModel {
+    const char* typeName;       // e.g. "ft-991a"
+    const char* description;
+    char id[5];                 // ID reply
+    const CATCommandSet* commands;  // In flash
+    uint32_t minHz;             // Coverage, inclusive; within FREQ_MIN..FREQ_MAX
+    uint32_t maxHz;
+    uint32_t baudRate;          // Factory default CAT rate
+    uint16_t rigModel;          // Hamlib model number, for rigctld clients
+    uint8_t freqDigits;         // Frequency width in FA, FB and IF
+    char ifLayout[CAT_LAYOUT_SIZE];
+    char oiLayout[CAT_LAYOUT_SIZE];  // Empty if the radio has no OI
+    char modes[16];             // Mode code of each YaesuMode (index 0 unused);
+                                // modes the radio lacks read as the nearest
+                                // one it has, and a set takes the first match
+    bool hasMenu;               // EX serves YAESU_MENU
+    CATReport reports[CAT_MAX_REPORTS];  // Auto-Information, in the order sent
+};
+
+extern const CATModel CAT_FT991A PROGMEM;
+extern const CATModel CAT_FTDX10 PROGMEM;
+extern const CATModel CAT_TS590 PROGMEM;
+extern const CATModel CAT_TS2000 PROGMEM;
+extern const CATModel CAT_K3 PROGMEM;
+
+// Every model, for lookups by type name
+extern const CATModel* const CAT_MODELS[CAT_MODEL_COUNT] PROGMEM;
+
+// Model with a type name (case-insensitive), nullptr if none
+// Returns the descriptor in flash
+const CATModel* findCATModel(const char* typeName);
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "CATModel.h"
+#include <string.h>
+
+// Auto-Information reports
+#define YAESU_REPORTS {                                                     \
+    {"FA", CHANGED_FREQ_A}, {"FB", CHANGED_FREQ_B}, {"MD", CHANGED_MODE},   \
+    {"VS", CHANGED_VFO}, {"TX", CHANGED_PTT}, {"SM", CHANGED_SMETER},       \
+    {"IF", CHANGED_FREQ_A | CHANGED_FREQ_B | CHANGED_MODE | CHANGED_VFO | CHANGED_RIT} }
+
+// Kenwood and Elecraft radios report PTT in IF
+#define KENWOOD_REPORTS {                                                   \
+    {"FA", CHANGED_FREQ_A}, {"FB", CHANGED_FREQ_B}, {"MD", CHANGED_MODE},   \
+    {"FR", CHANGED_VFO},                                                    \
+    {"IF", CHANGED_FREQ_A | CHANGED_FREQ_B | CHANGED_MODE | CHANGED_VFO |   \
+           CHANGED_RIT | CHANGED_PTT} }
+
+// Kenwood IF: frequency, 5 spaces, RIT offset, RIT, XIT, memory channel,
+// TX, mode, VFO, scan, split, tone, tone number, shift
+#define KENWOOD_IF "F     ORX000TMV000000"
+
+// FT-991A: HF to 70 cm, the first radio emulated; its IF layout and mode
+// numbers in IF are kept as they were
+const CATModel CAT_FT991A PROGMEM = {
+    "ft-991a",
+    "Yaesu FT-991A CAT Emulator",
+    "0670",
+    &CAT_YAESU_COMMANDS,
+    FREQ_MIN, FREQ_MAX,
+    38400,
+    1035,
+    9,
+    "FO0N0000000000",
+    "",
+    "0123456789ABCDE",
+    true,
+    YAESU_REPORTS
+};
+
+// FTdx10: HF/6m/4m, IF and OI as memory channel, frequency, clarifier,
+// mode and VFO/memory fields; no C4FM, and its menu is not kept
+const CATModel CAT_FTDX10 PROGMEM = {
+    "ftdx10",
+    "Yaesu FTdx10 CAT Emulator",
+    "0761",
+    &CAT_YAESU_COMMANDS,
+    30000UL, 75000000UL,
+    38400,
+    1042,
+    9,
+    "CFORXM00000",
+    "CFORXM00000",
+    "0123456789ABCD4",
+    false,
+    YAESU_REPORTS
+};
+
+// Kenwood modes: 1 LSB, 2 USB, 3 CW, 4 FM, 5 AM, 6 FSK, 7 CW-R, 9 FSK-R;
+// data modes read as their base mode
+const CATModel CAT_TS590 PROGMEM = {
+    "ts-590",
+    "Kenwood TS-590S CAT Emulator",
+    "021",
+    &CAT_KENWOOD_COMMANDS,
+    30000UL, 60000000UL,
+    9600,
+    2031,
+    11,
+    KENWOOD_IF,
+    "",
+    "012345671944254",
+    false,
+    KENWOOD_REPORTS
+};
+
+// TS-2000: HF to 70 cm (the 23 cm module is not emulated)
+const CATModel CAT_TS2000 PROGMEM = {
+    "ts-2000",
+    "Kenwood TS-2000 CAT Emulator",
+    "019",
+    &CAT_KENWOOD_COMMANDS,
+    30000UL, 450000000UL,
+    9600,
+    2014,
+    11,
+    KENWOOD_IF,
+    "",
+    "012345671944254",
+    false,
+    KENWOOD_REPORTS
+};
+
+// K3: HF and 6 m; Kenwood-style commands with its own ranges, and modes
+// 6 DATA and 9 DATA-REV in place of FSK
+const CATModel CAT_K3 PROGMEM = {
+    "k3",
+    "Elecraft K3 CAT Emulator",
+    "017",
+    &CAT_ELECRAFT_COMMANDS,
+    500000UL, 54000000UL,
+    38400,
+    2029,
+    11,
+    "F     ORX 00TMV00001 ",
+    "",
+    "012345679944654",
+    false,
+    KENWOOD_REPORTS
+};
+
+const CATModel* const CAT_MODELS[CAT_MODEL_COUNT] PROGMEM = {
+    &CAT_FT991A, &CAT_FTDX10, &CAT_TS590, &CAT_TS2000, &CAT_K3
+};
+
+const CATModel* findCATModel(const char* typeName) {
+    for (size_t i = 0; i < CAT_MODEL_COUNT; i++) {
+        const CATModel* model = (const CATModel*)pgm_read_ptr(&CAT_MODELS[i]);
+        if (strcasecmp((const char*)pgm_read_ptr(&model->typeName), typeName) == 0) {
+            return model;
+        }
+    }
+    return nullptr;
+}
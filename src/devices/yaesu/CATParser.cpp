@@ -2,406 +2,1121 @@
 // SPDX-License-Identifier: MIT
 
 #include "CATParser.h"
-#include <stdio.h>
+#include "core/FixedWriter.h"
+#include <stddef.h>
 #include <string.h>
 #include <ctype.h>
 
-CATParser::CATParser(YaesuState& state, ISerialPort& serial)
-    : _state(state)
+CATParser::CATParser(const CATModel& model, YaesuState& state, ISerialPort& serial,
+                     YaesuReplyCache* cache, YaesuMemory* memory, YaesuBandMap* bandMap)
+    : _model(model)
+    , _state(state)
     , _serial(serial)
+    , _cache(cache)
+    , _memory(memory)
+    , _bandMap(bandMap)
     , _logger(nullptr)
-    , _bufLen(0)
+    , _replies(nullptr)
+    , _replyClass(ReplyClass::READ)
+    , _arrivalUs(0)
+    , _replied(false)
+    , _autoInfo(false)
+    , _pendingChanges(0)
+    , _lastAutoInfo(0)
 {
-    memset(_buffer, 0, sizeof(_buffer));
+    memset(&_replyStats, 0, sizeof(_replyStats));
+    reset();
 }
 
 void CATParser::reset() {
-    _bufLen = 0;
-    memset(_buffer, 0, sizeof(_buffer));
+    _opcodeLen = 0;
+    _command = nullptr;
+    _numberAt = 0;
+    memset(&_params, 0, sizeof(_params));
+    _params.numeric = true;
 }
 
+// Commands are parsed as the bytes arrive: the opcode is looked up at its
+// second character and the number is accumulated digit by digit, so the
+// terminator only has to dispatch. Nothing is buffered, and a command of
+// any length is consumed up to its terminator. Replies are collected and
+// sent in one write once the input is drained, together with any delayed
+// replies that have come due.
 bool CATParser::update() {
     bool commandProcessed = false;
+    uint8_t chunk[SERIAL_RX_CHUNK_SIZE];
+    size_t count;
 
-    while (_serial.available()) {
-        char c = _serial.read();
+    char staged[REPLY_BATCH_SIZE];
+    ReplyBatch replies(_serial, staged, sizeof(staged), _replyStats);
+    _replies = &replies;
 
-        // Check for terminator
-        if (c == CAT_TERMINATOR) {
-            _buffer[_bufLen] = '\0';
-            if (_bufLen > 0) {
-                processCommand();
-                commandProcessed = true;
+    _arrivalUs = micros();
+    _delay.release(replies, _arrivalUs, (size_t)_serial.availableForWrite());
+
+    while ((count = _serial.readAvailable(chunk, sizeof(chunk))) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            char c = (char)chunk[i];
+
+            // Check for terminator
+            if (c == CAT_TERMINATOR) {
+                if (_opcodeLen > 0) {
+                    processCommand();
+                    commandProcessed = true;
+                }
+                reset();
+                continue;
+            }
+
+            // Skip control characters
+            if (c < 32) {
+                continue;
+            }
+
+            c = toupper(c);
+            if (_opcodeLen < 2) {
+                _opcode[_opcodeLen++] = c;
+                if (_opcodeLen == 2) {
+                    _command = findCommand(_opcode[0], _opcode[1], _row) ? &_row : nullptr;
+                    _numberAt = (_command != nullptr) ? _command->select : 0;
+                }
+            } else {
+                receiveParam(c);
             }
-            _bufLen = 0;
-            continue;
         }
+    }
+
+    replies.flush();
+    _replies = nullptr;
+
+    return commandProcessed;
+}
+
+void CATParser::receiveParam(char c) {
+    uint8_t index = _params.len;
+    if (_params.len < 255) {
+        _params.len++;
+    }
+    if (index == 0) {
+        _params.first = c;
+    }
+    _params.tail[index % YAESU_TAG_LEN] = c;
+
+    // Unknown commands carry no number
+    if (_command == nullptr) {
+        return;
+    }
 
-        // Skip control characters
-        if (c < 32) {
-            continue;
+    if (index < _command->select) {
+        if (c >= '0' && c <= '9') {
+            _params.selector = _params.selector * 10 + (uint8_t)(c - '0');
         }
+        return;
+    }
 
-        // Add to buffer if space available
-        if (_bufLen < CAT_BUFFER_SIZE - 1) {
-            _buffer[_bufLen++] = toupper(c);
-        } else {
-            // Buffer overflow, reset
-            if (_logger) {
-                _logger->logf(LogLevel::WARN, "CAT", "Buffer overflow, resetting");
+    if (c >= '0' && c <= '9') {
+        // Digits past the longest set form are never used, stop before
+        // they could overflow. An 11-digit frequency fits, its leading
+        // digits are zeros; a number that does not fit is not a number.
+        if (_params.numeric && index < _command->setParams) {
+            if (_params.value > (0xFFFFFFFFUL - 9) / 10) {
+                _params.numeric = false;
+                return;
             }
-            _bufLen = 0;
+            _params.value = _params.value * 10 + (uint8_t)(c - '0');
+            _params.digits++;
         }
+    } else if (index == _numberAt && c == ' ') {
+        // Leading spaces are skipped, as atoi does
+        _numberAt++;
+    } else if (index == _numberAt && (c == '-' || c == '+')) {
+        _params.negative = (c == '-');
+    } else {
+        _params.numeric = false;
     }
+}
 
-    return commandProcessed;
+// Row of a command bound to a YaesuState member, served by readField()
+// and setField(): select selector characters, then digits of value
+#define CAT_FIELD(opcode, select, member, digits, min, max, change) \
+    { opcode, select, (uint8_t)((select) + (digits) + ((min) < 0)), select, \
+      &CATParser::readField, &CATParser::setField, \
+      { offsetof(YaesuState, member), sizeof(((YaesuState*)nullptr)->member), 1, \
+        digits, min, max, change } }
+
+// As CAT_FIELD for an array member, indexed by the selector value
+#define CAT_FIELD_ARRAY(opcode, select, member, digits, min, max, change) \
+    { opcode, select, (uint8_t)((select) + (digits) + ((min) < 0)), select, \
+      &CATParser::readField, &CATParser::setField, \
+      { offsetof(YaesuState, member), sizeof(((YaesuState*)nullptr)->member[0]), \
+        sizeof(((YaesuState*)nullptr)->member) / sizeof(((YaesuState*)nullptr)->member[0]), \
+        digits, min, max, change } }
+
+// S-meter row: select selector characters (read back as zeros), then the
+// reading scaled from 0-255 to 0-max, digits wide
+#define CAT_SMETER(select, digits, max) \
+    { "SM", select, 0, select, &CATParser::readSM, nullptr, \
+      { offsetof(YaesuState, smeter), 1, 1, digits, 0, max, CHANGED_SMETER } }
+
+static_assert(sizeof(YaesuState) < 256, "Field offsets are one byte");
+
+// Command tables
+// One table per dialect, one row per opcode; models of a dialect share its
+// table (CATModel::commands) and differ only in their descriptor. Commands
+// that only read or set a state value are described by a CAT_FIELD row and
+// need no code of their own; the others name their handlers. The rows and
+// the opcode index below are generated by the compiler and kept in flash,
+// so a new command only needs a row here and costs no RAM.
+
+// Yaesu: FT-991A, FTdx10
+struct CATParser::YaesuRows {
+    static constexpr Command COMMANDS[] = {
+        // opcode read set  select  read handler          set handler          field
+        { "AB",  0,   0,   0,      &CATParser::doAB,     nullptr,             {} },
+        CAT_FIELD("AC", 2, tuner, 1, 0, 2, CHANGED_SETTINGS),
+        CAT_FIELD("AG", 1, afGain, 3, 0, 255, CHANGED_LEVELS),
+        { "AI",  0,   1,   0,      &CATParser::readAI,   &CATParser::setAI,   {} },
+        { "AM",  0,   0,   0,      &CATParser::doAM,     nullptr,             {} },
+        { "BA",  0,   0,   0,      &CATParser::doBA,     nullptr,             {} },
+        CAT_FIELD("BC", 1, beatCancel, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("BI", 0, breakIn, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD_ARRAY("BP", 2, notch, 3, 0, 320, CHANGED_SETTINGS),
+        { "BS",  0,   2,   0,      nullptr,              &CATParser::setBS,   {} },
+        CAT_FIELD_ARRAY("CN", 2, toneNumber, 3, 0, 103, CHANGED_SETTINGS),
+        CAT_FIELD_ARRAY("CO", 2, contour, 4, 0, 3200, CHANGED_SETTINGS),
+        CAT_FIELD("CT", 1, ctcssMode, 1, 0, 3, CHANGED_SETTINGS),
+        { "EX",  3,   7,   3,      &CATParser::readEX,   &CATParser::setEX,   {} },
+        { "FA",  0,   9,   0,      &CATParser::readFA,   &CATParser::setFA,   {} },
+        { "FB",  0,   9,   0,      &CATParser::readFB,   &CATParser::setFB,   {} },
+        CAT_FIELD("FS", 0, fastStep, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("GT", 1, agc, 1, 0, 6, CHANGED_SETTINGS),
+        { "ID",  0,   0,   0,      &CATParser::readID,   nullptr,             {} },
+        { "IF",  0,   0,   0,      &CATParser::readIF,   nullptr,             {} },
+        CAT_FIELD("IS", 1, ifShift, 4, -1200, 1200, CHANGED_SETTINGS),
+        CAT_FIELD("KP", 0, keyPitch, 2, 0, 75, CHANGED_SETTINGS),
+        CAT_FIELD("KR", 0, keyer, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("KS", 0, keySpeed, 3, 4, 60, CHANGED_SETTINGS),
+        CAT_FIELD("LK", 0, lock, 1, 0, 1, CHANGED_SETTINGS),
+        { "MD",  1,   2,   1,      &CATParser::readMD,   &CATParser::setMD,   {} },
+        { "MA",  0,   0,   0,      &CATParser::doMA,     nullptr,             {} },
+        { "MC",  0,   3,   0,      &CATParser::readMC,   &CATParser::setMC,   {} },
+        CAT_FIELD("MG", 0, micGain, 3, 0, 100, CHANGED_SETTINGS),
+        CAT_FIELD_ARRAY("ML", 1, monitor, 3, 0, 100, CHANGED_SETTINGS),
+        { "MR",  3,   0,   3,      &CATParser::readMR,   nullptr,             {} },
+        CAT_FIELD("MS", 0, meterSelect, 1, 0, 5, CHANGED_SETTINGS),
+        { "MT",  3,   37,  3,      &CATParser::readMT,   &CATParser::setMT,   {} },
+        { "MW",  0,   25,  3,      nullptr,              &CATParser::setMW,   {} },
+        CAT_FIELD("NA", 1, narrow, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("NB", 1, noiseBlanker, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("NL", 1, nbLevel, 3, 0, 10, CHANGED_SETTINGS),
+        CAT_FIELD("NR", 1, noiseReduction, 1, 0, 1, CHANGED_SETTINGS),
+        { "OI",  0,   0,   0,      &CATParser::readOI,   nullptr,             {} },
+        CAT_FIELD("OS", 1, rptOffset, 1, 0, 3, CHANGED_SETTINGS),
+        CAT_FIELD("PA", 1, preamp, 1, 0, 2, CHANGED_SETTINGS),
+        CAT_FIELD("PC", 0, txPower, 3, 5, 100, CHANGED_SETTINGS),
+        CAT_FIELD("PL", 0, procLevel, 3, 0, 100, CHANGED_SETTINGS),
+        CAT_FIELD_ARRAY("PR", 1, processor, 1, 0, 2, CHANGED_SETTINGS),
+        CAT_FIELD("PS", 0, powerOn, 1, 0, 1, CHANGED_POWER),
+        CAT_FIELD("RA", 1, attenuator, 1, 0, 1, CHANGED_SETTINGS),
+        { "RC",  0,   0,   0,      &CATParser::doRC,     nullptr,             {} },
+        { "RD",  0,   4,   0,      &CATParser::stepRD,   &CATParser::setRD,   {} },
+        CAT_FIELD("RG", 1, rfGain, 3, 0, 255, CHANGED_LEVELS),
+        CAT_FIELD("RI", 0, ritOn, 1, 0, 1, CHANGED_RIT),
+        CAT_FIELD("RL", 1, nrLevel, 2, 1, 15, CHANGED_SETTINGS),
+        { "RM",  1,   0,   0,      &CATParser::readRM,   nullptr,             {} },
+        { "RU",  0,   4,   0,      &CATParser::stepRU,   &CATParser::setRU,   {} },
+        { "RX",  0,   0,   0,      &CATParser::doRX,     nullptr,             {} },
+        CAT_FIELD("SD", 0, breakInDelay, 4, 30, 3000, CHANGED_SETTINGS),
+        CAT_FIELD("SH", 1, width, 2, 0, 21, CHANGED_SETTINGS),
+        CAT_SMETER(1, 3, 255),
+        CAT_FIELD("SQ", 1, squelch, 3, 0, 100, CHANGED_LEVELS),
+        { "SV",  0,   0,   0,      &CATParser::doSV,     nullptr,             {} },
+        { "TX",  0,   1,   0,      &CATParser::readTX,   &CATParser::setTX,   {} },
+        CAT_FIELD("VD", 0, voxDelay, 4, 30, 3000, CHANGED_SETTINGS),
+        CAT_FIELD("VG", 0, voxGain, 3, 0, 100, CHANGED_SETTINGS),
+        { "VS",  0,   1,   0,      &CATParser::readVS,   &CATParser::setVS,   {} },
+        CAT_FIELD("VX", 0, vox, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("XT", 0, xitOn, 1, 0, 1, CHANGED_XIT),
+    };
+};
+
+// Kenwood: TS-590, TS-2000
+// 11-digit frequencies, MDn without a receiver digit, FR for the VFO and
+// TX; to transmit
+struct CATParser::KenwoodRows {
+    static constexpr Command COMMANDS[] = {
+        // opcode read set  select  read handler          set handler          field
+        CAT_FIELD("AG", 1, afGain, 3, 0, 255, CHANGED_LEVELS),
+        { "AI",  0,   1,   0,      &CATParser::readAI,   &CATParser::setAI,   {} },
+        CAT_FIELD("BC", 0, beatCancel, 1, 0, 2, CHANGED_SETTINGS),
+        { "FA",  0,   11,  0,      &CATParser::readFA,   &CATParser::setFA,   {} },
+        { "FB",  0,   11,  0,      &CATParser::readFB,   &CATParser::setFB,   {} },
+        { "FR",  0,   1,   0,      &CATParser::readVS,   &CATParser::setVS,   {} },
+        CAT_FIELD("GT", 0, agc, 3, 0, 20, CHANGED_SETTINGS),
+        { "ID",  0,   0,   0,      &CATParser::readID,   nullptr,             {} },
+        { "IF",  0,   0,   0,      &CATParser::readIF,   nullptr,             {} },
+        CAT_FIELD("KS", 0, keySpeed, 3, 10, 60, CHANGED_SETTINGS),
+        { "MD",  0,   1,   0,      &CATParser::readMD,   &CATParser::setMD,   {} },
+        CAT_FIELD("MG", 0, micGain, 3, 0, 100, CHANGED_SETTINGS),
+        CAT_FIELD("NB", 0, noiseBlanker, 1, 0, 2, CHANGED_SETTINGS),
+        CAT_FIELD("NR", 0, noiseReduction, 1, 0, 2, CHANGED_SETTINGS),
+        CAT_FIELD("PA", 0, preamp, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("PC", 0, txPower, 3, 5, 100, CHANGED_SETTINGS),
+        CAT_FIELD("PS", 0, powerOn, 1, 0, 1, CHANGED_POWER),
+        CAT_FIELD("RA", 0, attenuator, 2, 0, 1, CHANGED_SETTINGS),
+        { "RC",  0,   0,   0,      &CATParser::doRC,     nullptr,             {} },
+        { "RD",  0,   0,   0,      &CATParser::stepRD,   nullptr,             {} },
+        CAT_FIELD("RG", 0, rfGain, 3, 0, 255, CHANGED_LEVELS),
+        CAT_FIELD("RT", 0, ritOn, 1, 0, 1, CHANGED_RIT),
+        { "RU",  0,   0,   0,      &CATParser::stepRU,   nullptr,             {} },
+        { "RX",  0,   0,   0,      &CATParser::doRX,     nullptr,             {} },
+        CAT_SMETER(1, 4, 30),
+        CAT_FIELD("SQ", 1, squelch, 3, 0, 255, CHANGED_LEVELS),
+        { "TX",  0,   1,   0,      &CATParser::doTX,     &CATParser::doTX,    {} },
+        CAT_FIELD("VX", 0, vox, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("XT", 0, xitOn, 1, 0, 1, CHANGED_XIT),
+    };
+};
+
+// Elecraft: K3
+// The Kenwood command set, with no receiver digit in AG, SQ and SM and the
+// K3's own ranges
+struct CATParser::ElecraftRows {
+    static constexpr Command COMMANDS[] = {
+        // opcode read set  select  read handler          set handler          field
+        CAT_FIELD("AG", 0, afGain, 3, 0, 250, CHANGED_LEVELS),
+        { "AI",  0,   1,   0,      &CATParser::readAI,   &CATParser::setAI,   {} },
+        { "FA",  0,   11,  0,      &CATParser::readFA,   &CATParser::setFA,   {} },
+        { "FB",  0,   11,  0,      &CATParser::readFB,   &CATParser::setFB,   {} },
+        { "FR",  0,   1,   0,      &CATParser::readVS,   &CATParser::setVS,   {} },
+        { "ID",  0,   0,   0,      &CATParser::readID,   nullptr,             {} },
+        { "IF",  0,   0,   0,      &CATParser::readIF,   nullptr,             {} },
+        CAT_FIELD("KS", 0, keySpeed, 3, 8, 50, CHANGED_SETTINGS),
+        { "MD",  0,   1,   0,      &CATParser::readMD,   &CATParser::setMD,   {} },
+        CAT_FIELD("MG", 0, micGain, 3, 0, 60, CHANGED_SETTINGS),
+        CAT_FIELD("NB", 0, noiseBlanker, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("PA", 0, preamp, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("PC", 0, txPower, 3, 0, 110, CHANGED_SETTINGS),
+        CAT_FIELD("PS", 0, powerOn, 1, 0, 1, CHANGED_POWER),
+        CAT_FIELD("RA", 0, attenuator, 2, 0, 1, CHANGED_SETTINGS),
+        { "RC",  0,   0,   0,      &CATParser::doRC,     nullptr,             {} },
+        { "RD",  0,   0,   0,      &CATParser::stepRD,   nullptr,             {} },
+        CAT_FIELD("RG", 0, rfGain, 3, 0, 250, CHANGED_LEVELS),
+        CAT_FIELD("RT", 0, ritOn, 1, 0, 1, CHANGED_RIT),
+        { "RU",  0,   0,   0,      &CATParser::stepRU,   nullptr,             {} },
+        { "RX",  0,   0,   0,      &CATParser::doRX,     nullptr,             {} },
+        CAT_SMETER(0, 4, 21),
+        CAT_FIELD("SQ", 0, squelch, 3, 0, 29, CHANGED_LEVELS),
+        { "TX",  0,   0,   0,      &CATParser::doTX,     nullptr,             {} },
+        CAT_FIELD("VX", 0, vox, 1, 0, 1, CHANGED_SETTINGS),
+        CAT_FIELD("XT", 0, xitOn, 1, 0, 1, CHANGED_XIT),
+    };
+};
+
+// Opcodes are two letters, so AA..ZZ index a dense table directly
+static constexpr size_t CAT_KEY_COUNT = 26 * 26;
+
+static constexpr size_t catKey(char first, char second) {
+    return (size_t)(first - 'A') * 26 + (size_t)(second - 'A');
+}
+
+// Indices 0..N-1 as a parameter pack, built up by doubling so template
+// depth stays logarithmic
+template <size_t... I> struct CATKeys {};
+
+template <typename A, typename B> struct CATJoin;
+template <size_t... I, size_t... J> struct CATJoin<CATKeys<I...>, CATKeys<J...> > {
+    typedef CATKeys<I..., (sizeof...(I) + J)...> type;
+};
+
+template <size_t N> struct CATKeyRange {
+    typedef typename CATJoin<typename CATKeyRange<N / 2>::type,
+                             typename CATKeyRange<N - N / 2>::type>::type type;
+};
+template <> struct CATKeyRange<0> { typedef CATKeys<> type; };
+template <> struct CATKeyRange<1> { typedef CATKeys<0> type; };
+
+template <typename Rows>
+struct CATParser::Table {
+    static constexpr size_t COUNT = sizeof(Rows::COMMANDS) / sizeof(Rows::COMMANDS[0]);
+    static_assert(COUNT < 255, "Command rows must fit the one-byte opcode index");
+
+    // Row of the command with a key, plus one (0 = no such command)
+    static constexpr uint8_t slotOf(size_t key, size_t row = 0) {
+        return (row == COUNT) ? 0
+             : (catKey(Rows::COMMANDS[row].opcode[0], Rows::COMMANDS[row].opcode[1]) == key)
+               ? (uint8_t)(row + 1)
+             : slotOf(key, row + 1);
+    }
+
+    // Opcode index: one byte per key, computed at compile time and kept in
+    // flash
+    struct Slots {
+        uint8_t slot[CAT_KEY_COUNT];
+    };
+
+    // The rows, copied into flash the same way
+    struct Block {
+        Command row[COUNT];
+    };
+
+    template <size_t... I>
+    static constexpr Slots buildSlots(CATKeys<I...>) {
+        return Slots{{ slotOf(I)... }};
+    }
+
+    template <size_t... I>
+    static constexpr Block buildRows(CATKeys<I...>) {
+        return Block{{ Rows::COMMANDS[I]... }};
+    }
+
+    static const Slots SLOTS;
+    static const Block ROWS;
+};
+
+template <typename Rows>
+const typename CATParser::Table<Rows>::Slots CATParser::Table<Rows>::SLOTS PROGMEM =
+    CATParser::Table<Rows>::buildSlots(typename CATKeyRange<CAT_KEY_COUNT>::type());
+
+template <typename Rows>
+const typename CATParser::Table<Rows>::Block CATParser::Table<Rows>::ROWS PROGMEM =
+    CATParser::Table<Rows>::buildRows(typename CATKeyRange<CATParser::Table<Rows>::COUNT>::type());
+
+struct CATCommandSet {
+    const uint8_t* slots;               // Opcode index, CAT_KEY_COUNT bytes
+    const CATParser::Command* rows;
+};
+
+const CATCommandSet CAT_YAESU_COMMANDS PROGMEM = {
+    CATParser::Table<CATParser::YaesuRows>::SLOTS.slot,
+    CATParser::Table<CATParser::YaesuRows>::ROWS.row
+};
+
+const CATCommandSet CAT_KENWOOD_COMMANDS PROGMEM = {
+    CATParser::Table<CATParser::KenwoodRows>::SLOTS.slot,
+    CATParser::Table<CATParser::KenwoodRows>::ROWS.row
+};
+
+const CATCommandSet CAT_ELECRAFT_COMMANDS PROGMEM = {
+    CATParser::Table<CATParser::ElecraftRows>::SLOTS.slot,
+    CATParser::Table<CATParser::ElecraftRows>::ROWS.row
+};
+
+bool CATParser::findCommand(char first, char second, Command& row) const {
+    if (first < 'A' || first > 'Z' || second < 'A' || second > 'Z') {
+        return false;
+    }
+    const uint8_t* slots = (const uint8_t*)pgm_read_ptr(&_model.commands->slots);
+    uint8_t slot = pgm_read_byte(&slots[catKey(first, second)]);
+    if (slot == 0) {
+        return false;
+    }
+    const Command* rows = (const Command*)pgm_read_ptr(&_model.commands->rows);
+    memcpy_P(&row, &rows[slot - 1], sizeof(row));
+    return true;
 }
 
 void CATParser::processCommand() {
-    if (_bufLen < 2) {
+    if (_opcodeLen < 2) {
         if (_logger) {
-            _logger->logf(LogLevel::DEBUG, "CAT", "Command too short: '%s'", _buffer);
+            _logger->logf(LogLevel::DEBUG, "CAT", "Command too short: '%.*s'", (int)_opcodeLen, _opcode);
         }
         return;
     }
 
-    // Extract 2-character command
-    char cmd[3] = {_buffer[0], _buffer[1], '\0'};
-    const char* params = (_bufLen > 2) ? &_buffer[2] : "";
-
     if (_logger) {
-        _logger->logf(LogLevel::DEBUG, "CAT", "CMD: %s PARAMS: '%s'", cmd, params);
+        _logger->logf(LogLevel::DEBUG, "CAT", "CMD: %.2s PARAMS: %u", _opcode, (unsigned)_params.len);
     }
 
-    bool handled = false;
+    if (_command == nullptr) {
+        if (_logger) {
+            _logger->logf(LogLevel::WARN, "CAT", "Unknown command: %.2s", _opcode);
+        }
+        return;
+    }
 
-    // Dispatch to handlers
-    if (strcmp(cmd, "FA") == 0) handled = handleFA(params);
-    else if (strcmp(cmd, "FB") == 0) handled = handleFB(params);
-    else if (strcmp(cmd, "IF") == 0) handled = handleIF(params);
-    else if (strcmp(cmd, "ID") == 0) handled = handleID(params);
-    else if (strcmp(cmd, "MD") == 0) handled = handleMD(params);
-    else if (strcmp(cmd, "PS") == 0) handled = handlePS(params);
-    else if (strcmp(cmd, "SM") == 0) handled = handleSM(params);
-    else if (strcmp(cmd, "TX") == 0) handled = handleTX(params);
-    else if (strcmp(cmd, "RX") == 0) handled = handleRX(params);
-    else if (strcmp(cmd, "VS") == 0) handled = handleVS(params);
-    else if (strcmp(cmd, "RI") == 0) handled = handleRI(params);
-    else if (strcmp(cmd, "XT") == 0) handled = handleXT(params);
-    else if (strcmp(cmd, "RD") == 0) handled = handleRD(params);
-    else if (strcmp(cmd, "RU") == 0) handled = handleRU(params);
-    else if (strcmp(cmd, "AG") == 0) handled = handleAG(params);
-    else if (strcmp(cmd, "RG") == 0) handled = handleRG(params);
-    else if (strcmp(cmd, "SQ") == 0) handled = handleSQ(params);
-    else if (strcmp(cmd, "RM") == 0) handled = handleRM(params);
+    Handler handler = nullptr;
+    bool isSet = false;
+    if (_params.len <= _command->readParams) {
+        handler = _command->read;
+    } else if (_params.len <= _command->setParams) {
+        handler = _command->set;
+        isSet = true;
+    }
 
-    if (!handled && _logger) {
-        _logger->logf(LogLevel::WARN, "CAT", "Unknown command: %s", cmd);
+    if (handler != nullptr) {
+        _replyClass = ReplyClass::READ;
+        _replied = false;
+        (this->*handler)(_params);
+        // A set that did not answer keeps the radio busy; a read that
+        // did not (an empty memory channel) does not
+        if (isSet && !_replied && _delay.isEnabled()) {
+            _delay.hold(ReplyClass::SET, _arrivalUs);
+        }
+        // A command that tuned the radio moves the S-meter before the
+        // next command (usually SM0;) is read; otherwise this is a
+        // comparison of the last frequency and mode
+        if (_bandMap != nullptr) {
+            _bandMap->retune(_state);
+        }
+    } else if (_logger) {
+        _logger->logf(LogLevel::WARN, "CAT", "Bad parameters for %.2s: %u characters",
+                      _opcode, (unsigned)_params.len);
     }
 }
 
-void CATParser::sendResponse(const char* response) {
-    _serial.print(response);
-    _serial.write(CAT_TERMINATOR);
+// Terminate the response and add it to the replies for this burst
+void CATParser::sendResponse(FixedWriter& response) {
+    response.put(CAT_TERMINATOR);
+    sendReply(response.c_str(), response.length());
+}
 
-    if (_logger) {
-        _logger->logf(LogLevel::DEBUG, "CAT", "RSP: %s;", response);
+void CATParser::sendResponse(FixedWriter& response, CachedReply reply) {
+    response.put(CAT_TERMINATOR);
+    if (_cache != nullptr) {
+        _cache->store(reply, response.c_str(), response.length());
     }
+    sendReply(response.c_str(), response.length());
 }
 
-// Format frequency as 9-digit string (Hz)
-void CATParser::formatFrequency(char* buf, uint32_t freq) {
-    snprintf(buf, 10, "%09lu", (unsigned long)freq);
+// A repeated poll of an unchanged value is a copy of the cached text
+bool CATParser::sendCached(CachedReply reply) {
+    if (_cache == nullptr) {
+        return false;
+    }
+    size_t len;
+    const char* text = _cache->find(_state, reply, len);
+    if (text == nullptr) {
+        return false;
+    }
+    sendReply(text, len);
+    return true;
 }
 
-// Parse 9-digit frequency string
-bool CATParser::parseFrequency(const char* str, uint32_t& freq) {
-    if (strlen(str) != 9) {
-        // Try parsing anyway, some clients use shorter strings
+void CATParser::sendReply(const char* text, size_t len) {
+    _replied = true;
+    if (_delay.isEnabled()) {
+        _delay.add(_replyClass, text, len, _arrivalUs);
+    } else if (_replies != nullptr) {
+        _replies->add(text, len);
+    } else {
+        _serial.write((const uint8_t*)text, len);
     }
 
-    char* endptr;
-    unsigned long val = strtoul(str, &endptr, 10);
+    if (_logger) {
+        _logger->logf(LogLevel::DEBUG, "CAT", "RSP: %.*s", (int)len, text);
+    }
+}
 
-    if (*endptr != '\0' && *endptr != CAT_TERMINATOR) {
+// Frequency parameter in Hz, within the model's coverage
+// Normally freqDigits digits, some clients use shorter strings
+bool CATParser::parseFrequency(const Params& params, uint32_t& freq) {
+    if (!params.numeric || params.negative) {
         return false;
     }
 
-    if (val < FREQ_MIN || val > FREQ_MAX) {
+    if (!inCoverage(params.value)) {
         return false;
     }
 
-    freq = (uint32_t)val;
+    freq = params.value;
     return true;
 }
 
-// FA - VFO-A Frequency
-bool CATParser::handleFA(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[16];
-        snprintf(buf, sizeof(buf), "FA%09lu", (unsigned long)_state.freqVfoA);
-        sendResponse(buf);
+// Address of the member a field row is bound to, nullptr if the
+// selector is past the end of an array member
+uint8_t* CATParser::fieldAddress(const Field& field, const Params& params) {
+    uint16_t index = (field.count > 1) ? params.selector : 0;
+    if (index >= field.count) {
+        return nullptr;
+    }
+    return (uint8_t*)&_state + field.offset + index * field.size;
+}
+
+// Generic read: opcode, selector and the member's value ("NA00;")
+// The selector only picks an element of an array member, otherwise it
+// reads back as zeros (the main receiver)
+void CATParser::readField(const Params& params) {
+    const Field& field = _command->field;
+    const uint8_t* address = fieldAddress(field, params);
+    if (address == nullptr) {
+        return;
+    }
+
+    int32_t value;
+    if (field.size == 1) {
+        value = *address;
+    } else if (field.min < 0) {
+        value = *(const int16_t*)address;
     } else {
-        // Set
-        uint32_t freq;
-        if (parseFrequency(params, freq)) {
-            _state.freqVfoA = freq;
-        }
+        value = *(const uint16_t*)address;
     }
-    return true;
+
+    char buf[16];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put(_command->opcode, 2);
+    if (_command->select > 0) {
+        rsp.digits((field.count > 1) ? params.selector : 0, _command->select);
+    }
+    if (field.min < 0) {
+        rsp.put(value < 0 ? '-' : '+');
+        value = (value < 0) ? -value : value;
+    }
+    rsp.digits((uint32_t)value, field.digits);
+    sendResponse(rsp);
 }
 
-// FB - VFO-B Frequency
-bool CATParser::handleFB(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[16];
-        snprintf(buf, sizeof(buf), "FB%09lu", (unsigned long)_state.freqVfoB);
-        sendResponse(buf);
+// Generic set: the value must have the full width, and is clamped to the
+// member's range
+void CATParser::setField(const Params& params) {
+    const Field& field = _command->field;
+    uint8_t* address = fieldAddress(field, params);
+    if (address == nullptr || !params.numeric || params.len != _command->setParams) {
+        return;
+    }
+
+    int32_t value = constrain(params.number(), (int32_t)field.min, (int32_t)field.max);
+    if (field.size == 1) {
+        _state.set(*address, (uint8_t)value, field.change);
+    } else if (field.min < 0) {
+        _state.set(*(int16_t*)address, (int16_t)value, field.change);
     } else {
-        // Set
-        uint32_t freq;
-        if (parseFrequency(params, freq)) {
-            _state.freqVfoB = freq;
-        }
+        _state.set(*(uint16_t*)address, (uint16_t)value, field.change);
     }
-    return true;
 }
 
-// Format IF response string
-// Format: IFaaaaaaaaabbbbcccccddeeeffghijklm
-// aaaa = freq (9 digits), bbbb = ?, ccccc = RIT offset, dd = RIT on, ee = XIT on, etc.
-void CATParser::formatIF(char* buf) {
-    uint32_t freq = _state.getCurrentFreq();
-    int16_t ritOffset = _state.ritOn ? _state.ritOffset : 0;
+// AB - Copy VFO-A to VFO-B
+void CATParser::doAB(const Params& params) {
+    _state.set(_state.freqVfoB, _state.freqVfoA, CHANGED_FREQ_B);
+    _state.set(_state.modeVfoB, _state.modeVfoA, CHANGED_MODE);
+}
 
-    // Build IF response per FT-991A format
-    // Position: 01234567890123456789012345678
-    // Format:   IFnnnnnnnnn+oooo0mm0000000000
-    snprintf(buf, 32, "IF%09lu%+05d0%02d0000000000",
-             (unsigned long)freq,
-             ritOffset,
-             (uint8_t)_state.getCurrentMode());
+// BA - Copy VFO-B to VFO-A
+void CATParser::doBA(const Params& params) {
+    _state.set(_state.freqVfoA, _state.freqVfoB, CHANGED_FREQ_A);
+    _state.set(_state.modeVfoA, _state.modeVfoB, CHANGED_MODE);
 }
 
-// IF - Information
-bool CATParser::handleIF(const char* params) {
-    (void)params;  // IF is read-only
+// SV - Swap VFO-A and VFO-B
+void CATParser::doSV(const Params& params) {
+    uint32_t freqA = _state.freqVfoA;
+    YaesuMode modeA = _state.modeVfoA;
+    _state.set(_state.freqVfoA, _state.freqVfoB, CHANGED_FREQ_A);
+    _state.set(_state.modeVfoA, _state.modeVfoB, CHANGED_MODE);
+    _state.set(_state.freqVfoB, freqA, CHANGED_FREQ_B);
+    _state.set(_state.modeVfoB, modeA, CHANGED_MODE);
+}
 
-    char buf[32];
-    formatIF(buf);
-    sendResponse(buf);
-    return true;
+// BS - Band Select (set only)
+// BSnn; tunes the current VFO to the band's FT8 frequency, 0 = not emulated;
+// bands outside the model's coverage are ignored
+static const uint32_t BAND_FREQS[] PROGMEM = {
+    1840000UL,      // 00 1.8 MHz
+    3573000UL,      // 01 3.5 MHz
+    5357000UL,      // 02 5 MHz
+    7074000UL,      // 03 7 MHz
+    10136000UL,     // 04 10 MHz
+    14074000UL,     // 05 14 MHz
+    18100000UL,     // 06 18 MHz
+    21074000UL,     // 07 21 MHz
+    24915000UL,     // 08 24.5 MHz
+    28074000UL,     // 09 28 MHz
+    50313000UL,     // 10 50 MHz
+    0,              // 11 GEN
+    0,              // 12 MW
+    0,              // 13
+    0,              // 14 AIR
+    144174000UL,    // 15 144 MHz
+    432174000UL,    // 16 430 MHz
+};
+
+#define BAND_COUNT (sizeof(BAND_FREQS) / sizeof(BAND_FREQS[0]))
+
+void CATParser::setBS(const Params& params) {
+    if (!params.numeric || params.len != 2 || params.value >= BAND_COUNT) {
+        return;
+    }
+    uint32_t freq = pgm_read_dword(&BAND_FREQS[params.value]);
+    if (freq != 0 && inCoverage(freq)) {
+        _state.setCurrentFreq(freq);
+    }
 }
 
-// ID - Radio ID
-bool CATParser::handleID(const char* params) {
-    (void)params;  // ID is read-only
+// EX - Menu
+// EXnnn; reads menu item nnn, EXnnnv...; sets it. Only the items in this
+// table are kept; add a row (and raise YAESU_MENU_COUNT) for more. The
+// numbers are the FT-991A's: models without CATModel::hasMenu ignore EX.
+const YaesuMenuItem YAESU_MENU[YAESU_MENU_COUNT] PROGMEM = {
+    // number digits min  max   default
+    {   1,     4,     20, 4000, 300 },    // AGC fast delay, ms
+    {   2,     4,     20, 4000, 700 },    // AGC mid delay, ms
+    {   3,     4,     20, 4000, 3000 },   // AGC slow delay, ms
+    {  31,     1,     0,  3,    3 },      // CAT rate (4800, 9600, 19200, 38400)
+    {  32,     1,     0,  3,    0 },      // CAT time-out timer
+    {  33,     1,     0,  1,    1 },      // CAT RTS
+};
+
+// Index of a menu item, -1 if it is not kept
+int8_t CATParser::findMenuItem(uint16_t number, YaesuMenuItem& item) {
+    for (uint8_t i = 0; i < YAESU_MENU_COUNT; i++) {
+        memcpy_P(&item, &YAESU_MENU[i], sizeof(item));
+        if (item.number == number) {
+            return (int8_t)i;
+        }
+    }
+    return -1;
+}
 
+void CATParser::readEX(const Params& params) {
+    YaesuMenuItem item;
+    int8_t i = findMenuItem(params.selector, item);
+    if (!_model.hasMenu || params.len < 3 || i < 0) {
+        return;
+    }
+    char buf[16];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("EX").digits<3>(params.selector).digits(_state.menu[i], item.digits);
+    sendResponse(rsp);
+}
+
+void CATParser::setEX(const Params& params) {
+    YaesuMenuItem item;
+    int8_t i = findMenuItem(params.selector, item);
+    if (!_model.hasMenu || i < 0 || !params.numeric || params.negative || params.len != 3 + item.digits) {
+        return;
+    }
+    uint16_t value = (uint16_t)constrain(params.value, (uint32_t)item.min, (uint32_t)item.max);
+    _state.set(_state.menu[i], value, CHANGED_SETTINGS);
+}
+
+// AI - Auto-Information
+// AI1; makes the radio report changes without being polled, see autoInfo()
+void CATParser::readAI(const Params& params) {
     char buf[8];
-    snprintf(buf, sizeof(buf), "ID%s", YAESU_RADIO_ID);
-    sendResponse(buf);
-    return true;
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("AI").put(_autoInfo ? '1' : '0');
+    sendResponse(rsp);
 }
 
-// MD - Mode
-bool CATParser::handleMD(const char* params) {
-    if (strlen(params) == 0) {
-        // Read current VFO mode
-        char buf[8];
-        snprintf(buf, sizeof(buf), "MD0%d", (int)_state.getCurrentMode());
-        sendResponse(buf);
-    } else if (strlen(params) >= 2) {
-        // Set: MD0n where 0=main, n=mode
-        int mode = params[1] - '0';
-        if (mode >= 1 && mode <= 14) {
-            _state.setCurrentMode((YaesuMode)mode);
+void CATParser::setAI(const Params& params) {
+    bool on = (params.first != '0');
+    if (on && !_autoInfo) {
+        _pendingChanges = 0;  // Report changes from now on
+    }
+    _autoInfo = on;
+}
+
+void CATParser::autoInfo(uint16_t changes, uint32_t now) {
+    if (!_autoInfo) {
+        return;
+    }
+
+    _pendingChanges |= changes;
+    if (_pendingChanges == 0 || now - _lastAutoInfo < CAT_AI_INTERVAL_MS) {
+        return;
+    }
+
+    uint16_t pending = _pendingChanges;
+    _pendingChanges = 0;
+    _lastAutoInfo = now;
+
+    char staged[REPLY_BATCH_SIZE];
+    ReplyBatch reports(_serial, staged, sizeof(staged), _replyStats);
+    _replies = &reports;
+
+    // Reports are not delayed, but wait behind delayed replies
+    _replyClass = ReplyClass::PUSH;
+    _arrivalUs = micros();
+
+    // The read handlers of the model's rows format the reports; they take
+    // no parameters here. A command may be part received: its row is put
+    // back afterwards.
+    Params none;
+    memset(&none, 0, sizeof(none));
+    const Command* receiving = _command;
+    Command row;
+    _command = &row;
+
+    for (uint8_t i = 0; i < CAT_MAX_REPORTS && _model.reports[i].opcode[0] != '\0'; i++) {
+        const CATReport& report = _model.reports[i];
+        uint16_t changes = report.changes;
+        if ((changes & (CHANGED_FREQ_A | CHANGED_FREQ_B)) == (CHANGED_FREQ_A | CHANGED_FREQ_B)) {
+            changes &= (uint16_t)~(CHANGED_FREQ_A | CHANGED_FREQ_B);
+            changes |= _state.currentFreqChange();
+        }
+        if ((pending & changes) != 0 && findCommand(report.opcode[0], report.opcode[1], row) &&
+            row.read != nullptr) {
+            (this->*row.read)(none);
         }
     }
-    return true;
+
+    _command = receiving;
+    reports.flush();
+    _replies = nullptr;
 }
 
-// PS - Power Status
-bool CATParser::handlePS(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[4];
-        snprintf(buf, sizeof(buf), "PS%d", _state.powerOn ? 1 : 0);
-        sendResponse(buf);
-    } else {
-        // Set
-        _state.powerOn = (params[0] == '1');
+// FA - VFO-A Frequency
+void CATParser::readFA(const Params& params) {
+    if (sendCached(CachedReply::FA)) {
+        return;
+    }
+    char buf[16];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("FA").digits(_state.freqVfoA, _model.freqDigits);
+    sendResponse(rsp, CachedReply::FA);
+}
+
+void CATParser::setFA(const Params& params) {
+    uint32_t freq;
+    if (parseFrequency(params, freq)) {
+        _state.set(_state.freqVfoA, freq, CHANGED_FREQ_A);
     }
+}
+
+// FB - VFO-B Frequency
+void CATParser::readFB(const Params& params) {
+    if (sendCached(CachedReply::FB)) {
+        return;
+    }
+    char buf[16];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("FB").digits(_state.freqVfoB, _model.freqDigits);
+    sendResponse(rsp, CachedReply::FB);
+}
+
+void CATParser::setFB(const Params& params) {
+    uint32_t freq;
+    if (parseFrequency(params, freq)) {
+        _state.set(_state.freqVfoB, freq, CHANGED_FREQ_B);
+    }
+}
+
+// IF and OI fields of one VFO, laid out as the model's layout string
+// says (see CATModel)
+void CATParser::formatInfo(FixedWriter& out, const char* layout, YaesuVFO vfo) {
+    bool vfoA = (vfo == YaesuVFO::VFO_A);
+    YaesuMode mode = vfoA ? _state.modeVfoA : _state.modeVfoB;
+    int16_t ritOffset = _state.ritOn ? _state.ritOffset : 0;
+
+    for (const char* p = layout; *p != '\0'; p++) {
+        switch (*p) {
+            case 'F': out.digits(vfoA ? _state.freqVfoA : _state.freqVfoB, _model.freqDigits); break;
+            case 'C': out.digits<3>(_state.memoryChannel); break;
+            case 'O': out.signedDigits<4>(ritOffset); break;
+            case 'R': out.put(_state.ritOn ? '1' : '0'); break;
+            case 'X': out.put(_state.xitOn ? '1' : '0'); break;
+            case 'M': out.put(modeCode(mode)); break;
+            case 'N': out.digits<2>((uint8_t)mode); break;
+            case 'T': out.put(_state.ptt ? '1' : '0'); break;
+            case 'V': out.put(vfoA ? '0' : '1'); break;
+            default: out.put(*p); break;
+        }
+    }
+}
+
+// IF - Information (read-only), the current VFO
+void CATParser::readIF(const Params& params) {
+    if (sendCached(CachedReply::IF)) {
+        return;
+    }
+    char buf[48];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("IF");
+    formatInfo(rsp, _model.ifLayout, _state.currentVfo);
+    sendResponse(rsp, CachedReply::IF);
+}
+
+// OI - Opposite band Information (read-only), the other VFO
+void CATParser::readOI(const Params& params) {
+    if (_model.oiLayout[0] == '\0') {
+        return;
+    }
+    YaesuVFO other = (_state.currentVfo == YaesuVFO::VFO_A) ? YaesuVFO::VFO_B : YaesuVFO::VFO_A;
+    char buf[48];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("OI");
+    formatInfo(rsp, _model.oiLayout, other);
+    sendResponse(rsp);
+}
+
+// ID - Radio ID (read-only)
+void CATParser::readID(const Params& params) {
+    char buf[12];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("ID").put(_model.id);
+    sendResponse(rsp);
+}
+
+// Memory channels
+// MR, MW and MT carry a channel as
+//   nnn ddddddddd +oooo r x m v c tt s
+// (channel, frequency, clarifier offset, RX and TX clarifier, mode, 0 = VFO
+// / 1 = memory, CTCSS, 00, shift) and MT adds a 12-character tag. Only the
+// frequency, mode and tag are stored; the other fields read as the radio's
+// defaults and are ignored on writes. Empty channels are not answered.
+
+bool CATParser::formatMemory(FixedWriter& out, const char* opcode, uint16_t channel) {
+    uint32_t freq;
+    YaesuMode mode;
+    if (_memory == nullptr || channel > YAESU_MEMORY_CHANNELS ||
+        !_memory->read((uint8_t)channel, freq, mode)) {
+        return false;
+    }
+    out.put(opcode)
+       .digits<3>(channel)
+       .digits<9>(freq)
+       .put("+000000")
+       .put(modeCode(mode))
+       .put("10000");
     return true;
 }
 
-// SM - S-Meter
-bool CATParser::handleSM(const char* params) {
-    // SM0; reads main receiver S-meter
-    // Response: SM0nnn; where nnn = 000-255
-    (void)params;
+// A stored channel the model can tune (channels written by another model
+// may be outside its coverage)
+bool CATParser::readMemory(uint8_t channel, uint32_t& freq, YaesuMode& mode) const {
+    return _memory != nullptr && _memory->read(channel, freq, mode) && inCoverage(freq);
+}
 
+// MA - Memory to VFO-A
+void CATParser::doMA(const Params& params) {
+    uint32_t freq;
+    YaesuMode mode;
+    if (readMemory(_state.memoryChannel, freq, mode)) {
+        _state.set(_state.freqVfoA, freq, CHANGED_FREQ_A);
+        _state.set(_state.modeVfoA, mode, CHANGED_MODE);
+    }
+}
+
+// AM - VFO-A to memory (the current channel)
+void CATParser::doAM(const Params& params) {
+    if (_memory != nullptr) {
+        _memory->write(_state.memoryChannel, _state.freqVfoA, _state.modeVfoA);
+    }
+}
+
+// MC - Memory Channel
+// MCnnn; selects a channel and tunes the current VFO to it
+void CATParser::readMC(const Params& params) {
     char buf[8];
-    snprintf(buf, sizeof(buf), "SM0%03d", _state.smeter);
-    sendResponse(buf);
-    return true;
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("MC").digits<3>(_state.memoryChannel);
+    sendResponse(rsp);
 }
 
-// TX - Transmit
-bool CATParser::handleTX(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[4];
-        snprintf(buf, sizeof(buf), "TX%d", _state.ptt ? 1 : 0);
-        sendResponse(buf);
-    } else {
-        // Set: TX0=off, TX1=on, TX2=tune
-        _state.ptt = (params[0] != '0');
+void CATParser::setMC(const Params& params) {
+    uint32_t freq;
+    YaesuMode mode;
+    if (!params.numeric || params.len != 3 || params.value > YAESU_MEMORY_CHANNELS ||
+        !readMemory((uint8_t)params.value, freq, mode)) {
+        return;
     }
-    return true;
+    _state.setCurrentFreq(freq);
+    _state.setCurrentMode(mode);
+    _state.set(_state.memoryChannel, (uint8_t)params.value, CHANGED_SETTINGS);
 }
 
-// RX - Receive
-bool CATParser::handleRX(const char* params) {
-    (void)params;
-    _state.ptt = false;
-    return true;
+// MR - Memory Read (read-only)
+void CATParser::readMR(const Params& params) {
+    char buf[32];
+    FixedWriter rsp(buf, sizeof(buf));
+    if (formatMemory(rsp, "MR", params.selector)) {
+        sendResponse(rsp);
+    }
 }
 
-// VS - VFO Select
-bool CATParser::handleVS(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[8];
-        snprintf(buf, sizeof(buf), "VS%d", (int)_state.currentVfo);
-        sendResponse(buf);
-    } else {
-        // Set: 0=VFO-A, 1=VFO-B
-        _state.currentVfo = (params[0] == '0') ? YaesuVFO::VFO_A : YaesuVFO::VFO_B;
+// MW - Memory Write (set-only), frequency and mode, within the model's coverage
+void CATParser::setMW(const Params& params) {
+    YaesuMode mode;
+    if (_memory == nullptr || params.len != 25 || params.digits != 9 ||
+        params.selector > YAESU_MEMORY_CHANNELS || !inCoverage(params.value) ||
+        !parseModeCode(params.at(19), mode)) {
+        return;
     }
-    return true;
+    _memory->write((uint8_t)params.selector, params.value, mode);
 }
 
-// RI - RIT On/Off
-bool CATParser::handleRI(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[4];
-        snprintf(buf, sizeof(buf), "RI%d", _state.ritOn ? 1 : 0);
-        sendResponse(buf);
-    } else {
-        // Set
-        _state.ritOn = (params[0] == '1');
+// MT - Memory Tag
+// Read: the MR fields and the tag; set: only the tag (the last 12
+// characters) is taken, the channel is written with MW
+void CATParser::readMT(const Params& params) {
+    char tag[YAESU_TAG_LEN + 1];
+    char buf[48];
+    FixedWriter rsp(buf, sizeof(buf));
+    if (formatMemory(rsp, "MT", params.selector) &&
+        _memory->getTag((uint8_t)params.selector, tag)) {
+        rsp.put(tag, YAESU_TAG_LEN);
+        sendResponse(rsp);
     }
-    return true;
 }
 
-// XT - XIT On/Off
-bool CATParser::handleXT(const char* params) {
-    if (strlen(params) == 0) {
-        // Read
-        char buf[4];
-        snprintf(buf, sizeof(buf), "XT%d", _state.xitOn ? 1 : 0);
-        sendResponse(buf);
-    } else {
-        // Set
-        _state.xitOn = (params[0] == '1');
+void CATParser::setMT(const Params& params) {
+    if (_memory == nullptr || params.len != 37 || params.selector > YAESU_MEMORY_CHANNELS) {
+        return;
     }
-    return true;
+    char tag[YAESU_TAG_LEN];
+    for (uint8_t i = 0; i < YAESU_TAG_LEN; i++) {
+        tag[i] = params.at(25 + i);
+    }
+    _memory->setTag((uint8_t)params.selector, tag);
 }
 
-// RD - RIT Down
-bool CATParser::handleRD(const char* params) {
-    if (strlen(params) >= 4) {
-        // Set absolute offset
-        int16_t offset = atoi(params);
-        _state.ritOffset = constrain(offset, -9999, 9999);
-    } else {
-        // Decrement by default step
-        _state.ritOffset = constrain(_state.ritOffset - 10, -9999, 9999);
+// Mode codes (CATModel::modes): one character, 1-9 and A-E on Yaesu radios
+char CATParser::modeCode(YaesuMode mode) const {
+    uint8_t m = (uint8_t)mode;
+    return (m >= 1 && m <= 14) ? _model.modes[m] : _model.modes[(uint8_t)YaesuMode::MODE_USB];
+}
+
+// The first mode with a code
+bool CATParser::parseModeCode(char code, YaesuMode& mode) const {
+    for (uint8_t m = 1; m <= 14; m++) {
+        if (_model.modes[m] == code) {
+            mode = (YaesuMode)m;
+            return true;
+        }
     }
-    return true;
+    return false;
 }
 
-// RU - RIT Up
-bool CATParser::handleRU(const char* params) {
-    if (strlen(params) >= 4) {
-        // Set absolute offset
-        int16_t offset = atoi(params);
-        _state.ritOffset = constrain(offset, -9999, 9999);
-    } else {
-        // Increment by default step
-        _state.ritOffset = constrain(_state.ritOffset + 10, -9999, 9999);
+// MD - Mode
+// Read: MD0; (or MD;), set: MD0n where 0=main, n=mode code. Kenwood and
+// Elecraft rows have no receiver digit: MD; and MDn.
+void CATParser::readMD(const Params& params) {
+    if (sendCached(CachedReply::MD)) {
+        return;
     }
-    return true;
+    char buf[8];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("MD");
+    if (_command->select > 0) {
+        rsp.digits(0, _command->select);
+    }
+    rsp.put(modeCode(_state.getCurrentMode()));
+    sendResponse(rsp, CachedReply::MD);
 }
 
-// AG - AF Gain
-bool CATParser::handleAG(const char* params) {
-    if (strlen(params) == 0 || strlen(params) == 1) {
-        // Read: AG0; where 0=main
-        char buf[8];
-        snprintf(buf, sizeof(buf), "AG0%03d", _state.afGain);
-        sendResponse(buf);
-    } else if (strlen(params) >= 4) {
-        // Set: AG0nnn
-        int gain = atoi(&params[1]);
-        _state.afGain = constrain(gain, 0, 255);
+void CATParser::setMD(const Params& params) {
+    YaesuMode mode;
+    if (params.len == _command->select + 1 && parseModeCode(params.at(_command->select), mode)) {
+        _state.setCurrentMode(mode);
     }
-    return true;
 }
 
-// RG - RF Gain
-bool CATParser::handleRG(const char* params) {
-    if (strlen(params) == 0 || strlen(params) == 1) {
-        // Read
-        char buf[8];
-        snprintf(buf, sizeof(buf), "RG0%03d", _state.rfGain);
-        sendResponse(buf);
-    } else if (strlen(params) >= 4) {
-        // Set: RG0nnn
-        int gain = atoi(&params[1]);
-        _state.rfGain = constrain(gain, 0, 255);
+// SM - S-Meter
+// SM0; reads main receiver S-meter, SM0nnn; with nnn = 000-255. Other
+// dialects scale the reading (CAT_SMETER row).
+void CATParser::readSM(const Params& params) {
+    if (sendCached(CachedReply::SM)) {
+        return;
     }
-    return true;
+    const Field& field = _command->field;
+    char buf[12];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("SM");
+    if (_command->select > 0) {
+        rsp.digits(0, _command->select);
+    }
+    rsp.digits((uint32_t)_state.smeter * (uint32_t)field.max / 255, field.digits);
+    sendResponse(rsp, CachedReply::SM);
+}
+
+// TX - Transmit
+void CATParser::readTX(const Params& params) {
+    char buf[8];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("TX").put(_state.ptt ? '1' : '0');
+    sendResponse(rsp);
 }
 
-// SQ - Squelch
-bool CATParser::handleSQ(const char* params) {
-    if (strlen(params) == 0 || strlen(params) == 1) {
-        // Read
-        char buf[8];
-        snprintf(buf, sizeof(buf), "SQ0%03d", _state.squelch);
-        sendResponse(buf);
-    } else if (strlen(params) >= 4) {
-        // Set: SQ0nnn
-        int sq = atoi(&params[1]);
-        _state.squelch = constrain(sq, 0, 100);
+void CATParser::setTX(const Params& params) {
+    // TX0=off, TX1=on, TX2=tune
+    _state.set(_state.ptt, params.first != '0', CHANGED_PTT);
+}
+
+// TX; and TXn; (Kenwood) transmit, RX; returns to receive
+void CATParser::doTX(const Params& params) {
+    _state.set(_state.ptt, true, CHANGED_PTT);
+}
+
+// RX - Receive
+void CATParser::doRX(const Params& params) {
+    _state.set(_state.ptt, false, CHANGED_PTT);
+}
+
+// VS - VFO Select
+void CATParser::readVS(const Params& params) {
+    char buf[8];
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put(_command->opcode, 2).number((uint8_t)_state.currentVfo);
+    sendResponse(rsp);
+}
+
+void CATParser::setVS(const Params& params) {
+    // 0=VFO-A, 1=VFO-B
+    YaesuVFO vfo = (params.first == '0') ? YaesuVFO::VFO_A : YaesuVFO::VFO_B;
+    _state.set(_state.currentVfo, vfo, CHANGED_VFO);
+}
+
+// RD - RIT Down
+// RD; steps down, RDnnnn sets the offset
+void CATParser::stepRD(const Params& params) {
+    int16_t offset = constrain(_state.ritOffset - 10, -9999, 9999);
+    _state.set(_state.ritOffset, offset, CHANGED_RIT);
+}
+
+void CATParser::setRD(const Params& params) {
+    if (params.len < 4) {
+        stepRD(params);
+        return;
     }
-    return true;
+    int16_t offset = constrain(params.number(), -9999, 9999);
+    _state.set(_state.ritOffset, offset, CHANGED_RIT);
+}
+
+// RU - RIT Up
+// RU; steps up, RUnnnn sets the offset
+void CATParser::stepRU(const Params& params) {
+    int16_t offset = constrain(_state.ritOffset + 10, -9999, 9999);
+    _state.set(_state.ritOffset, offset, CHANGED_RIT);
+}
+
+void CATParser::setRU(const Params& params) {
+    if (params.len < 4) {
+        stepRU(params);
+        return;
+    }
+    int16_t offset = constrain(params.number(), -9999, 9999);
+    _state.set(_state.ritOffset, offset, CHANGED_RIT);
+}
+
+// RC - RIT clear
+void CATParser::doRC(const Params& params) {
+    _state.set(_state.ritOffset, (int16_t)0, CHANGED_RIT);
 }
 
 // RM - Read Meter
-bool CATParser::handleRM(const char* params) {
-    // RM1; = S-meter, RM2; = Power, RM3; = SWR, etc.
-    int meter = 1;
-    if (strlen(params) >= 1) {
-        meter = params[0] - '0';
+// RM1; = S-meter, RM2; = Power, RM3; = SWR, etc.
+void CATParser::readRM(const Params& params) {
+    char meter = (params.len >= 1) ? params.first : '1';
+    if (meter == '1' && sendCached(CachedReply::RM1)) {
+        return;
     }
 
     uint8_t value = 0;
     switch (meter) {
-        case 1: value = _state.smeter; break;
-        case 2: value = _state.powerMeter; break;
-        case 3: value = _state.swrMeter; break;
-        case 4: value = _state.alcMeter; break;
-        case 5: value = _state.compMeter; break;
+        case '1': value = _state.smeter; break;
+        case '2': value = _state.powerMeter; break;
+        case '3': value = _state.swrMeter; break;
+        case '4': value = _state.alcMeter; break;
+        case '5': value = _state.compMeter; break;
         default: value = 0; break;
     }
 
     char buf[16];
-    snprintf(buf, sizeof(buf), "RM%d%03d", meter, value);
-    sendResponse(buf);
-    return true;
+    FixedWriter rsp(buf, sizeof(buf));
+    rsp.put("RM").put(meter).digits<3>(value);
+    if (meter == '1') {
+        sendResponse(rsp, CachedReply::RM1);
+    } else {
+        sendResponse(rsp);
+    }
 }
@@ -6,16 +6,41 @@
 #include <Arduino.h>
 #include "platform_config.h"
 #include "YaesuState.h"
+#include "CATModel.h"
+#include "YaesuReplyCache.h"
+#include "YaesuMemory.h"
+#include "YaesuBandMap.h"
 #include "ISerialPort.h"
 #include "ILogger.h"
+#include "core/ReplyBatch.h"
+#include "core/ReplyDelay.h"
+
+class FixedWriter;
 
 // CAT command terminator
 #define CAT_TERMINATOR ';'
 
-// Parser for Yaesu CAT commands
+// Shortest time between Auto-Information pushes; changes made in between
+// are sent together in the next push
+#ifndef CAT_AI_INTERVAL_MS
+#define CAT_AI_INTERVAL_MS 100
+#endif
+
+// Parser for ';'-terminated CAT commands (Yaesu, Kenwood, Elecraft)
+// The model picks the dialect's command table and supplies the reply
+// layouts, mode codes and identity; the parsing, handlers and state are
+// shared by every model.
 class CATParser {
 public:
-    CATParser(YaesuState& state, ISerialPort& serial);
+    // model is a RAM copy of a descriptor, kept by the caller;
+    // cache, if given, keeps the replies to frequently polled reads;
+    // memory, if given, serves the memory-channel commands; bandMap, if
+    // given, sets the S-meter for the station tuned by each command
+    CATParser(const CATModel& model, YaesuState& state, ISerialPort& serial,
+              YaesuReplyCache* cache = nullptr, YaesuMemory* memory = nullptr,
+              YaesuBandMap* bandMap = nullptr);
+
+    const CATModel& getModel() const { return _model; }
 
     // Set logger for debug output
     void setLogger(ILogger* logger) { _logger = logger; }
@@ -24,45 +49,188 @@ public:
     // Returns true if a command was processed
     bool update();
 
-    // Reset input buffer
+    // Discard any partly received command
     void reset();
 
+    // Replies sent and the port writes that carried them
+    const ReplyStats& getReplyStats() const { return _replyStats; }
+
+    // Response latency: replies are held back by their command's latency
+    // (ReplyClass::READ) and sets keep the radio busy (ReplyClass::SET)
+    void setLatency(ReplyClass cls, uint16_t latencyMs, uint16_t jitterMs) {
+        _delay.setLatency(cls, latencyMs, jitterMs);
+    }
+    const ReplyDelay& getReplyDelay() const { return _delay; }
+
+    // Auto-Information (AI1;): push reports of state changes to the client
+    // Adds changes (YaesuChange flags) to the pending reports, then sends
+    // them in one write if AI is on and CAT_AI_INTERVAL_MS has passed since
+    // the last push. Reports carry the state at the time they are sent.
+    void autoInfo(uint16_t changes, uint32_t now);
+    bool isAutoInfo() const { return _autoInfo; }
+
+    // Command tables, defined in CATParser.cpp: Table<Rows> compiles the
+    // rows of one dialect into the opcode index and rows of its
+    // CATCommandSet
+    template <typename Rows> struct Table;
+    struct YaesuRows;
+    struct KenwoodRows;
+    struct ElecraftRows;
+
 private:
+    // Parameters of a command, parsed as the characters arrive
+    // The number starts after the command's selector characters and, as
+    // with atoi, stops at the first character that is not a digit
+    struct Params {
+        uint8_t len;         // Parameter characters, saturating at 255
+        char first;          // First parameter character ('1' in "PS1;")
+        bool negative;       // Number had a leading '-'
+        bool numeric;        // Every number character was a digit
+        uint16_t selector;   // Value of the selector digits (1 in "CO01;")
+        uint8_t digits;      // Digits in the number
+        uint32_t value;      // Magnitude of the number
+        char tail[YAESU_TAG_LEN];  // Last characters, at index % YAESU_TAG_LEN
+
+        int32_t number() const { return negative ? -(int32_t)value : (int32_t)value; }
+
+        // Character at index, one of the last YAESU_TAG_LEN received
+        char at(uint8_t index) const { return tail[index % YAESU_TAG_LEN]; }
+    };
+
+    // Command handler, called at the terminator
+    typedef void (CATParser::*Handler)(const Params& params);
+
+    // YaesuState member read and set by readField() and setField()
+    // An array member is indexed by the selector ("CO01;" is contour[1])
+    struct Field {
+        uint8_t offset;      // offsetof(YaesuState, member)
+        uint8_t size;        // Element size, 1 or 2 bytes
+        uint8_t count;       // Elements, 1 if not an array
+        uint8_t digits;      // Width of the value
+        int16_t min;         // Sets are clamped to min..max; if min is
+        int16_t max;         // negative the value carries a sign
+        uint16_t change;     // YaesuChange flag
+    };
+
+    // Command table row
+    // A command with at most readParams parameter characters is a read
+    // (or a bare action such as "RX;"); with up to setParams it is a set
+    struct Command {
+        char opcode[3];
+        uint8_t readParams;  // 0 for "FA;", 1 for "AG0;"
+        uint8_t setParams;   // Longest set form, 0 if none
+        uint8_t select;      // Selector characters before the number (1 for "AG0nnn;")
+        Handler read;        // nullptr if the command cannot be read
+        Handler set;         // nullptr if the command cannot be set
+        Field field;         // Bound member, for readField/setField rows
+    };
+
+    friend struct CATCommandSet;
+
+    const CATModel& _model;
     YaesuState& _state;
     ISerialPort& _serial;
+    YaesuReplyCache* _cache;
+    YaesuMemory* _memory;
+    YaesuBandMap* _bandMap;
     ILogger* _logger;
 
-    char _buffer[CAT_BUFFER_SIZE];
-    size_t _bufLen;
+    // Command being received
+    char _opcode[2];
+    uint8_t _opcodeLen;          // Opcode characters received (0-2)
+    const Command* _command;     // Looked up at the second opcode character
+    Command _row;                // Its table row, copied from flash
+    uint8_t _numberAt;           // Parameter index where the number starts
+    Params _params;
+
+    // Replies to the burst being processed (only set during update())
+    ReplyBatch* _replies;
+    ReplyStats _replyStats;
+
+    // Replies waiting for their latency
+    ReplyDelay _delay;
+    ReplyClass _replyClass;      // Class of the command or report being answered
+    uint32_t _arrivalUs;         // micros() when the input burst was read
+    bool _replied;               // The current command sent a reply
+
+    // Auto-Information mode
+    bool _autoInfo;
+    uint16_t _pendingChanges;    // Changes not yet reported
+    uint32_t _lastAutoInfo;      // millis() of the last push
+
+    // Copy the model's table row of a command, returns false if unknown
+    bool findCommand(char first, char second, Command& row) const;
 
-    // Process a complete command
+    // Take one parameter character of the command being received
+    void receiveParam(char c);
+
+    // Run the received command
     void processCommand();
 
-    // Send response string
-    void sendResponse(const char* response);
-
-    // Command handlers (return true if command was recognized)
-    bool handleFA(const char* params);  // VFO-A frequency
-    bool handleFB(const char* params);  // VFO-B frequency
-    bool handleIF(const char* params);  // Information
-    bool handleID(const char* params);  // Radio ID
-    bool handleMD(const char* params);  // Mode
-    bool handlePS(const char* params);  // Power status
-    bool handleSM(const char* params);  // S-meter
-    bool handleTX(const char* params);  // PTT
-    bool handleRX(const char* params);  // Receive mode
-    bool handleVS(const char* params);  // VFO select
-    bool handleRI(const char* params);  // RIT on/off
-    bool handleXT(const char* params);  // XIT on/off
-    bool handleRD(const char* params);  // RIT down
-    bool handleRU(const char* params);  // RIT up
-    bool handleAG(const char* params);  // AF gain
-    bool handleRG(const char* params);  // RF gain
-    bool handleSQ(const char* params);  // Squelch
-    bool handleRM(const char* params);  // Read meter
+    // Queue a response (opcode and parameters, without the terminator)
+    void sendResponse(FixedWriter& response);
+
+    // Queue a response and keep it in the reply cache
+    void sendResponse(FixedWriter& response, CachedReply reply);
+
+    // Queue the cached reply, returns false if it has to be formatted
+    bool sendCached(CachedReply reply);
+
+    // Queue a terminated reply
+    void sendReply(const char* text, size_t len);
+
+    // Generic handlers for rows bound to a state member
+    void readField(const Params& params);
+    void setField(const Params& params);
+
+    // Command handlers
+    void doAB(const Params& params);     // Copy VFO-A to VFO-B
+    void doBA(const Params& params);     // Copy VFO-B to VFO-A
+    void setBS(const Params& params);    // Band select
+    void readAI(const Params& params);   // Auto-Information
+    void setAI(const Params& params);
+    void readEX(const Params& params);   // Menu
+    void setEX(const Params& params);
+    void readFA(const Params& params);   // VFO-A frequency
+    void setFA(const Params& params);
+    void readFB(const Params& params);   // VFO-B frequency
+    void setFB(const Params& params);
+    void readIF(const Params& params);   // Information
+    void readOI(const Params& params);   // Opposite band information
+    void readID(const Params& params);   // Radio ID
+    void doMA(const Params& params);     // Memory to VFO-A
+    void doAM(const Params& params);     // VFO-A to memory
+    void readMC(const Params& params);   // Memory channel
+    void setMC(const Params& params);
+    void readMR(const Params& params);   // Memory read
+    void setMW(const Params& params);    // Memory write
+    void readMT(const Params& params);   // Memory tag
+    void setMT(const Params& params);
+    void readMD(const Params& params);   // Mode
+    void setMD(const Params& params);
+    void readSM(const Params& params);   // S-meter
+    void doSV(const Params& params);     // Swap VFOs
+    void readTX(const Params& params);   // PTT
+    void setTX(const Params& params);
+    void doTX(const Params& params);     // Transmit (Kenwood)
+    void doRX(const Params& params);     // Receive mode
+    void readVS(const Params& params);   // VFO select (FR on Kenwood)
+    void setVS(const Params& params);
+    void stepRD(const Params& params);   // RIT down
+    void setRD(const Params& params);
+    void stepRU(const Params& params);   // RIT up
+    void setRU(const Params& params);
+    void doRC(const Params& params);     // RIT clear
+    void readRM(const Params& params);   // Read meter
 
     // Utility functions
-    void formatFrequency(char* buf, uint32_t freq);
-    bool parseFrequency(const char* str, uint32_t& freq);
-    void formatIF(char* buf);
+    bool parseFrequency(const Params& params, uint32_t& freq);
+    bool inCoverage(uint32_t freq) const { return freq >= _model.minHz && freq <= _model.maxHz; }
+    bool readMemory(uint8_t channel, uint32_t& freq, YaesuMode& mode) const;
+    void formatInfo(FixedWriter& out, const char* layout, YaesuVFO vfo);
+    char modeCode(YaesuMode mode) const;
+    bool parseModeCode(char code, YaesuMode& mode) const;
+    bool formatMemory(FixedWriter& out, const char* opcode, uint16_t channel);
+    uint8_t* fieldAddress(const Field& field, const Params& params);
+    static int8_t findMenuItem(uint16_t number, YaesuMenuItem& item);
 };
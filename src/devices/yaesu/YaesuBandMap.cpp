@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "YaesuBandMap.h"
+#include "YaesuBandMapData.h"
+
+static_assert(BAND_MAP_COUNT < 0xFFFF, "Band map rows are 16-bit indices");
+
+YaesuBandMap::YaesuBandMap()
+    : _enabled(false)
+    , _floor(0)
+    , _slot(0)
+    , _found(false)
+    , _freq(0)
+    , _mode(YaesuMode::MODE_USB)
+    , _first(0)
+    , _last(0)
+    , _evaluated(0xFF)
+    , _searches(0)
+{
+}
+
+void YaesuBandMap::setEnabled(bool enabled) {
+    _enabled = enabled;
+    _found = false;
+}
+
+void YaesuBandMap::setFloor(uint8_t level) {
+    _floor = level;
+    _evaluated = 0xFF;
+}
+
+size_t YaesuBandMap::getStationCount() {
+    return BAND_MAP_COUNT;
+}
+
+// Sideband modes hear 300-2700 Hz from the carrier, CW 500 Hz around
+// the dial; AM and FM are centred
+void YaesuBandMap::passband(YaesuMode mode, uint32_t freq, uint32_t& low, uint32_t& high) {
+    switch (mode) {
+        case YaesuMode::MODE_USB:
+        case YaesuMode::MODE_DATA_USB:
+        case YaesuMode::MODE_RTTY_USB:
+            low = freq + 300;
+            high = freq + 2700;
+            break;
+        case YaesuMode::MODE_LSB:
+        case YaesuMode::MODE_DATA_LSB:
+        case YaesuMode::MODE_RTTY_LSB:
+            low = freq - 2700;
+            high = freq - 300;
+            break;
+        case YaesuMode::MODE_CW_U:
+        case YaesuMode::MODE_CW_L:
+            low = freq - 250;
+            high = freq + 250;
+            break;
+        case YaesuMode::MODE_AM:
+        case YaesuMode::MODE_AM_N:
+            low = freq - 3000;
+            high = freq + 3000;
+            break;
+        default:
+            low = freq - 6000;
+            high = freq + 6000;
+            break;
+    }
+}
+
+uint16_t YaesuBandMap::lowerBound(uint32_t freq) {
+    uint16_t low = 0;
+    uint16_t high = BAND_MAP_COUNT;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (pgm_read_dword(&BAND_MAP_FREQS[mid]) < freq) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void YaesuBandMap::retune(YaesuState& state) {
+    if (!_enabled) {
+        return;
+    }
+
+    uint32_t freq = state.getCurrentFreq();
+    YaesuMode mode = state.getCurrentMode();
+    if (!_found || freq != _freq || mode != _mode) {
+        // Rows whose centre is within half the widest station of the
+        // passband; the exact overlap is checked below
+        uint32_t low, high;
+        passband(mode, freq, low, high);
+        uint32_t reach = BAND_MAP_MAX_WIDTH / 2;
+        _first = lowerBound(low > reach ? low - reach : 0);
+        _last = lowerBound(high + reach + 1);
+        _freq = freq;
+        _mode = mode;
+        _found = true;
+        _evaluated = 0xFF;
+        _searches++;
+    } else if (_evaluated == _slot) {
+        return;  // Same frequency, mode and slot: the level has not changed
+    }
+
+    uint32_t low, high;
+    passband(mode, freq, low, high);
+    uint8_t level = _floor;
+    for (uint16_t i = _first; i < _last; i++) {
+        uint8_t schedule = pgm_read_byte(&BAND_MAP_INFO[i][2]);
+        uint8_t strength = pgm_read_byte(&BAND_MAP_INFO[i][1]);
+        if (!(schedule & (1 << _slot)) || strength <= level) {
+            continue;
+        }
+        uint32_t centre = pgm_read_dword(&BAND_MAP_FREQS[i]);
+        uint32_t half = (uint32_t)pgm_read_byte(&BAND_MAP_INFO[i][0]) * 50;
+        if (centre + half >= low && centre <= high + half) {
+            level = strength;
+        }
+    }
+    _evaluated = _slot;
+
+    state.set(state.signalLevel, level, CHANGED_SMETER);
+    state.set(state.smeter, level, CHANGED_SMETER);
+}
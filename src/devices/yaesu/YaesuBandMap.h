@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "YaesuState.h"
+
+// Length of a schedule slot; station schedules repeat every 8 slots
+#ifndef BAND_MAP_SLOT_MS
+#define BAND_MAP_SLOT_MS 15000UL
+#endif
+
+// Simulated band activity for the FT-991A S-meter
+// A table of stations (YaesuBandMapData.h, generated by
+// tools/band_map.py) sets the S-meter level to the strongest station on
+// the air in the receiver's passband. The table is sorted by frequency
+// and kept in flash as two arrays: 4-byte frequencies, which the binary
+// search reads, and 3 bytes of width, strength and schedule per station.
+// A lookup keeps the rows that can reach the passband, so a new schedule
+// slot only rescans those rows, and a retune to the same frequency and
+// mode in the same slot costs a few comparisons.
+class YaesuBandMap {
+public:
+    YaesuBandMap();
+
+    // The map is off by default; when off, retune() does nothing
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return _enabled; }
+
+    // Level read when no station is on frequency (the console S-meter value)
+    void setFloor(uint8_t level);
+
+    // Clock for the station schedules, ms
+    void setTime(uint32_t now) { _slot = (uint8_t)((now / BAND_MAP_SLOT_MS) & 7); }
+
+    // Set the state's S-meter level for the current VFO's frequency and mode
+    void retune(YaesuState& state);
+
+    // Stations in the table, and binary searches done so far
+    static size_t getStationCount();
+    uint32_t getSearches() const { return _searches; }
+
+    // Receiver passband (Hz) of a mode tuned to freq
+    static void passband(YaesuMode mode, uint32_t freq, uint32_t& low, uint32_t& high);
+
+private:
+    bool _enabled;
+    uint8_t _floor;
+    uint8_t _slot;               // Current schedule slot (0-7)
+
+    // Last lookup: rows [_first, _last) can reach the passband of _freq
+    // in _mode; _evaluated is the slot their level was taken in
+    bool _found;
+    uint32_t _freq;
+    YaesuMode _mode;
+    uint16_t _first;
+    uint16_t _last;
+    uint8_t _evaluated;          // 0xFF after a change that needs a rescan
+
+    uint32_t _searches;
+
+    // First row at or above freq
+    static uint16_t lowerBound(uint32_t freq);
+};
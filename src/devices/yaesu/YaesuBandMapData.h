@@ -0,0 +1,651 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+// Generated by tools/band_map.py --seed 1; do not edit
+
+#pragma once
+
+#include <Arduino.h>
+
+#define BAND_MAP_COUNT 1896
+#define BAND_MAP_MAX_WIDTH 12500  // Hz
+
+// Station frequencies (Hz), ascending
+static const uint32_t BAND_MAP_FREQS[BAND_MAP_COUNT] PROGMEM = {
+      1811620UL,   1811650UL,   1811680UL,   1811870UL,   1812990UL,   1813130UL,
+      1813660UL,   1814100UL,   1814210UL,   1814560UL,   1814660UL,   1815120UL,
+      1816120UL,   1816310UL,   1816630UL,   1816850UL,   1816950UL,   1817500UL,
+      1817690UL,   1818460UL,   1818720UL,   1819160UL,   1819310UL,   1819980UL,
+      1820030UL,   1820060UL,   1820370UL,   1820920UL,   1820970UL,   1822100UL,
+      1822510UL,   1822580UL,   1822970UL,   1822990UL,   1823130UL,   1823430UL,
+      1824710UL,   1824760UL,   1825070UL,   1826320UL,   1826930UL,   1828420UL,
+      1828750UL,   1832230UL,   1832290UL,   1833110UL,   1833750UL,   1834580UL,
+      1834650UL,   1834730UL,   1835130UL,   1835190UL,   1835300UL,   1835530UL,
+      1836020UL,   1836700UL,   1837100UL,   1837240UL,   1839590UL,   1839860UL,
+      1840225UL,   1840260UL,   1840290UL,   1840290UL,   1840310UL,   1840345UL,
+      1840380UL,   1840390UL,   1840420UL,   1840440UL,   1840485UL,   1840555UL,
+      1840560UL,   1840590UL,   1840665UL,   1840680UL,   1840690UL,   1840720UL,
+      1840780UL,   1840800UL,   1840885UL,   1840890UL,   1841010UL,   1841070UL,
+      1841105UL,   1841145UL,   1841160UL,   1841220UL,   1841225UL,   1841250UL,
+      1841290UL,   1841400UL,   1841475UL,   1841490UL,   1841495UL,   1841505UL,
+      1841595UL,   1841715UL,   1841725UL,   1841750UL,   1841840UL,   1841845UL,
+      1841875UL,   1841960UL,   1841965UL,   1841970UL,   1842005UL,   1842115UL,
+      1842150UL,   1842175UL,   1842195UL,   1842195UL,   1842255UL,   1842270UL,
+      1842320UL,   1842330UL,   1842410UL,   1842415UL,   1842440UL,   1842480UL,
+      1842515UL,   1842545UL,   1842550UL,   1842555UL,   1842615UL,   1842655UL,
+      1842680UL,   1842705UL,   1842720UL,   1842755UL,   1842760UL,   1842785UL,
+      1842790UL,   1842800UL,   1842805UL,   1842840UL,   1842855UL,   1842865UL,
+      1842880UL,   1842935UL,   1856500UL,   1859500UL,   1864500UL,   1867500UL,
+      1875500UL,   1876500UL,   1876500UL,   1883500UL,   1886500UL,   1886500UL,
+      1888500UL,   1889500UL,   1889500UL,   1896500UL,   1898500UL,   1899500UL,
+      1901500UL,   1903500UL,   1907500UL,   1908500UL,   1910500UL,   1912500UL,
+      1914500UL,   1914500UL,   1920500UL,   1938500UL,   1941500UL,   1942500UL,
+      1945500UL,   1949500UL,   1950500UL,   1958500UL,   1970500UL,   1970500UL,
+      1972500UL,   1980500UL,   1981500UL,   1981500UL,   1983500UL,   1990500UL,
+      3500700UL,   3502900UL,   3503560UL,   3507020UL,   3507400UL,   3507450UL,
+      3508130UL,   3510370UL,   3510620UL,   3511020UL,   3512180UL,   3512370UL,
+      3520100UL,   3520600UL,   3521280UL,   3522410UL,   3525650UL,   3525690UL,
+      3526110UL,   3526560UL,   3526640UL,   3527010UL,   3527740UL,   3528290UL,
+      3528640UL,   3528930UL,   3529620UL,   3530330UL,   3531470UL,   3532970UL,
+      3534740UL,   3534800UL,   3535070UL,   3536310UL,   3537010UL,   3537200UL,
+      3538430UL,   3540310UL,   3540930UL,   3543000UL,   3543870UL,   3544080UL,
+      3545640UL,   3545760UL,   3547850UL,   3549000UL,   3552190UL,   3552290UL,
+      3554310UL,   3555520UL,   3560340UL,   3560880UL,   3560880UL,   3560990UL,
+      3562530UL,   3564220UL,   3564280UL,   3565090UL,   3566810UL,   3568810UL,
+      3573215UL,   3573355UL,   3573375UL,   3573480UL,   3573540UL,   3573545UL,
+      3573545UL,   3573550UL,   3573570UL,   3573675UL,   3573710UL,   3573790UL,
+      3573800UL,   3573830UL,   3573895UL,   3573905UL,   3573955UL,   3573955UL,
+      3573995UL,   3574040UL,   3574060UL,   3574065UL,   3574110UL,   3574255UL,
+      3574265UL,   3574410UL,   3574470UL,   3574520UL,   3574525UL,   3574585UL,
+      3574595UL,   3574650UL,   3574685UL,   3574710UL,   3574755UL,   3574760UL,
+      3574785UL,   3574790UL,   3574935UL,   3574985UL,   3574990UL,   3575020UL,
+      3575130UL,   3575135UL,   3575225UL,   3575230UL,   3575245UL,   3575260UL,
+      3575275UL,   3575360UL,   3575380UL,   3575485UL,   3575560UL,   3575565UL,
+      3575595UL,   3575600UL,   3575605UL,   3575710UL,   3575765UL,   3575800UL,
+      3575890UL,   3575895UL,   3575905UL,   3575905UL,   3575915UL,   3575975UL,
+      3575985UL,   3576080UL,   3576385UL,   3576520UL,   3576670UL,   3576835UL,
+      3576950UL,   3577140UL,   3577190UL,   3577245UL,   3577245UL,   3577500UL,
+      3577565UL,   3577975UL,   3602500UL,   3603500UL,   3611500UL,   3624500UL,
+      3626500UL,   3638500UL,   3648500UL,   3649500UL,   3652500UL,   3656500UL,
+      3661500UL,   3666500UL,   3667500UL,   3670500UL,   3673500UL,   3673500UL,
+      3695500UL,   3699500UL,   3704500UL,   3716500UL,   3730500UL,   3730500UL,
+      3731500UL,   3732500UL,   3732500UL,   3739500UL,   3739500UL,   3741500UL,
+      3745500UL,   3749500UL,   3752500UL,   3755500UL,   3763500UL,   3765500UL,
+      3766500UL,   3773500UL,   3779500UL,   3782500UL,   3783500UL,   3789500UL,
+      7002180UL,   7002820UL,   7003040UL,   7004320UL,   7004930UL,   7005910UL,
+      7006130UL,   7006310UL,   7006370UL,   7007050UL,   7010170UL,   7011040UL,
+      7011090UL,   7015410UL,   7015540UL,   7016610UL,   7016630UL,   7016980UL,
+      7017300UL,   7018040UL,   7018790UL,   7018820UL,   7019020UL,   7019670UL,
+      7020170UL,   7020810UL,   7022000UL,   7022020UL,   7022280UL,   7022310UL,
+      7024050UL,   7024510UL,   7025270UL,   7025350UL,   7025870UL,   7026720UL,
+      7026890UL,   7026930UL,   7027560UL,   7027710UL,   7027950UL,   7028040UL,
+      7029350UL,   7030430UL,   7030880UL,   7031810UL,   7031910UL,   7032680UL,
+      7032690UL,   7032850UL,   7033260UL,   7034470UL,   7035710UL,   7036390UL,
+      7036630UL,   7037960UL,   7037990UL,   7038230UL,   7038780UL,   7039940UL,
+      7047975UL,   7048230UL,   7048260UL,   7048270UL,   7048340UL,   7048345UL,
+      7048410UL,   7048800UL,   7048935UL,   7048980UL,   7049105UL,   7049240UL,
+      7049245UL,   7049380UL,   7049600UL,   7049770UL,   7049840UL,   7050335UL,
+      7050400UL,   7050410UL,   7074240UL,   7074290UL,   7074300UL,   7074315UL,
+      7074330UL,   7074440UL,   7074485UL,   7074495UL,   7074630UL,   7074650UL,
+      7074655UL,   7074665UL,   7074725UL,   7074740UL,   7074795UL,   7074865UL,
+      7074915UL,   7074940UL,   7074995UL,   7075080UL,   7075220UL,   7075230UL,
+      7075255UL,   7075315UL,   7075460UL,   7075470UL,   7075480UL,   7075625UL,
+      7075705UL,   7075735UL,   7075810UL,   7075885UL,   7075915UL,   7075920UL,
+      7075925UL,   7075930UL,   7075945UL,   7075975UL,   7075975UL,   7075975UL,
+      7076050UL,   7076080UL,   7076080UL,   7076195UL,   7076210UL,   7076240UL,
+      7076285UL,   7076310UL,   7076315UL,   7076330UL,   7076345UL,   7076350UL,
+      7076360UL,   7076505UL,   7076655UL,   7076715UL,   7076715UL,   7076720UL,
+      7076800UL,   7076905UL,   7102500UL,   7106500UL,   7106500UL,   7110500UL,
+      7110500UL,   7110500UL,   7113500UL,   7119500UL,   7121500UL,   7121500UL,
+      7126500UL,   7128500UL,   7133500UL,   7133500UL,   7136500UL,   7140500UL,
+      7144500UL,   7147500UL,   7150500UL,   7154500UL,   7155500UL,   7171500UL,
+      7173500UL,   7173500UL,   7175500UL,   7177500UL,   7180500UL,   7181500UL,
+      7182500UL,   7186500UL,   7190500UL,   7190500UL,   7191500UL,   7192500UL,
+      7193500UL,   7194500UL,   7196500UL,   7200500UL,   7200500UL,   7200500UL,
+     10100050UL,  10100330UL,  10100460UL,  10100600UL,  10100610UL,  10100840UL,
+     10101110UL,  10101270UL,  10101430UL,  10102210UL,  10102220UL,  10102790UL,
+     10103030UL,  10103460UL,  10104910UL,  10105250UL,  10105310UL,  10107990UL,
+     10108540UL,  10108560UL,  10108570UL,  10108600UL,  10109480UL,  10109500UL,
+     10109950UL,  10109970UL,  10110610UL,  10110980UL,  10112390UL,  10112640UL,
+     10113880UL,  10114880UL,  10115210UL,  10115720UL,  10117220UL,  10117890UL,
+     10118740UL,  10120050UL,  10120390UL,  10120520UL,  10120520UL,  10120650UL,
+     10121060UL,  10122440UL,  10122680UL,  10123070UL,  10123800UL,  10123900UL,
+     10124340UL,  10124720UL,  10124880UL,  10124900UL,  10125290UL,  10126160UL,
+     10126290UL,  10126760UL,  10128030UL,  10128510UL,  10128980UL,  10129490UL,
+     10136215UL,  10136385UL,  10136390UL,  10136415UL,  10136420UL,  10136450UL,
+     10136465UL,  10136530UL,  10136575UL,  10136625UL,  10136650UL,  10136715UL,
+     10136750UL,  10136820UL,  10136845UL,  10136860UL,  10136875UL,  10136955UL,
+     10136960UL,  10137020UL,  10137165UL,  10137205UL,  10137265UL,  10137295UL,
+     10137295UL,  10137400UL,  10137435UL,  10137445UL,  10137555UL,  10137565UL,
+     10137570UL,  10137570UL,  10137590UL,  10137600UL,  10137660UL,  10137685UL,
+     10137720UL,  10137945UL,  10138025UL,  10138045UL,  10138085UL,  10138135UL,
+     10138225UL,  10138335UL,  10138385UL,  10138425UL,  10138470UL,  10138520UL,
+     10138545UL,  10138715UL,  10138760UL,  10138770UL,  10138780UL,  10138800UL,
+     10138805UL,  10138820UL,  10138845UL,  10138860UL,  10138955UL,  10138960UL,
+     10140245UL,  10140365UL,  10140390UL,  10140400UL,  10140405UL,  10140440UL,
+     10140825UL,  10140865UL,  10141210UL,  10141615UL,  10141740UL,  10141815UL,
+     10142015UL,  10142045UL,  10142335UL,  10142460UL,  10142545UL,  10142840UL,
+     10142890UL,  10142980UL,  14000680UL,  14003090UL,  14003980UL,  14004220UL,
+     14004960UL,  14006470UL,  14006970UL,  14010100UL,  14010780UL,  14011330UL,
+     14011690UL,  14013210UL,  14013540UL,  14014770UL,  14017060UL,  14018820UL,
+     14021500UL,  14022790UL,  14024120UL,  14024870UL,  14025240UL,  14025480UL,
+     14026820UL,  14028570UL,  14029790UL,  14032420UL,  14032520UL,  14032570UL,
+     14034850UL,  14035270UL,  14035860UL,  14036320UL,  14036810UL,  14037510UL,
+     14038910UL,  14039940UL,  14040000UL,  14042540UL,  14042630UL,  14044090UL,
+     14045270UL,  14046470UL,  14046590UL,  14046690UL,  14047180UL,  14048090UL,
+     14048490UL,  14049920UL,  14050430UL,  14053610UL,  14055170UL,  14055320UL,
+     14057880UL,  14060170UL,  14060980UL,  14062090UL,  14066630UL,  14068210UL,
+     14068230UL,  14069860UL,  14074280UL,  14074365UL,  14074375UL,  14074435UL,
+     14074500UL,  14074515UL,  14074515UL,  14074520UL,  14074535UL,  14074570UL,
+     14074585UL,  14074595UL,  14074605UL,  14074645UL,  14074695UL,  14074815UL,
+     14074920UL,  14074965UL,  14074975UL,  14074995UL,  14075060UL,  14075100UL,
+     14075110UL,  14075135UL,  14075145UL,  14075145UL,  14075155UL,  14075195UL,
+     14075200UL,  14075235UL,  14075280UL,  14075380UL,  14075395UL,  14075450UL,
+     14075470UL,  14075490UL,  14075560UL,  14075615UL,  14075685UL,  14075870UL,
+     14075870UL,  14075900UL,  14075960UL,  14076005UL,  14076020UL,  14076025UL,
+     14076040UL,  14076065UL,  14076070UL,  14076085UL,  14076095UL,  14076095UL,
+     14076175UL,  14076200UL,  14076225UL,  14076445UL,  14076465UL,  14076515UL,
+     14076775UL,  14076925UL,  14080290UL,  14080305UL,  14080465UL,  14080655UL,
+     14080890UL,  14080925UL,  14081040UL,  14081205UL,  14081280UL,  14081415UL,
+     14081540UL,  14081615UL,  14081795UL,  14081850UL,  14082040UL,  14082055UL,
+     14082325UL,  14082655UL,  14082755UL,  14082815UL,  14100000UL,  14100000UL,
+     14100000UL,  14100000UL,  14100000UL,  14100000UL,  14100000UL,  14100000UL,
+     14104500UL,  14114500UL,  14114500UL,  14126500UL,  14128500UL,  14138500UL,
+     14143500UL,  14143500UL,  14152500UL,  14154500UL,  14172500UL,  14181500UL,
+     14181500UL,  14183500UL,  14185500UL,  14185500UL,  14189500UL,  14196500UL,
+     14200500UL,  14200500UL,  14214500UL,  14215500UL,  14230500UL,  14238500UL,
+     14244500UL,  14254500UL,  14255500UL,  14257500UL,  14267500UL,  14272500UL,
+     14279500UL,  14284500UL,  14286500UL,  14290500UL,  14302500UL,  14311500UL,
+     14311500UL,  14322500UL,  14340500UL,  14341500UL,  18068970UL,  18068990UL,
+     18069620UL,  18070320UL,  18070480UL,  18070740UL,  18070840UL,  18071740UL,
+     18072000UL,  18072020UL,  18072390UL,  18072800UL,  18073790UL,  18074070UL,
+     18074340UL,  18075280UL,  18075580UL,  18075690UL,  18076220UL,  18076250UL,
+     18076900UL,  18076910UL,  18077390UL,  18077540UL,  18078820UL,  18078890UL,
+     18078920UL,  18079630UL,  18079710UL,  18079920UL,  18080020UL,  18080120UL,
+     18080490UL,  18081340UL,  18082450UL,  18082530UL,  18083400UL,  18083660UL,
+     18084390UL,  18084640UL,  18085280UL,  18086600UL,  18087330UL,  18087610UL,
+     18087610UL,  18088130UL,  18088200UL,  18089690UL,  18089840UL,  18090030UL,
+     18090940UL,  18091000UL,  18091170UL,  18092600UL,  18093020UL,  18093240UL,
+     18093270UL,  18094070UL,  18094080UL,  18094340UL,  18100225UL,  18100305UL,
+     18100325UL,  18100345UL,  18100350UL,  18100425UL,  18100440UL,  18100475UL,
+     18100505UL,  18100530UL,  18100540UL,  18100565UL,  18100645UL,  18100655UL,
+     18100670UL,  18100690UL,  18100730UL,  18100740UL,  18100855UL,  18100860UL,
+     18100865UL,  18100885UL,  18100900UL,  18100905UL,  18100930UL,  18100940UL,
+     18100950UL,  18100960UL,  18100980UL,  18101040UL,  18101090UL,  18101205UL,
+     18101250UL,  18101265UL,  18101395UL,  18101400UL,  18101455UL,  18101565UL,
+     18101635UL,  18101725UL,  18101820UL,  18101845UL,  18101940UL,  18101995UL,
+     18102100UL,  18102115UL,  18102165UL,  18102245UL,  18102305UL,  18102325UL,
+     18102435UL,  18102440UL,  18102480UL,  18102535UL,  18102670UL,  18102695UL,
+     18102740UL,  18102870UL,  18102875UL,  18102985UL,  18104520UL,  18104530UL,
+     18104790UL,  18104840UL,  18104905UL,  18104905UL,  18105130UL,  18105325UL,
+     18105525UL,  18105650UL,  18105865UL,  18106235UL,  18106235UL,  18106315UL,
+     18106440UL,  18106480UL,  18106830UL,  18106930UL,  18106950UL,  18106970UL,
+     18110000UL,  18110000UL,  18110000UL,  18110000UL,  18110000UL,  18110000UL,
+     18110000UL,  18110000UL,  18113500UL,  18114500UL,  18116500UL,  18116500UL,
+     18117500UL,  18119500UL,  18119500UL,  18121500UL,  18122500UL,  18124500UL,
+     18124500UL,  18125500UL,  18127500UL,  18127500UL,  18129500UL,  18131500UL,
+     18131500UL,  18132500UL,  18132500UL,  18132500UL,  18132500UL,  18133500UL,
+     18134500UL,  18134500UL,  18140500UL,  18141500UL,  18141500UL,  18144500UL,
+     18145500UL,  18145500UL,  18146500UL,  18152500UL,  18154500UL,  18156500UL,
+     18158500UL,  18164500UL,  18166500UL,  18167500UL,  18168500UL,  18168500UL,
+     21001640UL,  21001970UL,  21004740UL,  21005510UL,  21005580UL,  21006160UL,
+     21006760UL,  21007440UL,  21009050UL,  21014060UL,  21015280UL,  21015910UL,
+     21017990UL,  21020380UL,  21021620UL,  21022220UL,  21023790UL,  21025980UL,
+     21027060UL,  21027900UL,  21029140UL,  21031310UL,  21031480UL,  21031480UL,
+     21032450UL,  21033130UL,  21034690UL,  21034870UL,  21035330UL,  21037950UL,
+     21040190UL,  21043350UL,  21043530UL,  21044990UL,  21045950UL,  21046320UL,
+     21047170UL,  21047820UL,  21048270UL,  21048870UL,  21050500UL,  21051560UL,
+     21056180UL,  21056890UL,  21057430UL,  21057660UL,  21057710UL,  21058080UL,
+     21058450UL,  21059520UL,  21059720UL,  21060850UL,  21062420UL,  21062440UL,
+     21062590UL,  21063320UL,  21063490UL,  21063640UL,  21066130UL,  21067230UL,
+     21074325UL,  21074375UL,  21074385UL,  21074425UL,  21074500UL,  21074585UL,
+     21074740UL,  21074760UL,  21074815UL,  21074850UL,  21074900UL,  21074905UL,
+     21074940UL,  21074970UL,  21075055UL,  21075100UL,  21075175UL,  21075195UL,
+     21075265UL,  21075315UL,  21075360UL,  21075375UL,  21075385UL,  21075525UL,
+     21075530UL,  21075625UL,  21075700UL,  21075755UL,  21075915UL,  21075925UL,
+     21075950UL,  21075970UL,  21075995UL,  21076160UL,  21076175UL,  21076215UL,
+     21076230UL,  21076260UL,  21076265UL,  21076270UL,  21076400UL,  21076415UL,
+     21076455UL,  21076465UL,  21076515UL,  21076530UL,  21076630UL,  21076650UL,
+     21076655UL,  21076700UL,  21076725UL,  21076725UL,  21076830UL,  21076845UL,
+     21076845UL,  21076850UL,  21076880UL,  21076920UL,  21076980UL,  21076995UL,
+     21140220UL,  21140320UL,  21140405UL,  21140405UL,  21141020UL,  21141565UL,
+     21142035UL,  21142125UL,  21142130UL,  21142345UL,  21142360UL,  21142465UL,
+     21142535UL,  21142660UL,  21142775UL,  21142805UL,  21142815UL,  21142855UL,
+     21142895UL,  21142915UL,  21150000UL,  21150000UL,  21150000UL,  21150000UL,
+     21150000UL,  21150000UL,  21150000UL,  21150000UL,  21152500UL,  21169500UL,
+     21173500UL,  21174500UL,  21177500UL,  21177500UL,  21202500UL,  21206500UL,
+     21207500UL,  21210500UL,  21212500UL,  21217500UL,  21227500UL,  21233500UL,
+     21233500UL,  21237500UL,  21239500UL,  21239500UL,  21260500UL,  21269500UL,
+     21282500UL,  21282500UL,  21295500UL,  21302500UL,  21308500UL,  21318500UL,
+     21339500UL,  21350500UL,  21353500UL,  21362500UL,  21370500UL,  21372500UL,
+     21390500UL,  21402500UL,  21409500UL,  21412500UL,  21414500UL,  21437500UL,
+     21447500UL,  21448500UL,  24890170UL,  24890200UL,  24891350UL,  24891530UL,
+     24891640UL,  24892980UL,  24894310UL,  24894610UL,  24895040UL,  24896020UL,
+     24896060UL,  24896400UL,  24896590UL,  24896660UL,  24896910UL,  24897190UL,
+     24897340UL,  24897750UL,  24897750UL,  24897910UL,  24897920UL,  24898520UL,
+     24898790UL,  24898870UL,  24899010UL,  24899090UL,  24900130UL,  24900230UL,
+     24900240UL,  24900650UL,  24900700UL,  24900720UL,  24900990UL,  24901210UL,
+     24901730UL,  24901840UL,  24904200UL,  24904560UL,  24904810UL,  24905010UL,
+     24905710UL,  24905960UL,  24906610UL,  24906970UL,  24907670UL,  24907760UL,
+     24907880UL,  24908000UL,  24909790UL,  24909830UL,  24910070UL,  24910410UL,
+     24910490UL,  24912110UL,  24912450UL,  24913280UL,  24913510UL,  24913760UL,
+     24914400UL,  24914920UL,  24915220UL,  24915285UL,  24915330UL,  24915345UL,
+     24915405UL,  24915455UL,  24915460UL,  24915580UL,  24915670UL,  24915710UL,
+     24915770UL,  24915785UL,  24915980UL,  24916015UL,  24916025UL,  24916040UL,
+     24916060UL,  24916075UL,  24916170UL,  24916215UL,  24916270UL,  24916275UL,
+     24916300UL,  24916330UL,  24916435UL,  24916485UL,  24916485UL,  24916510UL,
+     24916525UL,  24916700UL,  24916725UL,  24916790UL,  24916855UL,  24916905UL,
+     24916910UL,  24916910UL,  24916960UL,  24917070UL,  24917145UL,  24917180UL,
+     24917205UL,  24917215UL,  24917260UL,  24917270UL,  24917295UL,  24917300UL,
+     24917345UL,  24917380UL,  24917380UL,  24917615UL,  24917635UL,  24917675UL,
+     24917745UL,  24917745UL,  24917790UL,  24917815UL,  24917855UL,  24917860UL,
+     24917900UL,  24917940UL,  24919290UL,  24919315UL,  24919565UL,  24919635UL,
+     24920220UL,  24920265UL,  24920315UL,  24920490UL,  24920510UL,  24920640UL,
+     24920720UL,  24921130UL,  24921150UL,  24921240UL,  24921345UL,  24921425UL,
+     24921640UL,  24921775UL,  24921845UL,  24921900UL,  24930000UL,  24930000UL,
+     24930000UL,  24930000UL,  24930000UL,  24930000UL,  24930000UL,  24930000UL,
+     24932500UL,  24935500UL,  24940500UL,  24941500UL,  24941500UL,  24942500UL,
+     24942500UL,  24945500UL,  24946500UL,  24946500UL,  24950500UL,  24950500UL,
+     24951500UL,  24952500UL,  24955500UL,  24956500UL,  24957500UL,  24959500UL,
+     24959500UL,  24963500UL,  24963500UL,  24964500UL,  24964500UL,  24964500UL,
+     24964500UL,  24965500UL,  24966500UL,  24967500UL,  24968500UL,  24969500UL,
+     24973500UL,  24973500UL,  24973500UL,  24973500UL,  24976500UL,  24979500UL,
+     24985500UL,  24985500UL,  24986500UL,  24987500UL,  28000640UL,  28001720UL,
+     28003090UL,  28004640UL,  28005390UL,  28005890UL,  28006020UL,  28006840UL,
+     28007390UL,  28007680UL,  28009840UL,  28011600UL,  28012860UL,  28013530UL,
+     28015150UL,  28016780UL,  28017230UL,  28017610UL,  28017990UL,  28020200UL,
+     28023300UL,  28023400UL,  28023970UL,  28024130UL,  28024640UL,  28024650UL,
+     28025130UL,  28025500UL,  28026230UL,  28027920UL,  28029130UL,  28029550UL,
+     28030720UL,  28032610UL,  28033640UL,  28033730UL,  28034820UL,  28035690UL,
+     28036670UL,  28038390UL,  28038430UL,  28040420UL,  28044520UL,  28044610UL,
+     28044930UL,  28047690UL,  28048590UL,  28049460UL,  28051670UL,  28054760UL,
+     28054770UL,  28056450UL,  28057040UL,  28058320UL,  28058530UL,  28059700UL,
+     28062880UL,  28065150UL,  28066870UL,  28067200UL,  28074235UL,  28074240UL,
+     28074250UL,  28074250UL,  28074370UL,  28074460UL,  28074505UL,  28074535UL,
+     28074595UL,  28074605UL,  28074620UL,  28074655UL,  28074820UL,  28074865UL,
+     28074875UL,  28074875UL,  28074880UL,  28074900UL,  28074915UL,  28075045UL,
+     28075280UL,  28075290UL,  28075315UL,  28075315UL,  28075335UL,  28075375UL,
+     28075410UL,  28075485UL,  28075560UL,  28075575UL,  28075580UL,  28075695UL,
+     28075725UL,  28075730UL,  28075880UL,  28075885UL,  28075890UL,  28075890UL,
+     28075900UL,  28075970UL,  28076000UL,  28076010UL,  28076040UL,  28076070UL,
+     28076085UL,  28076175UL,  28076275UL,  28076295UL,  28076305UL,  28076345UL,
+     28076415UL,  28076510UL,  28076535UL,  28076565UL,  28076570UL,  28076570UL,
+     28076630UL,  28076660UL,  28076845UL,  28076850UL,  28180765UL,  28180770UL,
+     28180915UL,  28180920UL,  28181030UL,  28181145UL,  28181240UL,  28181755UL,
+     28181785UL,  28181975UL,  28182050UL,  28182120UL,  28182435UL,  28182515UL,
+     28182595UL,  28182690UL,  28182775UL,  28182805UL,  28182805UL,  28182895UL,
+     28200000UL,  28200000UL,  28200000UL,  28200000UL,  28200000UL,  28200000UL,
+     28200000UL,  28200000UL,  28330500UL,  28343500UL,  28348500UL,  28350500UL,
+     28352500UL,  28357500UL,  28366500UL,  28366500UL,  28379500UL,  28383500UL,
+     28386500UL,  28407500UL,  28410500UL,  28429500UL,  28435500UL,  28446500UL,
+     28447500UL,  28458500UL,  28464500UL,  28466500UL,  28497500UL,  28500500UL,
+     28510500UL,  28516500UL,  28528500UL,  28532500UL,  28550500UL,  28568500UL,
+     28579500UL,  28583500UL,  28584500UL,  28585500UL,  28590500UL,  28595500UL,
+     28599500UL,  28609500UL,  28639500UL,  28679500UL,  28687500UL,  28695500UL,
+     50001640UL,  50001800UL,  50002950UL,  50007440UL,  50008550UL,  50011480UL,
+     50012720UL,  50013270UL,  50017360UL,  50023270UL,  50023480UL,  50023750UL,
+     50024290UL,  50024770UL,  50024820UL,  50027840UL,  50028630UL,  50032990UL,
+     50033620UL,  50041020UL,  50042020UL,  50042270UL,  50043000UL,  50046200UL,
+     50047730UL,  50049420UL,  50049450UL,  50049860UL,  50050010UL,  50051110UL,
+     50051760UL,  50060350UL,  50060620UL,  50060960UL,  50064360UL,  50065300UL,
+     50068900UL,  50069730UL,  50069760UL,  50069980UL,  50069990UL,  50070000UL,
+     50070170UL,  50075450UL,  50075910UL,  50076530UL,  50078630UL,  50081110UL,
+     50081220UL,  50082890UL,  50083800UL,  50083820UL,  50083990UL,  50084810UL,
+     50086860UL,  50086900UL,  50089100UL,  50093480UL,  50099160UL,  50099450UL,
+     50121500UL,  50127500UL,  50127500UL,  50132500UL,  50137500UL,  50137500UL,
+     50137500UL,  50149500UL,  50167500UL,  50169500UL,  50171500UL,  50174500UL,
+     50175500UL,  50175500UL,  50181500UL,  50181500UL,  50184500UL,  50189500UL,
+     50189500UL,  50198500UL,  50203500UL,  50207500UL,  50209500UL,  50211500UL,
+     50215500UL,  50220500UL,  50221500UL,  50225500UL,  50227500UL,  50240500UL,
+     50240500UL,  50248500UL,  50253500UL,  50255500UL,  50258500UL,  50262500UL,
+     50265500UL,  50266500UL,  50273500UL,  50284500UL,  50313200UL,  50313215UL,
+     50313235UL,  50313320UL,  50313350UL,  50313355UL,  50313380UL,  50313400UL,
+     50313420UL,  50313445UL,  50313485UL,  50313510UL,  50313570UL,  50313610UL,
+     50313610UL,  50313840UL,  50313865UL,  50313870UL,  50313870UL,  50313885UL,
+     50313905UL,  50313905UL,  50313955UL,  50313980UL,  50313985UL,  50314020UL,
+     50314070UL,  50314105UL,  50314225UL,  50314270UL,  50314280UL,  50314285UL,
+     50314395UL,  50314405UL,  50314445UL,  50314660UL,  50314740UL,  50314870UL,
+     50314925UL,  50314975UL,  50315055UL,  50315065UL,  50315125UL,  50315195UL,
+     50315215UL,  50315280UL,  50315325UL,  50315360UL,  50315450UL,  50315450UL,
+     50315555UL,  50315600UL,  50315605UL,  50315630UL,  50315755UL,  50315770UL,
+     50315790UL,  50315855UL,  50315875UL,  50315930UL,  50318390UL,  50318725UL,
+     50318775UL,  50318785UL,  50319340UL,  50319390UL,  50319435UL,  50319475UL,
+     50319760UL,  50319780UL,  50319980UL,  50319995UL,  50320000UL,  50320010UL,
+     50320135UL,  50320165UL,  50320190UL,  50320385UL,  50320530UL,  50320530UL,
+    145600000UL, 145612500UL, 145625000UL, 145637500UL, 145650000UL, 145662500UL,
+    145675000UL, 145687500UL, 145700000UL, 145712500UL, 145725000UL, 145737500UL,
+    145750000UL, 145762500UL, 145775000UL, 145787500UL, 146610000UL, 146625000UL,
+    146670000UL, 146700000UL, 146730000UL, 146775000UL, 146805000UL, 146820000UL,
+    146835000UL, 146850000UL, 146865000UL, 146880000UL, 146910000UL, 146955000UL,
+    146970000UL, 147000000UL, 147015000UL, 147030000UL, 147045000UL, 147060000UL,
+    147075000UL, 147090000UL, 147105000UL, 147135000UL, 147180000UL, 147195000UL,
+    147210000UL, 147255000UL, 147270000UL, 147285000UL, 438000000UL, 438300000UL,
+    438325000UL, 438400000UL, 438450000UL, 438475000UL, 438525000UL, 438725000UL,
+    438800000UL, 438900000UL, 439075000UL, 439125000UL, 439225000UL, 439450000UL,
+    439675000UL, 439725000UL, 439775000UL, 439875000UL, 439925000UL, 439975000UL,
+    442000000UL, 442075000UL, 442100000UL, 442125000UL, 442175000UL, 442275000UL,
+    442500000UL, 442550000UL, 442575000UL, 442625000UL, 442775000UL, 442825000UL,
+    442925000UL, 443025000UL, 443075000UL, 443100000UL, 443175000UL, 443525000UL,
+    443575000UL, 443600000UL, 443875000UL, 443900000UL, 444050000UL, 444275000UL,
+    444300000UL, 444375000UL, 444550000UL, 444625000UL, 444725000UL, 444925000UL,
+};
+
+// Width (100 Hz units), strength (S-meter units), schedule (slot mask)
+static const uint8_t BAND_MAP_INFO[BAND_MAP_COUNT][3] PROGMEM = {
+    {  2,  11, 0xFF}, {  2,  26, 0xF0}, {  2,  88, 0xF0}, {  2,  80, 0xFF}, {  2, 102, 0xF0}, {  2, 151, 0xEE},
+    {  2, 119, 0x0F}, {  2,  58, 0x3C}, {  2, 116, 0xC3}, {  2,  69, 0x33}, {  2,  79, 0x33}, {  2,  92, 0x0F},
+    {  2,  41, 0x3C}, {  2,  30, 0xEE}, {  2,  34, 0x77}, {  2,  66, 0xF0}, {  2,  47, 0xEE}, {  2, 143, 0x33},
+    {  2,  66, 0xC3}, {  2,  41, 0xEE}, {  2,  73, 0x3C}, {  2, 149, 0x0F}, {  2, 104, 0xCC}, {  2, 107, 0x0F},
+    {  2,  61, 0xFF}, {  2,  90, 0x0F}, {  2, 127, 0x3C}, {  2,  98, 0xCC}, {  2, 146, 0x0F}, {  2, 157, 0x3C},
+    {  2,  32, 0xEE}, {  2,  55, 0x33}, {  2, 153, 0xCC}, {  2, 158, 0x77}, {  2,  15, 0xC3}, {  2,  24, 0xEE},
+    {  2, 131, 0x77}, {  2,  25, 0xCC}, {  2,  91, 0x3C}, {  2,  21, 0x0F}, {  2,  34, 0xFF}, {  2, 105, 0x3C},
+    {  2,  75, 0x0F}, {  2,  80, 0xEE}, {  2, 161, 0x0F}, {  2, 141, 0x0F}, {  2, 146, 0x0F}, {  2, 134, 0xCC},
+    {  2,  80, 0xF0}, {  2, 130, 0xF0}, {  2,   8, 0x0F}, {  2, 155, 0xC3}, {  2, 143, 0x77}, {  2, 146, 0x33},
+    {  2,   7, 0xCC}, {  2, 152, 0x3C}, {  2,  96, 0xCC}, {  2,  49, 0xF0}, {  2,  13, 0x3C}, {  2,  24, 0xFF},
+    {  1, 108, 0x55}, {  1,  61, 0x55}, {  1, 111, 0x55}, {  1,  30, 0x55}, {  1,  16, 0x55}, {  1, 145, 0x55},
+    {  1,  51, 0xAA}, {  1,  85, 0x55}, {  1,  88, 0xAA}, {  1,  88, 0x55}, {  1, 133, 0xAA}, {  1,  52, 0x55},
+    {  1,  31, 0x55}, {  1,  89, 0xAA}, {  1,  75, 0x55}, {  1, 134, 0x55}, {  1, 117, 0xAA}, {  1,  91, 0x55},
+    {  1,  16, 0xAA}, {  1, 136, 0xAA}, {  1,  26, 0xAA}, {  1,  53, 0xAA}, {  1,  63, 0xFF}, {  1,  53, 0x55},
+    {  1, 150, 0x55}, {  1,  98, 0xAA}, {  1,  76, 0x55}, {  1, 139, 0xAA}, {  1,  54, 0x55}, {  1,  83, 0xFF},
+    {  1,  44, 0xFF}, {  1,  18, 0xFF}, {  1,  78, 0x55}, {  1,  26, 0x55}, {  1, 140, 0x55}, {  1, 145, 0x55},
+    {  1,  85, 0xAA}, {  1,  40, 0xAA}, {  1,  42, 0x55}, {  1,  82, 0xAA}, {  1, 119, 0x55}, {  1, 137, 0xAA},
+    {  1, 113, 0xFF}, {  1, 127, 0xFF}, {  1,  69, 0x55}, {  1,  10, 0xAA}, {  1, 127, 0xAA}, {  1,  32, 0xAA},
+    {  1,  65, 0xAA}, {  1,  97, 0xAA}, {  1, 120, 0x55}, {  1,  47, 0xFF}, {  1, 125, 0xAA}, {  1, 141, 0xAA},
+    {  1,  54, 0xAA}, {  1,  35, 0x55}, {  1,  15, 0x55}, {  1,  85, 0x55}, {  1, 136, 0x55}, {  1,  78, 0x55},
+    {  1,  13, 0xAA}, {  1,  17, 0x55}, {  1,  84, 0x55}, {  1,  31, 0xFF}, {  1, 107, 0x55}, {  1,  72, 0xAA},
+    {  1, 101, 0xAA}, {  1,  17, 0xAA}, {  1,  23, 0xFF}, {  1,  12, 0xAA}, {  1, 118, 0x55}, {  1, 110, 0x55},
+    {  1, 119, 0x55}, {  1,  37, 0x55}, {  1,  14, 0xAA}, {  1, 125, 0x55}, {  1,  62, 0xAA}, {  1, 110, 0xAA},
+    {  1,  17, 0xAA}, {  1,  72, 0xFF}, { 27,  38, 0xEE}, { 27, 110, 0xF0}, { 27, 133, 0x33}, { 27,  85, 0x0F},
+    { 27, 175, 0xEE}, { 27,  55, 0xCC}, { 27, 179, 0x77}, { 27,  84, 0xC3}, { 27, 103, 0x77}, { 27, 138, 0x0F},
+    { 27, 176, 0x0F}, { 27,  96, 0xC3}, { 27, 155, 0x3C}, { 27,  99, 0xCC}, { 27,  50, 0xC3}, { 27, 165, 0xFF},
+    { 27,  81, 0x3C}, { 27, 144, 0xFF}, { 27,  84, 0x0F}, { 27, 158, 0x77}, { 27, 144, 0xFF}, { 27,  41, 0xF0},
+    { 27, 121, 0xC3}, { 27, 185, 0x33}, { 27, 161, 0x3C}, { 27,  60, 0xEE}, { 27, 130, 0xC3}, { 27, 151, 0xF0},
+    { 27, 106, 0xF0}, { 27, 106, 0xEE}, { 27, 166, 0xFF}, { 27, 130, 0xEE}, { 27, 120, 0x3C}, { 27, 142, 0x33},
+    { 27, 186, 0x77}, { 27, 124, 0x0F}, { 27,  60, 0xFF}, { 27, 136, 0xFF}, { 27,  30, 0xEE}, { 27, 116, 0xF0},
+    {  2, 139, 0x0F}, {  2, 142, 0xFF}, {  2,  81, 0xEE}, {  2,  82, 0xFF}, {  2,  69, 0x3C}, {  2,  53, 0xFF},
+    {  2,  85, 0xFF}, {  2, 141, 0xFF}, {  2, 119, 0xEE}, {  2,  17, 0xEE}, {  2,  86, 0x3C}, {  2,  20, 0x33},
+    {  2,  20, 0xF0}, {  2,  50, 0x0F}, {  2, 169, 0x33}, {  2,  35, 0xC3}, {  2,  38, 0xCC}, {  2, 111, 0xCC},
+    {  2,  95, 0xCC}, {  2,  29, 0xC3}, {  2, 138, 0xEE}, {  2, 166, 0xCC}, {  2, 135, 0xC3}, {  2,  37, 0x0F},
+    {  2, 114, 0xEE}, {  2, 145, 0xC3}, {  2, 169, 0x3C}, {  2, 104, 0xEE}, {  2,  19, 0xCC}, {  2,  83, 0x77},
+    {  2,  22, 0xCC}, {  2,  67, 0xEE}, {  2,  16, 0xFF}, {  2,  37, 0xC3}, {  2,  76, 0x77}, {  2,  98, 0xC3},
+    {  2, 133, 0x3C}, {  2, 152, 0xCC}, {  2, 168, 0xF0}, {  2,  38, 0xFF}, {  2,  12, 0xCC}, {  2,  56, 0xEE},
+    {  2,  57, 0x3C}, {  2, 153, 0xEE}, {  2, 128, 0x0F}, {  2,  92, 0xEE}, {  2,  28, 0xEE}, {  2, 138, 0xFF},
+    {  2, 119, 0xC3}, {  2,  82, 0x0F}, {  2, 139, 0xCC}, {  2,  45, 0x33}, {  2, 161, 0x0F}, {  2,  76, 0x33},
+    {  2, 119, 0xFF}, {  2,  67, 0x3C}, {  2,  88, 0x0F}, {  2, 102, 0x0F}, {  2,  25, 0xFF}, {  2,  82, 0xFF},
+    {  1,  81, 0x55}, {  1,  72, 0xAA}, {  1, 136, 0xAA}, {  1,  15, 0x55}, {  1, 123, 0x55}, {  1,  37, 0x55},
+    {  1, 136, 0x55}, {  1,  29, 0xAA}, {  1,  52, 0xAA}, {  1, 112, 0xAA}, {  1,  57, 0x55}, {  1,  62, 0xAA},
+    {  1,  13, 0xAA}, {  1, 123, 0xAA}, {  1,  29, 0xAA}, {  1, 122, 0xAA}, {  1,  77, 0xAA}, {  1, 148, 0x55},
+    {  1, 111, 0xAA}, {  1, 139, 0x55}, {  1,  86, 0xAA}, {  1, 129, 0x55}, {  1,  28, 0x55}, {  1,  54, 0xAA},
+    {  1, 108, 0x55}, {  1,  95, 0xAA}, {  1,  78, 0x55}, {  1,  72, 0x55}, {  1,  94, 0x55}, {  1, 140, 0x55},
+    {  1,  89, 0xAA}, {  1,  37, 0x55}, {  1,  15, 0xAA}, {  1,  81, 0x55}, {  1,  63, 0x55}, {  1,  53, 0xAA},
+    {  1, 112, 0x55}, {  1, 121, 0xAA}, {  1, 136, 0x55}, {  1,  77, 0xAA}, {  1,  88, 0xAA}, {  1,  69, 0xAA},
+    {  1, 107, 0x55}, {  1,  11, 0x55}, {  1, 119, 0xAA}, {  1,  92, 0xAA}, {  1,  54, 0xAA}, {  1,  91, 0xAA},
+    {  1,  59, 0x55}, {  1,  27, 0xAA}, {  1, 113, 0xAA}, {  1,  53, 0xAA}, {  1, 142, 0xAA}, {  1,  76, 0xAA},
+    {  1, 140, 0x55}, {  1,  15, 0x55}, {  1,  69, 0xFF}, {  1, 117, 0x55}, {  1, 126, 0x55}, {  1,  88, 0xFF},
+    {  1,  10, 0xAA}, {  1,  51, 0x55}, {  1,  92, 0x55}, {  1, 122, 0x55}, {  1,  60, 0xAA}, {  1, 111, 0x55},
+    {  1,  87, 0x55}, {  1,  22, 0x55}, {  1,  40, 0xAA}, {  1,  52, 0xAA}, {  1, 127, 0x55}, {  1, 123, 0xAA},
+    {  1,  94, 0xAA}, {  1,  42, 0x55}, {  1,  37, 0xAA}, {  1,  30, 0xFF}, {  1,  39, 0xAA}, {  1,  58, 0x55},
+    {  1,  80, 0xFF}, {  1,  17, 0xFF}, { 27,  68, 0xCC}, { 27, 156, 0xC3}, { 27, 110, 0x77}, { 27,  43, 0xFF},
+    { 27, 159, 0xCC}, { 27,  84, 0x33}, { 27, 125, 0xFF}, { 27, 143, 0x0F}, { 27, 173, 0x77}, { 27, 184, 0xF0},
+    { 27, 128, 0x77}, { 27, 124, 0x33}, { 27,  37, 0xEE}, { 27, 115, 0x77}, { 27, 154, 0xC3}, { 27, 188, 0xFF},
+    { 27, 127, 0xC3}, { 27,  88, 0x77}, { 27, 177, 0xEE}, { 27,  97, 0xF0}, { 27,  62, 0xFF}, { 27, 133, 0xF0},
+    { 27, 130, 0xFF}, { 27, 100, 0xEE}, { 27, 144, 0x0F}, { 27,  50, 0xCC}, { 27, 152, 0xC3}, { 27,  61, 0xCC},
+    { 27,  54, 0x0F}, { 27, 169, 0xC3}, { 27, 114, 0x77}, { 27, 181, 0xCC}, { 27,  22, 0xC3}, { 27,  40, 0x0F},
+    { 27, 166, 0xEE}, { 27, 113, 0xEE}, { 27, 184, 0xFF}, { 27,  92, 0x33}, { 27,  47, 0x33}, { 27, 189, 0xFF},
+    {  2,  30, 0x77}, {  2, 144, 0x3C}, {  2, 153, 0xF0}, {  2, 148, 0x3C}, {  2, 151, 0x77}, {  2,  19, 0x3C},
+    {  2,   8, 0xC3}, {  2, 139, 0x0F}, {  2, 102, 0x77}, {  2, 144, 0x77}, {  2,  90, 0x3C}, {  2,  80, 0xFF},
+    {  2, 150, 0x3C}, {  2,  96, 0xCC}, {  2, 148, 0x0F}, {  2,  35, 0xF0}, {  2, 160, 0x77}, {  2,  32, 0xFF},
+    {  2,  93, 0xCC}, {  2, 107, 0xEE}, {  2, 101, 0xEE}, {  2,  12, 0xC3}, {  2, 106, 0x33}, {  2,  58, 0xC3},
+    {  2,  54, 0xC3}, {  2,  96, 0xEE}, {  2,   7, 0xF0}, {  2, 105, 0xFF}, {  2,  68, 0xC3}, {  2, 147, 0xEE},
+    {  2,  40, 0xEE}, {  2, 113, 0xCC}, {  2, 116, 0xC3}, {  2,  83, 0x77}, {  2,  49, 0xC3}, {  2,  24, 0xF0},
+    {  2,  67, 0x77}, {  2, 165, 0xFF}, {  2,  34, 0xEE}, {  2,  60, 0x77}, {  2,  38, 0xF0}, {  2, 153, 0xFF},
+    {  2,  63, 0x0F}, {  2, 125, 0x3C}, {  2,  92, 0x77}, {  2,  15, 0x3C}, {  2,  14, 0xFF}, {  2,  78, 0xF0},
+    {  2,  65, 0xEE}, {  2, 126, 0x33}, {  2,  15, 0x0F}, {  2,  90, 0x3C}, {  2,  45, 0x0F}, {  2,  79, 0xF0},
+    {  2,  92, 0x0F}, {  2,  73, 0xF0}, {  2, 164, 0x33}, {  2,  99, 0xC3}, {  2,  70, 0xFF}, {  2, 154, 0xFF},
+    {  1,  86, 0xFF}, {  1, 105, 0xAA}, {  1,  32, 0x55}, {  1,  55, 0xFF}, {  1,  87, 0xAA}, {  1,  61, 0xFF},
+    {  1, 128, 0xAA}, {  1, 124, 0xAA}, {  1,  22, 0xFF}, {  1,  78, 0xAA}, {  1,  79, 0x55}, {  1, 124, 0x55},
+    {  1,  80, 0x55}, {  1,  45, 0x55}, {  1, 129, 0xFF}, {  1,  21, 0xFF}, {  1,  78, 0xAA}, {  1, 123, 0xAA},
+    {  1,  70, 0xFF}, {  1,  43, 0xAA}, {  1,  98, 0xAA}, {  1,  54, 0xAA}, {  1,  88, 0x55}, {  1,  41, 0xAA},
+    {  1,  36, 0xAA}, {  1,  64, 0x55}, {  1, 148, 0xAA}, {  1, 139, 0xAA}, {  1,  67, 0xAA}, {  1, 147, 0x55},
+    {  1, 119, 0x55}, {  1,  26, 0x55}, {  1,  86, 0xAA}, {  1,  48, 0xAA}, {  1, 133, 0xAA}, {  1,  75, 0x55},
+    {  1,  75, 0x55}, {  1, 116, 0x55}, {  1, 132, 0x55}, {  1,  39, 0x55}, {  1, 138, 0xAA}, {  1,  52, 0xAA},
+    {  1,  48, 0x55}, {  1, 146, 0xAA}, {  1, 115, 0x55}, {  1,  78, 0x55}, {  1,  46, 0x55}, {  1,  55, 0xAA},
+    {  1, 140, 0xAA}, {  1,  35, 0x55}, {  1, 136, 0xAA}, {  1,  40, 0x55}, {  1, 134, 0x55}, {  1, 109, 0xAA},
+    {  1, 134, 0x55}, {  1,  55, 0x55}, {  1,  78, 0xAA}, {  1,  22, 0x55}, {  1,  29, 0x55}, {  1,  45, 0x55},
+    {  1,  17, 0x55}, {  1,  42, 0xAA}, {  1, 130, 0x55}, {  1,  41, 0xAA}, {  1,  39, 0xAA}, {  1,  57, 0x55},
+    {  1,  24, 0x55}, {  1,  76, 0xAA}, {  1,  79, 0xAA}, {  1, 147, 0xAA}, {  1,  40, 0xAA}, {  1,  80, 0xAA},
+    {  1,  93, 0x55}, {  1, 146, 0x55}, {  1,  88, 0xAA}, {  1,  64, 0xAA}, {  1, 112, 0xAA}, {  1, 149, 0x55},
+    {  1,  80, 0xAA}, {  1,  44, 0x55}, { 27,  58, 0xF0}, { 27, 152, 0x33}, { 27, 152, 0x33}, { 27,  83, 0xC3},
+    { 27, 157, 0xEE}, { 27, 168, 0xEE}, { 27, 184, 0x77}, { 27,  86, 0xCC}, { 27,  64, 0xC3}, { 27, 189, 0xF0},
+    { 27, 146, 0xCC}, { 27, 129, 0x33}, { 27,  77, 0x33}, { 27, 109, 0xC3}, { 27, 164, 0x77}, { 27, 139, 0xCC},
+    { 27, 189, 0x33}, { 27,  58, 0xCC}, { 27,  42, 0xEE}, { 27, 161, 0xF0}, { 27,  81, 0xF0}, { 27, 137, 0xC3},
+    { 27,  91, 0xF0}, { 27, 184, 0xFF}, { 27,  25, 0xEE}, { 27,  54, 0xEE}, { 27,  70, 0xEE}, { 27,  39, 0xF0},
+    { 27, 134, 0xEE}, { 27,  34, 0xFF}, { 27, 121, 0xC3}, { 27, 149, 0xEE}, { 27, 101, 0xEE}, { 27,  70, 0x0F},
+    { 27, 126, 0xF0}, { 27, 112, 0x3C}, { 27, 123, 0xC3}, { 27,  23, 0xFF}, { 27, 139, 0x0F}, { 27, 179, 0x0F},
+    {  2,  83, 0x77}, {  2,  70, 0xEE}, {  2,  84, 0x0F}, {  2, 159, 0xFF}, {  2,  88, 0x3C}, {  2,  31, 0xC3},
+    {  2, 169, 0xF0}, {  2,  99, 0xC3}, {  2, 140, 0x33}, {  2,  83, 0xC3}, {  2,  31, 0xEE}, {  2,  60, 0xFF},
+    {  2,  55, 0xC3}, {  2, 139, 0xF0}, {  2, 170, 0x0F}, {  2,  80, 0xC3}, {  2,  79, 0xFF}, {  2, 136, 0x77},
+    {  2,  25, 0x3C}, {  2, 126, 0x3C}, {  2, 118, 0xCC}, {  2, 164, 0xF0}, {  2, 160, 0xFF}, {  2, 135, 0x77},
+    {  2, 130, 0xEE}, {  2, 106, 0xC3}, {  2,  70, 0xCC}, {  2, 139, 0xCC}, {  2,  80, 0xC3}, {  2, 155, 0xFF},
+    {  2,  23, 0xC3}, {  2,  10, 0x77}, {  2,  88, 0xC3}, {  2, 116, 0xFF}, {  2, 139, 0x77}, {  2, 100, 0x33},
+    {  2, 122, 0x3C}, {  2,  86, 0x0F}, {  2,  48, 0xF0}, {  2,  61, 0xCC}, {  2, 127, 0x77}, {  2, 151, 0x3C},
+    {  2, 135, 0xF0}, {  2,  75, 0xC3}, {  2,  92, 0xEE}, {  2, 106, 0xEE}, {  2, 114, 0x77}, {  2, 170, 0xCC},
+    {  2,  51, 0x33}, {  2, 125, 0xF0}, {  2,  92, 0x33}, {  2, 149, 0xEE}, {  2,  66, 0x33}, {  2, 130, 0x0F},
+    {  2,  33, 0x3C}, {  2,  23, 0x33}, {  2, 164, 0xCC}, {  2, 165, 0xF0}, {  2, 154, 0x3C}, {  2,  81, 0x3C},
+    {  1,  40, 0x55}, {  1, 145, 0x55}, {  1,  26, 0x55}, {  1, 118, 0xAA}, {  1, 138, 0x55}, {  1, 132, 0x55},
+    {  1,  90, 0x55}, {  1,  97, 0x55}, {  1, 134, 0x55}, {  1,  29, 0x55}, {  1, 141, 0xAA}, {  1,  95, 0xAA},
+    {  1, 113, 0xAA}, {  1,  64, 0xAA}, {  1,  82, 0xAA}, {  1,  57, 0x55}, {  1,  36, 0x55}, {  1,  83, 0xAA},
+    {  1,  81, 0x55}, {  1,  93, 0xAA}, {  1,  54, 0x55}, {  1,  69, 0xAA}, {  1, 128, 0x55}, {  1,  47, 0x55},
+    {  1, 110, 0xAA}, {  1,  63, 0x55}, {  1, 107, 0x55}, {  1,  34, 0x55}, {  1, 111, 0xAA}, {  1, 115, 0x55},
+    {  1,  19, 0x55}, {  1, 100, 0xAA}, {  1, 136, 0x55}, {  1, 117, 0xAA}, {  1,  61, 0xAA}, {  1,  36, 0xAA},
+    {  1,  46, 0xAA}, {  1,  76, 0xAA}, {  1,  55, 0x55}, {  1, 116, 0xAA}, {  1,  18, 0xAA}, {  1, 133, 0x55},
+    {  1,  33, 0xAA}, {  1,  45, 0x55}, {  1,  87, 0xAA}, {  1,  72, 0x55}, {  1,  75, 0x55}, {  1,  21, 0xAA},
+    {  1,  21, 0x55}, {  1, 147, 0xAA}, {  1, 149, 0x55}, {  1,  69, 0xAA}, {  1, 139, 0xAA}, {  1, 117, 0xAA},
+    {  1, 108, 0xAA}, {  1,  87, 0xAA}, {  1,  44, 0xAA}, {  1,  16, 0x55}, {  1, 149, 0x55}, {  1, 124, 0xAA},
+    {  1,  11, 0xAA}, {  1,  31, 0xAA}, {  1,  13, 0xAA}, {  1,  11, 0x55}, {  1, 100, 0xFF}, {  1, 104, 0xFF},
+    {  1, 102, 0xAA}, {  1,  85, 0xFF}, {  1,  39, 0x55}, {  1, 102, 0xAA}, {  1, 110, 0x55}, {  1,  53, 0xAA},
+    {  1,  38, 0xFF}, {  1,  68, 0xAA}, {  1, 105, 0x55}, {  1, 114, 0xAA}, {  1,  35, 0x55}, {  1,  27, 0x55},
+    {  1,  64, 0x55}, {  1,  19, 0xFF}, {  2, 152, 0x33}, {  2, 168, 0x33}, {  2,  34, 0xC3}, {  2,  99, 0x3C},
+    {  2,  21, 0xEE}, {  2,  23, 0xFF}, {  2,  32, 0x0F}, {  2,  85, 0xCC}, {  2,  51, 0xEE}, {  2,  48, 0x3C},
+    {  2,  95, 0x0F}, {  2,  39, 0x77}, {  2, 156, 0x3C}, {  2,  12, 0xEE}, {  2, 107, 0x77}, {  2, 119, 0x3C},
+    {  2,  69, 0xCC}, {  2,  96, 0x77}, {  2,  46, 0xCC}, {  2,  27, 0x77}, {  2,  64, 0xEE}, {  2,  48, 0xEE},
+    {  2,  62, 0x3C}, {  2,  49, 0xCC}, {  2,  57, 0xFF}, {  2, 120, 0xF0}, {  2,  96, 0xEE}, {  2,   8, 0xC3},
+    {  2, 102, 0xEE}, {  2, 161, 0x33}, {  2,  65, 0xEE}, {  2, 106, 0xF0}, {  2, 141, 0x77}, {  2, 135, 0xEE},
+    {  2, 119, 0xEE}, {  2, 111, 0xFF}, {  2, 104, 0xCC}, {  2, 134, 0x77}, {  2,  48, 0x77}, {  2, 104, 0xF0},
+    {  2, 148, 0x77}, {  2,  91, 0xF0}, {  2, 130, 0x77}, {  2, 128, 0x3C}, {  2,  77, 0xCC}, {  2,  54, 0x77},
+    {  2,  57, 0xCC}, {  2,  20, 0x77}, {  2, 134, 0xCC}, {  2,  46, 0xEE}, {  2,  44, 0xFF}, {  2,  49, 0x3C},
+    {  2, 114, 0x77}, {  2,  50, 0x77}, {  2, 150, 0x33}, {  2,  96, 0x33}, {  2,  92, 0x0F}, {  2, 128, 0x33},
+    {  2,  16, 0x3C}, {  2, 156, 0xFF}, {  1,  57, 0x55}, {  1,  79, 0x55}, {  1, 147, 0xAA}, {  1,  59, 0xAA},
+    {  1,  90, 0x55}, {  1,  73, 0xAA}, {  1, 118, 0x55}, {  1, 123, 0x55}, {  1,  24, 0x55}, {  1, 121, 0xAA},
+    {  1,  89, 0xAA}, {  1, 119, 0x55}, {  1,  74, 0x55}, {  1,  66, 0xAA}, {  1,  44, 0x55}, {  1,  57, 0xAA},
+    {  1,  51, 0x55}, {  1,  52, 0xAA}, {  1,  44, 0x55}, {  1,  90, 0x55}, {  1,  87, 0x55}, {  1,  87, 0x55},
+    {  1,  39, 0x55}, {  1, 141, 0xAA}, {  1,  40, 0x55}, {  1,  65, 0x55}, {  1, 132, 0x55}, {  1,  93, 0xAA},
+    {  1, 120, 0x55}, {  1,  23, 0x55}, {  1, 130, 0x55}, {  1,  21, 0xAA}, {  1,  56, 0x55}, {  1, 135, 0xAA},
+    {  1,  18, 0xAA}, {  1, 144, 0xAA}, {  1,  85, 0xAA}, {  1, 131, 0xAA}, {  1,  11, 0x55}, {  1, 113, 0x55},
+    {  1, 114, 0x55}, {  1,  14, 0x55}, {  1,  24, 0x55}, {  1, 125, 0x55}, {  1,  90, 0x55}, {  1, 126, 0xAA},
+    {  1,  22, 0x55}, {  1, 100, 0xAA}, {  1, 139, 0xAA}, {  1, 139, 0xAA}, {  1,  42, 0xAA}, {  1, 114, 0xAA},
+    {  1,  32, 0xAA}, {  1,  25, 0x55}, {  1, 130, 0x55}, {  1, 141, 0xAA}, {  1,  61, 0x55}, {  1,  19, 0xAA},
+    {  1, 105, 0xAA}, {  1,  87, 0xAA}, {  1,  37, 0xAA}, {  1,  30, 0xAA}, {  1, 119, 0xAA}, {  1,  71, 0xAA},
+    {  1,  72, 0x55}, {  1,  27, 0x55}, {  1,  83, 0xFF}, {  1,  87, 0xAA}, {  1,  21, 0xAA}, {  1,  96, 0xFF},
+    {  1,  18, 0xFF}, {  1,  36, 0x55}, {  1,  87, 0xAA}, {  1,  12, 0x55}, {  1,  20, 0xFF}, {  1,  33, 0x55},
+    {  1, 118, 0x55}, {  1,  80, 0x55}, {  1,  81, 0xAA}, {  1,  50, 0xFF}, {  1,  10, 0x10}, {  1,  28, 0x08},
+    {  1,  37, 0x04}, {  1,  81, 0x02}, {  1,  81, 0x20}, {  1,  89, 0x80}, {  1,  96, 0x40}, {  1, 103, 0x01},
+    { 27, 119, 0x77}, { 27, 102, 0xFF}, { 27, 136, 0xF0}, { 27, 145, 0xF0}, { 27, 157, 0x0F}, { 27, 109, 0xF0},
+    { 27,  81, 0xEE}, { 27, 122, 0xEE}, { 27, 172, 0x33}, { 27,  93, 0x33}, { 27, 124, 0x77}, { 27,  94, 0xF0},
+    { 27, 121, 0xC3}, { 27, 144, 0xC3}, { 27, 127, 0xFF}, { 27, 149, 0x0F}, { 27, 112, 0x3C}, { 27, 163, 0x3C},
+    { 27,  33, 0x77}, { 27, 186, 0x3C}, { 27, 105, 0x0F}, { 27,  59, 0x77}, { 27,  58, 0x3C}, { 27, 101, 0x3C},
+    { 27, 171, 0x77}, { 27, 172, 0xC3}, { 27, 177, 0x33}, { 27,  69, 0x33}, { 27,  59, 0x0F}, { 27,  64, 0xFF},
+    { 27,  46, 0xC3}, { 27, 134, 0xCC}, { 27, 168, 0x3C}, { 27,  97, 0xC3}, { 27,  75, 0x77}, { 27, 146, 0xEE},
+    { 27, 157, 0x33}, { 27, 129, 0x77}, { 27, 182, 0x3C}, { 27,  91, 0xC3}, {  2, 165, 0xC3}, {  2,  38, 0x33},
+    {  2, 121, 0x0F}, {  2,  10, 0xC3}, {  2,  79, 0xC3}, {  2, 119, 0x3C}, {  2, 157, 0xCC}, {  2, 161, 0x77},
+    {  2,  87, 0x77}, {  2,  68, 0x33}, {  2, 127, 0xFF}, {  2, 147, 0xEE}, {  2, 113, 0xF0}, {  2,  50, 0x33},
+    {  2, 138, 0xC3}, {  2, 132, 0x3C}, {  2,  59, 0xFF}, {  2,  48, 0xFF}, {  2, 137, 0x3C}, {  2, 158, 0xCC},
+    {  2,  27, 0xEE}, {  2,  61, 0xCC}, {  2,  20, 0x3C}, {  2, 135, 0xFF}, {  2, 135, 0x0F}, {  2, 133, 0xFF},
+    {  2, 162, 0xF0}, {  2,  40, 0x0F}, {  2, 152, 0x33}, {  2,  58, 0xF0}, {  2, 161, 0xFF}, {  2, 164, 0xC3},
+    {  2,  56, 0xF0}, {  2,  44, 0xEE}, {  2, 149, 0xC3}, {  2,  95, 0xEE}, {  2,  20, 0xC3}, {  2, 122, 0xEE},
+    {  2, 146, 0xC3}, {  2, 102, 0xFF}, {  2, 116, 0x0F}, {  2,  72, 0x0F}, {  2,  84, 0xCC}, {  2, 154, 0xF0},
+    {  2, 157, 0xC3}, {  2, 152, 0x0F}, {  2, 170, 0x0F}, {  2,  92, 0xFF}, {  2,  43, 0x33}, {  2,  71, 0xFF},
+    {  2, 105, 0x77}, {  2,  29, 0x3C}, {  2, 107, 0x0F}, {  2,  26, 0x33}, {  2,  77, 0x77}, {  2, 115, 0x0F},
+    {  2,  34, 0xFF}, {  2, 102, 0xFF}, {  2, 114, 0xC3}, {  2, 157, 0xC3}, {  1,  87, 0x55}, {  1,  71, 0xAA},
+    {  1, 130, 0x55}, {  1,  80, 0xAA}, {  1, 145, 0xAA}, {  1, 120, 0xAA}, {  1, 139, 0xAA}, {  1,  54, 0x55},
+    {  1,  99, 0x55}, {  1, 108, 0xAA}, {  1,  63, 0xAA}, {  1,  37, 0x55}, {  1,  10, 0xAA}, {  1,  44, 0xAA},
+    {  1, 130, 0x55}, {  1, 121, 0x55}, {  1,  34, 0xAA}, {  1,  60, 0x55}, {  1, 147, 0xAA}, {  1, 143, 0xAA},
+    {  1,  48, 0xAA}, {  1,  95, 0xAA}, {  1,  15, 0xAA}, {  1,  81, 0xAA}, {  1,  63, 0xAA}, {  1,  70, 0x55},
+    {  1,  40, 0xAA}, {  1,  14, 0xAA}, {  1,  38, 0x55}, {  1, 147, 0x55}, {  1,  67, 0x55}, {  1,  71, 0x55},
+    {  1,  60, 0x55}, {  1,  59, 0x55}, {  1,  26, 0xAA}, {  1,  33, 0xAA}, {  1,  41, 0xAA}, {  1, 142, 0x55},
+    {  1,  46, 0xAA}, {  1, 110, 0x55}, {  1, 122, 0x55}, {  1, 132, 0xAA}, {  1,  46, 0xAA}, {  1,  33, 0xAA},
+    {  1,  99, 0xAA}, {  1, 116, 0xAA}, {  1,  62, 0xAA}, {  1,  94, 0x55}, {  1, 121, 0xAA}, {  1,  43, 0x55},
+    {  1,  93, 0xAA}, {  1,  66, 0xAA}, {  1, 143, 0xAA}, {  1, 122, 0x55}, {  1,  27, 0xAA}, {  1,  25, 0xAA},
+    {  1, 135, 0x55}, {  1,  43, 0xAA}, {  1, 107, 0xAA}, {  1, 114, 0x55}, {  1,  28, 0xAA}, {  1, 110, 0xAA},
+    {  1, 115, 0xAA}, {  1, 101, 0x55}, {  1,  23, 0xFF}, {  1,  68, 0x55}, {  1,  51, 0xFF}, {  1,  49, 0x55},
+    {  1, 118, 0xAA}, {  1,  11, 0xFF}, {  1,  79, 0xAA}, {  1,  71, 0xFF}, {  1, 107, 0xFF}, {  1,  97, 0xFF},
+    {  1,  68, 0xAA}, {  1,  70, 0xFF}, {  1,  32, 0xFF}, {  1,  17, 0xAA}, {  1,  35, 0xAA}, {  1, 122, 0xAA},
+    {  1,  20, 0x08}, {  1,  22, 0x04}, {  1,  24, 0x01}, {  1,  25, 0x40}, {  1,  52, 0x20}, {  1,  92, 0x10},
+    {  1,  96, 0x80}, {  1, 116, 0x02}, { 27,  22, 0x77}, { 27,  72, 0x0F}, { 27,  31, 0xCC}, { 27,  79, 0x0F},
+    { 27,  86, 0xC3}, { 27,  69, 0xFF}, { 27,  83, 0x0F}, { 27,  81, 0xF0}, { 27,  29, 0x77}, { 27,  27, 0x33},
+    { 27,  55, 0xF0}, { 27, 122, 0x0F}, { 27,  98, 0x33}, { 27, 182, 0x33}, { 27,  93, 0xFF}, { 27,  87, 0x3C},
+    { 27,  98, 0xEE}, { 27,  97, 0xFF}, { 27, 118, 0x33}, { 27, 135, 0xCC}, { 27, 174, 0x33}, { 27,  41, 0x0F},
+    { 27,  30, 0x0F}, { 27,  98, 0x0F}, { 27,  27, 0xEE}, { 27,  22, 0xF0}, { 27, 130, 0xEE}, { 27, 186, 0x77},
+    { 27, 138, 0xEE}, { 27, 175, 0xCC}, { 27, 140, 0x3C}, { 27,  54, 0xFF}, { 27, 143, 0xCC}, { 27,  99, 0x33},
+    { 27, 183, 0xCC}, { 27, 161, 0x0F}, { 27, 103, 0xF0}, { 27, 188, 0x33}, { 27, 154, 0x33}, { 27, 180, 0x3C},
+    {  2,  23, 0xCC}, {  2,  51, 0xCC}, {  2,  74, 0xFF}, {  2, 166, 0x3C}, {  2,  29, 0x77}, {  2,  11, 0x3C},
+    {  2,  63, 0x77}, {  2,   7, 0x0F}, {  2,  91, 0x3C}, {  2,  40, 0xC3}, {  2,  43, 0xFF}, {  2, 122, 0xC3},
+    {  2,  43, 0x0F}, {  2,  44, 0x33}, {  2, 155, 0xCC}, {  2,  72, 0xEE}, {  2,  93, 0xFF}, {  2, 154, 0xFF},
+    {  2,  95, 0xC3}, {  2,  25, 0xFF}, {  2, 157, 0x77}, {  2, 104, 0xCC}, {  2,  19, 0xF0}, {  2,  31, 0xC3},
+    {  2, 118, 0xEE}, {  2,  15, 0xF0}, {  2, 108, 0x0F}, {  2, 130, 0x3C}, {  2, 116, 0xCC}, {  2,  66, 0x0F},
+    {  2,   9, 0xF0}, {  2, 125, 0x33}, {  2,  57, 0x77}, {  2, 124, 0xFF}, {  2,  94, 0xC3}, {  2,   9, 0xFF},
+    {  2,  50, 0xF0}, {  2, 119, 0x0F}, {  2,  74, 0xC3}, {  2,  91, 0x77}, {  2, 140, 0xF0}, {  2, 101, 0xFF},
+    {  2, 159, 0xFF}, {  2, 163, 0x77}, {  2, 161, 0xC3}, {  2,  13, 0xEE}, {  2,  64, 0x3C}, {  2, 104, 0xF0},
+    {  2, 143, 0xEE}, {  2,  85, 0xF0}, {  2, 105, 0xFF}, {  2, 125, 0xF0}, {  2, 141, 0x3C}, {  2,  94, 0xF0},
+    {  2, 165, 0x0F}, {  2,  57, 0xCC}, {  2, 147, 0xC3}, {  2,  40, 0xEE}, {  2,  78, 0xEE}, {  2, 128, 0x0F},
+    {  1,  31, 0xAA}, {  1,  43, 0xAA}, {  1,  78, 0xAA}, {  1,  65, 0x55}, {  1,  14, 0xAA}, {  1,  16, 0xAA},
+    {  1,  56, 0xAA}, {  1,  69, 0xAA}, {  1,  83, 0xAA}, {  1,  96, 0xAA}, {  1,  92, 0x55}, {  1,  26, 0x55},
+    {  1,  66, 0xAA}, {  1,  35, 0x55}, {  1, 120, 0xAA}, {  1, 147, 0xAA}, {  1, 147, 0x55}, {  1, 111, 0x55},
+    {  1, 144, 0x55}, {  1, 129, 0x55}, {  1, 131, 0x55}, {  1,  32, 0x55}, {  1,  30, 0xAA}, {  1, 148, 0xAA},
+    {  1, 113, 0xAA}, {  1,  32, 0x55}, {  1,  30, 0x55}, {  1, 107, 0xAA}, {  1,  19, 0xAA}, {  1,  14, 0xAA},
+    {  1,  70, 0x55}, {  1,  24, 0x55}, {  1, 141, 0x55}, {  1,  17, 0xAA}, {  1,  68, 0xAA}, {  1,  49, 0x55},
+    {  1,  20, 0xAA}, {  1,  82, 0x55}, {  1, 145, 0xAA}, {  1,  67, 0x55}, {  1, 131, 0x55}, {  1,  73, 0xAA},
+    {  1, 141, 0x55}, {  1,  72, 0xAA}, {  1, 130, 0x55}, {  1, 105, 0xAA}, {  1, 138, 0x55}, {  1, 110, 0x55},
+    {  1,  52, 0x55}, {  1,  31, 0x55}, {  1,  25, 0xAA}, {  1, 141, 0xAA}, {  1,  56, 0x55}, {  1,  23, 0xAA},
+    {  1, 148, 0xAA}, {  1,  15, 0xAA}, {  1,  95, 0x55}, {  1,  12, 0x55}, {  1,  81, 0xAA}, {  1, 109, 0xAA},
+    {  1,  68, 0xFF}, {  1,  20, 0xAA}, {  1,  32, 0xAA}, {  1,  87, 0xFF}, {  1, 116, 0xFF}, {  1,  62, 0xFF},
+    {  1,  79, 0xFF}, {  1,  46, 0x55}, {  1,  62, 0xAA}, {  1,  30, 0xAA}, {  1,  38, 0xAA}, {  1,  53, 0xFF},
+    {  1, 121, 0xAA}, {  1,  46, 0xAA}, {  1,  89, 0x55}, {  1, 109, 0xFF}, {  1,  64, 0xAA}, {  1,  66, 0x55},
+    {  1,  30, 0x55}, {  1,  38, 0xAA}, {  1,  19, 0x80}, {  1,  57, 0x08}, {  1,  60, 0x40}, {  1,  63, 0x10},
+    {  1,  81, 0x02}, {  1,  84, 0x01}, {  1,  92, 0x04}, {  1,  97, 0x20}, { 27, 189, 0xFF}, { 27, 120, 0xEE},
+    { 27,  77, 0x0F}, { 27,  84, 0xC3}, { 27,  23, 0xCC}, { 27, 119, 0x33}, { 27, 135, 0x0F}, { 27, 139, 0xF0},
+    { 27,  44, 0xFF}, { 27, 115, 0xCC}, { 27, 185, 0x33}, { 27, 124, 0x3C}, { 27, 108, 0x0F}, { 27, 157, 0x77},
+    { 27, 182, 0xCC}, { 27, 165, 0x77}, { 27, 110, 0xC3}, { 27, 136, 0xC3}, { 27, 104, 0xF0}, { 27, 143, 0x3C},
+    { 27,  22, 0x0F}, { 27, 137, 0xC3}, { 27, 160, 0xCC}, { 27, 169, 0xCC}, { 27, 184, 0xF0}, { 27, 155, 0x0F},
+    { 27, 134, 0x0F}, { 27,  90, 0x0F}, { 27,  86, 0xC3}, { 27,  57, 0x3C}, { 27, 179, 0x77}, { 27,  59, 0xCC},
+    { 27,  81, 0x33}, { 27,  28, 0xCC}, { 27, 184, 0x0F}, { 27, 148, 0xFF}, { 27, 164, 0xF0}, { 27,  77, 0xFF},
+    { 27, 162, 0xF0}, { 27, 188, 0x0F}, {  2, 162, 0x77}, {  2, 100, 0xCC}, {  2,  44, 0x77}, {  2, 133, 0x33},
+    {  2,  73, 0x3C}, {  2,  43, 0x33}, {  2,  60, 0xCC}, {  2,  63, 0x77}, {  2, 101, 0xFF}, {  2, 166, 0xCC},
+    {  2,  37, 0x0F}, {  2, 155, 0xC3}, {  2,  91, 0x3C}, {  2, 170, 0xFF}, {  2,  87, 0x33}, {  2,  18, 0xC3},
+    {  2, 150, 0x77}, {  2, 142, 0xFF}, {  2, 161, 0xF0}, {  2,  46, 0xC3}, {  2, 115, 0xC3}, {  2, 121, 0xCC},
+    {  2,  18, 0xCC}, {  2, 105, 0xEE}, {  2, 163, 0x0F}, {  2,  28, 0x77}, {  2,  79, 0xCC}, {  2,  38, 0x0F},
+    {  2,  54, 0xEE}, {  2,  24, 0x77}, {  2, 101, 0xFF}, {  2,  70, 0x33}, {  2,  38, 0x0F}, {  2, 147, 0xFF},
+    {  2,  76, 0xCC}, {  2,  29, 0x0F}, {  2,  87, 0xEE}, {  2, 140, 0xCC}, {  2, 153, 0xCC}, {  2, 160, 0x77},
+    {  2,  49, 0xF0}, {  2,  20, 0x0F}, {  2,  96, 0x33}, {  2,  53, 0xF0}, {  2, 115, 0xC3}, {  2, 160, 0x33},
+    {  2,  82, 0x3C}, {  2,  47, 0xC3}, {  2, 163, 0xF0}, {  2, 149, 0xF0}, {  2,  49, 0x0F}, {  2,  67, 0x33},
+    {  2, 169, 0x33}, {  2, 144, 0x3C}, {  2,  71, 0x0F}, {  2, 114, 0xC3}, {  2, 100, 0x0F}, {  2,  96, 0xF0},
+    {  2,  70, 0xC3}, {  2,  61, 0xC3}, {  1,  27, 0xAA}, {  1,  54, 0x55}, {  1,  53, 0xAA}, {  1,  37, 0x55},
+    {  1, 116, 0x55}, {  1,  68, 0xAA}, {  1, 143, 0xAA}, {  1, 121, 0x55}, {  1,  62, 0xAA}, {  1,  66, 0x55},
+    {  1,  74, 0x55}, {  1, 122, 0x55}, {  1,  63, 0xAA}, {  1,  84, 0xAA}, {  1,  65, 0xAA}, {  1,  21, 0x55},
+    {  1, 108, 0x55}, {  1,  67, 0xAA}, {  1,  37, 0x55}, {  1,  63, 0x55}, {  1, 119, 0xAA}, {  1,  81, 0x55},
+    {  1,  89, 0x55}, {  1,  75, 0xAA}, {  1, 106, 0xAA}, {  1,  48, 0x55}, {  1, 141, 0xAA}, {  1,  10, 0xAA},
+    {  1,  68, 0x55}, {  1, 118, 0xAA}, {  1,  85, 0x55}, {  1, 138, 0xAA}, {  1,  43, 0x55}, {  1, 143, 0xAA},
+    {  1,  14, 0xAA}, {  1,  48, 0xAA}, {  1,  71, 0xAA}, {  1,  93, 0xAA}, {  1,  83, 0xAA}, {  1, 123, 0xAA},
+    {  1,  96, 0xAA}, {  1, 136, 0x55}, {  1,  80, 0xAA}, {  1,  55, 0x55}, {  1,  52, 0xAA}, {  1,  97, 0xAA},
+    {  1, 134, 0x55}, {  1, 104, 0xAA}, {  1, 113, 0x55}, {  1,  98, 0xAA}, {  1,  44, 0xAA}, {  1,  33, 0xAA},
+    {  1,  86, 0xAA}, {  1, 109, 0x55}, {  1,  45, 0xAA}, {  1,  32, 0xAA}, {  1, 121, 0x55}, {  1,  31, 0x55},
+    {  1,  85, 0xAA}, {  1,  14, 0xAA}, {  1,  95, 0x55}, {  1,  38, 0xAA}, {  1, 112, 0xFF}, {  1,  33, 0xFF},
+    {  1,  19, 0x55}, {  1,  26, 0x55}, {  1,  42, 0x55}, {  1, 106, 0xAA}, {  1,  30, 0xFF}, {  1,  14, 0xAA},
+    {  1, 110, 0x55}, {  1,  77, 0xFF}, {  1,  53, 0x55}, {  1,  80, 0x55}, {  1,  96, 0xAA}, {  1,  49, 0x55},
+    {  1,  32, 0xAA}, {  1,  48, 0x55}, {  1, 116, 0xAA}, {  1,  63, 0xFF}, {  1,  48, 0x80}, {  1,  62, 0x01},
+    {  1,  67, 0x40}, {  1,  92, 0x20}, {  1, 115, 0x04}, {  1, 118, 0x08}, {  1, 118, 0x10}, {  1, 119, 0x02},
+    { 27, 163, 0xFF}, { 27,  32, 0x3C}, { 27, 175, 0x33}, { 27,  56, 0xCC}, { 27, 137, 0x33}, { 27,  24, 0xEE},
+    { 27, 189, 0x77}, { 27, 182, 0xFF}, { 27,  52, 0xEE}, { 27, 133, 0xEE}, { 27,  47, 0x0F}, { 27, 173, 0x33},
+    { 27,  96, 0x33}, { 27, 127, 0x33}, { 27,  73, 0xFF}, { 27,  80, 0xEE}, { 27, 105, 0xF0}, { 27,  23, 0x77},
+    { 27, 162, 0xEE}, { 27,  35, 0xC3}, { 27, 144, 0x3C}, { 27,  33, 0xC3}, { 27,  51, 0x0F}, { 27,  74, 0xCC},
+    { 27, 117, 0x0F}, { 27, 124, 0x33}, { 27, 142, 0xEE}, { 27, 129, 0xFF}, { 27, 115, 0x3C}, { 27,  50, 0xC3},
+    { 27,  46, 0xF0}, { 27,  78, 0xC3}, { 27, 100, 0xFF}, { 27, 172, 0xC3}, { 27, 118, 0x77}, { 27, 129, 0x3C},
+    { 27,  65, 0x77}, { 27, 187, 0x33}, { 27,  54, 0x77}, { 27, 178, 0x77}, {  2,  77, 0xF0}, {  2, 120, 0xC3},
+    {  2, 167, 0x3C}, {  2,  44, 0xEE}, {  2,  33, 0x3C}, {  2,  26, 0xF0}, {  2,  58, 0x0F}, {  2,  12, 0x0F},
+    {  2,  11, 0xF0}, {  2,  70, 0xC3}, {  2, 115, 0xCC}, {  2,  22, 0xEE}, {  2,  70, 0x33}, {  2,  65, 0xFF},
+    {  2, 169, 0xC3}, {  2,  80, 0xC3}, {  2, 123, 0xC3}, {  2, 112, 0xFF}, {  2, 135, 0xEE}, {  2, 131, 0xFF},
+    {  2,  75, 0x77}, {  2, 124, 0x77}, {  2,  73, 0x77}, {  2,  35, 0xFF}, {  2, 164, 0x77}, {  2, 126, 0xF0},
+    {  2, 103, 0x77}, {  2,  81, 0xC3}, {  2,  68, 0xF0}, {  2,  59, 0xCC}, {  2, 157, 0xFF}, {  2,  90, 0xF0},
+    {  2, 123, 0x33}, {  2,  62, 0xF0}, {  2, 147, 0xC3}, {  2,  12, 0xC3}, {  2, 100, 0xEE}, {  2,  98, 0x33},
+    {  2,  78, 0xEE}, {  2, 159, 0xC3}, {  2,  23, 0x33}, {  2,  95, 0x0F}, {  2, 124, 0xCC}, {  2,  73, 0x33},
+    {  2,  20, 0x77}, {  2,  59, 0xEE}, {  2,  35, 0x33}, {  2, 105, 0xCC}, {  2,   7, 0x33}, {  2, 123, 0x77},
+    {  2, 153, 0x3C}, {  2, 119, 0xC3}, {  2, 147, 0xEE}, {  2,  45, 0xFF}, {  2,  32, 0xC3}, {  2,  50, 0xC3},
+    {  2,  74, 0x33}, {  2,  61, 0xCC}, {  2,  74, 0xC3}, {  2,  63, 0xEE}, {  1,  34, 0xAA}, {  1,  26, 0xAA},
+    {  1,  11, 0x55}, {  1,  19, 0xAA}, {  1,  81, 0xAA}, {  1,  14, 0x55}, {  1,  11, 0x55}, {  1,  73, 0x55},
+    {  1,  73, 0x55}, {  1, 126, 0xAA}, {  1, 120, 0xAA}, {  1, 145, 0x55}, {  1,  69, 0x55}, {  1, 115, 0xAA},
+    {  1, 110, 0xAA}, {  1, 112, 0x55}, {  1, 110, 0xAA}, {  1,  39, 0x55}, {  1,  91, 0xAA}, {  1,  56, 0x55},
+    {  1, 101, 0xAA}, {  1,  82, 0x55}, {  1,  26, 0x55}, {  1,  51, 0x55}, {  1,  80, 0x55}, {  1,  23, 0xAA},
+    {  1,  60, 0xAA}, {  1,  94, 0xAA}, {  1, 144, 0xAA}, {  1,  12, 0xAA}, {  1, 137, 0x55}, {  1, 131, 0x55},
+    {  1, 132, 0x55}, {  1,  66, 0xAA}, {  1, 147, 0xAA}, {  1,  12, 0x55}, {  1,  59, 0x55}, {  1,  98, 0x55},
+    {  1,  64, 0x55}, {  1,  40, 0xAA}, {  1,  11, 0x55}, {  1,  57, 0xAA}, {  1, 124, 0xAA}, {  1,  12, 0xAA},
+    {  1,  93, 0xAA}, {  1,  38, 0xAA}, {  1,  88, 0x55}, {  1,  45, 0x55}, {  1,  98, 0xAA}, {  1,  73, 0x55},
+    {  1, 111, 0xAA}, {  1,  58, 0xAA}, {  1, 148, 0x55}, {  1,  93, 0x55}, {  1,  10, 0x55}, {  1,  31, 0xAA},
+    {  1,  48, 0xAA}, {  1,  60, 0x55}, {  1,  28, 0x55}, {  1, 121, 0xAA}, {  1,  44, 0xFF}, {  1, 130, 0x55},
+    {  1,  34, 0xAA}, {  1,  73, 0xAA}, {  1, 117, 0xFF}, {  1,  17, 0xFF}, {  1,  34, 0x55}, {  1,  62, 0xFF},
+    {  1,  17, 0xFF}, {  1,  40, 0x55}, {  1,  78, 0xFF}, {  1, 125, 0x55}, {  1,  26, 0xFF}, {  1,  82, 0x55},
+    {  1,  65, 0x55}, {  1,  18, 0xFF}, {  1,  47, 0xFF}, {  1,  39, 0xAA}, {  1,  88, 0x55}, {  1,  77, 0xFF},
+    {  1,  60, 0x10}, {  1,  65, 0x04}, {  1,  66, 0x08}, {  1,  79, 0x40}, {  1,  87, 0x80}, {  1,  89, 0x20},
+    {  1, 105, 0x01}, {  1, 109, 0x02}, { 27, 111, 0x3C}, { 27, 136, 0x3C}, { 27,  33, 0xC3}, { 27,  62, 0xEE},
+    { 27, 126, 0x77}, { 27, 171, 0x3C}, { 27,  53, 0xC3}, { 27, 140, 0x77}, { 27, 109, 0x33}, { 27, 104, 0x0F},
+    { 27,  94, 0xFF}, { 27,  95, 0xEE}, { 27, 110, 0xFF}, { 27, 130, 0xEE}, { 27,  90, 0xF0}, { 27, 163, 0x33},
+    { 27, 150, 0x3C}, { 27,  29, 0xCC}, { 27,  68, 0xFF}, { 27, 106, 0x77}, { 27,  42, 0x77}, { 27,  47, 0x0F},
+    { 27, 140, 0xEE}, { 27, 158, 0x77}, { 27, 118, 0x3C}, { 27,  28, 0x3C}, { 27, 130, 0x0F}, { 27, 183, 0xEE},
+    { 27, 183, 0xFF}, { 27, 152, 0xCC}, { 27,  35, 0xF0}, { 27,  42, 0xFF}, { 27, 138, 0xEE}, { 27, 165, 0xFF},
+    { 27,  36, 0x77}, { 27, 101, 0xF0}, { 27,  45, 0x33}, { 27,  97, 0xC3}, { 27,  87, 0xFF}, { 27,  26, 0xEE},
+    {  2, 127, 0x3C}, {  2,  34, 0xC3}, {  2, 166, 0x0F}, {  2,  24, 0x3C}, {  2, 130, 0x3C}, {  2, 146, 0x3C},
+    {  2, 140, 0xF0}, {  2,  72, 0x77}, {  2,  80, 0xC3}, {  2, 110, 0xFF}, {  2,  25, 0xEE}, {  2, 170, 0x77},
+    {  2,  57, 0xC3}, {  2,  64, 0x3C}, {  2,  38, 0x77}, {  2, 112, 0xC3}, {  2,  38, 0xC3}, {  2,  33, 0xF0},
+    {  2, 160, 0x3C}, {  2, 168, 0xCC}, {  2,  54, 0x3C}, {  2,  66, 0xCC}, {  2, 158, 0xFF}, {  2, 132, 0xEE},
+    {  2,  71, 0x3C}, {  2,  74, 0xFF}, {  2, 110, 0xEE}, {  2,  74, 0x33}, {  2, 135, 0xF0}, {  2,  69, 0x3C},
+    {  2,  29, 0xF0}, {  2,  88, 0xC3}, {  2,  84, 0xC3}, {  2,  89, 0x3C}, {  2, 122, 0xFF}, {  2, 126, 0x77},
+    {  2, 112, 0xCC}, {  2,   9, 0xF0}, {  2,  98, 0xF0}, {  2, 152, 0x77}, {  2,  69, 0x77}, {  2, 110, 0xFF},
+    {  2, 121, 0xEE}, {  2, 108, 0x3C}, {  2,  32, 0xEE}, {  2, 134, 0x77}, {  2, 136, 0xF0}, {  2,  38, 0x77},
+    {  2, 138, 0x0F}, {  2,  12, 0xF0}, {  2,  15, 0xC3}, {  2, 127, 0xCC}, {  2,  61, 0xF0}, {  2,  16, 0xC3},
+    {  2,  43, 0x3C}, {  2, 131, 0x3C}, {  2,  19, 0x33}, {  2,  52, 0x77}, {  2,  17, 0xCC}, {  2,  38, 0x0F},
+    { 27,  74, 0xFF}, { 27, 116, 0x77}, { 27, 118, 0xEE}, { 27,  48, 0x3C}, { 27,  71, 0x0F}, { 27, 140, 0xEE},
+    { 27, 146, 0xFF}, { 27, 122, 0x3C}, { 27, 105, 0x0F}, { 27, 147, 0x77}, { 27, 138, 0x77}, { 27,  72, 0x0F},
+    { 27,  29, 0xC3}, { 27,  83, 0xCC}, { 27,  21, 0x77}, { 27,  58, 0x33}, { 27,  91, 0x0F}, { 27,  34, 0x3C},
+    { 27,  76, 0x33}, { 27,  44, 0xC3}, { 27, 137, 0xCC}, { 27,  43, 0xF0}, { 27,  37, 0x33}, { 27, 109, 0x77},
+    { 27, 154, 0xF0}, { 27, 101, 0x77}, { 27, 113, 0xC3}, { 27,  63, 0xCC}, { 27,  59, 0xFF}, { 27,  40, 0x77},
+    { 27,  91, 0x3C}, { 27, 101, 0xC3}, { 27,  91, 0xEE}, { 27,  86, 0xFF}, { 27,  35, 0x77}, { 27,  80, 0xF0},
+    { 27,  86, 0x77}, { 27,  49, 0xF0}, { 27, 115, 0xFF}, { 27, 147, 0x3C}, {  1,  54, 0xAA}, {  1,  60, 0xAA},
+    {  1,  85, 0xAA}, {  1,  90, 0x55}, {  1,  29, 0x55}, {  1, 111, 0xAA}, {  1,  80, 0x55}, {  1,  62, 0xAA},
+    {  1,  83, 0x55}, {  1,  72, 0x55}, {  1,  47, 0xAA}, {  1,  63, 0xAA}, {  1,  28, 0x55}, {  1,  86, 0x55},
+    {  1, 100, 0x55}, {  1,  60, 0xAA}, {  1, 142, 0x55}, {  1,  83, 0x55}, {  1, 150, 0xAA}, {  1,  72, 0xAA},
+    {  1,  31, 0xAA}, {  1, 120, 0x55}, {  1,  74, 0x55}, {  1,  26, 0xAA}, {  1, 125, 0x55}, {  1, 126, 0x55},
+    {  1,  79, 0x55}, {  1,  48, 0x55}, {  1,  50, 0xAA}, {  1, 132, 0x55}, {  1,  61, 0x55}, {  1, 120, 0xAA},
+    {  1,  75, 0xAA}, {  1,  50, 0x55}, {  1, 127, 0x55}, {  1, 135, 0xAA}, {  1,  45, 0xAA}, {  1,  85, 0xAA},
+    {  1,  81, 0xAA}, {  1,  67, 0x55}, {  1,  27, 0x55}, {  1, 135, 0x55}, {  1,  86, 0x55}, {  1, 123, 0x55},
+    {  1, 118, 0xAA}, {  1, 125, 0xAA}, {  1,  61, 0xAA}, {  1, 125, 0xAA}, {  1,  65, 0x55}, {  1, 112, 0x55},
+    {  1, 124, 0xAA}, {  1, 104, 0x55}, {  1,  81, 0xAA}, {  1,  54, 0x55}, {  1,  59, 0x55}, {  1,  36, 0x55},
+    {  1, 150, 0xAA}, {  1, 146, 0x55}, {  1,  35, 0x55}, {  1,  40, 0xAA}, {  1, 119, 0xFF}, {  1, 116, 0x55},
+    {  1,  38, 0xFF}, {  1, 122, 0x55}, {  1,  35, 0xFF}, {  1,  13, 0xFF}, {  1,  31, 0x55}, {  1,  86, 0xAA},
+    {  1,  33, 0xFF}, {  1,  94, 0xAA}, {  1, 103, 0x55}, {  1,  17, 0x55}, {  1, 126, 0x55}, {  1,  46, 0xFF},
+    {  1,  61, 0xFF}, {  1,  34, 0xAA}, {  1, 117, 0xAA}, {  1,  27, 0xFF}, {  1, 109, 0xFF}, {  1, 112, 0xFF},
+    {125, 216, 0x0F}, {125,  91, 0x18}, {125, 189, 0x18}, {125, 201, 0x0F}, {125, 143, 0x81}, {125,  74, 0xFF},
+    {125, 170, 0x18}, {125,  70, 0x0F}, {125, 205, 0x0F}, {125, 167, 0x18}, {125, 110, 0xFF}, {125,  97, 0x0F},
+    {125, 159, 0x81}, {125,  92, 0x81}, {125, 218, 0xFF}, {125,  94, 0x0F}, {125,  86, 0xFF}, {125,  79, 0x0F},
+    {125, 137, 0x18}, {125, 107, 0x0F}, {125, 122, 0xFF}, {125, 161, 0xFF}, {125, 124, 0xFF}, {125, 138, 0xFF},
+    {125, 105, 0x18}, {125, 110, 0x0F}, {125,  97, 0x18}, {125, 125, 0x0F}, {125, 181, 0x81}, {125, 189, 0x18},
+    {125,  91, 0x0F}, {125, 149, 0xFF}, {125,  72, 0x18}, {125,  98, 0x0F}, {125, 153, 0x18}, {125, 187, 0x18},
+    {125,  83, 0x81}, {125,  71, 0x81}, {125, 142, 0x0F}, {125, 163, 0x18}, {125, 106, 0x18}, {125, 160, 0x81},
+    {125, 197, 0xFF}, {125, 220, 0x81}, {125, 212, 0x81}, {125, 173, 0x18}, {125,  79, 0x0F}, {125,  98, 0x81},
+    {125,  89, 0xFF}, {125, 172, 0x81}, {125,  88, 0x81}, {125, 133, 0x0F}, {125,  67, 0x18}, {125, 116, 0xFF},
+    {125, 175, 0x18}, {125,  73, 0x18}, {125, 199, 0xFF}, {125, 220, 0xFF}, {125, 218, 0x81}, {125, 100, 0x0F},
+    {125, 122, 0xFF}, {125, 111, 0x0F}, {125, 167, 0x81}, {125, 118, 0x81}, {125,  74, 0xFF}, {125, 177, 0x81},
+    {125, 154, 0x0F}, {125, 210, 0x81}, {125,  80, 0xFF}, {125, 193, 0x81}, {125, 123, 0x0F}, {125, 161, 0x0F},
+    {125,  82, 0x81}, {125,  98, 0x81}, {125, 217, 0xFF}, {125, 210, 0x81}, {125, 139, 0xFF}, {125, 123, 0x81},
+    {125,  94, 0x0F}, {125,  84, 0x0F}, {125,  87, 0x81}, {125, 143, 0x0F}, {125, 178, 0x18}, {125,  80, 0x18},
+    {125, 158, 0xFF}, {125, 174, 0x81}, {125, 176, 0x18}, {125, 137, 0x81}, {125, 214, 0x18}, {125, 213, 0xFF},
+    {125, 114, 0x18}, {125, 163, 0x81}, {125,  99, 0x0F}, {125,  78, 0x18}, {125, 102, 0x18}, {125, 152, 0x0F},
+};
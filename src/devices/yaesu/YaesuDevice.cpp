@@ -2,22 +2,42 @@
 // SPDX-License-Identifier: MIT
 
 #include "YaesuDevice.h"
-#include <stdio.h>
+#include "core/FixedWriter.h"
 
 // Baud rate options
 static const char* const baudRateValues[] = {"4800", "9600", "19200", "38400"};
 static const uint32_t baudRates[] = {4800, 9600, 19200, 38400};
 #define NUM_BAUD_RATES 4
-#define DEFAULT_BAUD_INDEX 3  // 38400
+#define DEFAULT_BAUD_INDEX 3  // 38400, for models whose default is not listed
 
-YaesuDevice::YaesuDevice(ISerialPort* serial, uint8_t uartIndex)
-    : _serial(serial)
-    , _uartIndex(uartIndex)
+// Meter dynamics options, in MeterDynamics order
+static const char* const meterValues[] = {"static", "rayleigh", "rician"};
+#define NUM_METER_MODES 3
+
+// Index of the model's default CAT rate
+static uint8_t defaultBaudIndex(const CATModel& model) {
+    for (uint8_t i = 0; i < NUM_BAUD_RATES; i++) {
+        if (baudRates[i] == model.baudRate) {
+            return i;
+        }
+    }
+    return DEFAULT_BAUD_INDEX;
+}
+
+YaesuDevice::YaesuDevice(ISerialPort* serial, uint8_t uartIndex, const CATModel& model)
+    : _uartIndex(uartIndex)
     , _deviceId(0xFF)
     , _running(false)
     , _logger(nullptr)
-    , _parser(_state, *serial)
 {
+    memcpy_P(&_model, &model, sizeof(_model));
+    for (size_t i = 0; i < DEVICE_MAX_PORTS; i++) {
+        _parsers[i] = nullptr;
+    }
+    if (serial != nullptr) {
+        _ports.add(serial, uartIndex);
+        _parsers[0] = new CATParser(_model, _state, *serial, &_cache, &_memory, &_bandMap);
+    }
     _state.reset();
     initOptions();
 }
@@ -26,6 +46,49 @@ YaesuDevice::~YaesuDevice() {
     if (_running) {
         end();
     }
+    for (size_t i = 0; i < DEVICE_MAX_PORTS; i++) {
+        delete _parsers[i];
+    }
+}
+
+bool YaesuDevice::attachPort(ISerialPort* serial, uint8_t uartIndex) {
+    if (!_ports.add(serial, uartIndex)) {
+        return false;
+    }
+
+    CATParser* parser = new CATParser(_model, _state, *serial, &_cache, &_memory, &_bandMap);
+    parser->setLogger(_logger);
+    applyLatency(parser);
+    _parsers[_ports.count() - 1] = parser;
+
+    if (_running) {
+        serial->begin(baudRates[_options[0].value.enumVal.current]);
+    }
+
+    if (_logger) {
+        _logger->logf(LogLevel::INFO, "Yaesu", "Device %d also on UART %d", _deviceId, uartIndex);
+    }
+    return true;
+}
+
+bool YaesuDevice::detachPort(uint8_t uartIndex) {
+    int index = _ports.indexOf(uartIndex);
+    if (index <= 0) {
+        return false;  // Not attached, or the primary port
+    }
+
+    if (_running) {
+        _ports.getPort(index)->end();
+    }
+    delete _parsers[index];
+
+    // Keep parsers in step with the ports
+    for (size_t i = (size_t)index; i + 1 < _ports.count(); i++) {
+        _parsers[i] = _parsers[i + 1];
+    }
+    _parsers[_ports.count() - 1] = nullptr;
+    _ports.remove(uartIndex);
+    return true;
 }
 
 void YaesuDevice::initOptions() {
@@ -35,7 +98,7 @@ void YaesuDevice::initOptions() {
         "Serial baud rate",
         baudRateValues,
         NUM_BAUD_RATES,
-        DEFAULT_BAUD_INDEX
+        defaultBaudIndex(_model)
     );
 
     // Echo option (log all CAT traffic)
@@ -44,6 +107,57 @@ void YaesuDevice::initOptions() {
         "Echo CAT commands to console",
         false
     );
+
+    // Meter dynamics (fading S-meter, TX meter ramps)
+    _options[2] = makeEnumOption(
+        "meters",
+        "Meter dynamics",
+        meterValues,
+        NUM_METER_MODES,
+        0
+    );
+
+    // Band-activity map (S-meter follows simulated stations)
+    _options[3] = makeBoolOption(
+        "band_map",
+        "Simulated stations on the S-meter",
+        false
+    );
+
+    // Response latency: a reply waits read_latency plus up to read_jitter
+    // ms; a set keeps the radio busy for set_latency plus up to set_jitter
+    _options[4] = makeUint32Option(
+        "read_latency",
+        "Reply latency (ms)",
+        0, REPLY_LATENCY_MAX_MS, 0
+    );
+    _options[5] = makeUint32Option(
+        "read_jitter",
+        "Reply latency jitter (ms)",
+        0, REPLY_LATENCY_MAX_MS, 0
+    );
+    _options[6] = makeUint32Option(
+        "set_latency",
+        "Busy time after a set (ms)",
+        0, REPLY_LATENCY_MAX_MS, 0
+    );
+    _options[7] = makeUint32Option(
+        "set_jitter",
+        "Busy time jitter (ms)",
+        0, REPLY_LATENCY_MAX_MS, 0
+    );
+
+    // Satellite pass (S-meter hears a Doppler-shifted downlink)
+    _options[8] = makeBoolOption(
+        "satellite",
+        "Satellite downlink on the S-meter",
+        false
+    );
+    _options[9] = makeUint32Option(
+        "downlink",
+        "Satellite downlink (Hz)",
+        FREQ_MIN, FREQ_MAX, SAT_DEFAULT_DOWNLINK
+    );
 }
 
 bool YaesuDevice::begin() {
@@ -51,7 +165,7 @@ bool YaesuDevice::begin() {
         return true;
     }
 
-    if (_serial == nullptr) {
+    if (_ports.count() == 0) {
         if (_logger) {
             _logger->logf(LogLevel::ERROR, "Yaesu", "No serial port configured");
         }
@@ -59,7 +173,14 @@ bool YaesuDevice::begin() {
     }
 
     applyBaudRate();
-    _parser.reset();
+    applyMeterDynamics();
+    applyBandMap();
+    applySatellite();
+    _meters.seed(millis() ^ ((uint32_t)_uartIndex << 16));
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->reset();
+        applyLatency(_parsers[i]);
+    }
     _running = true;
 
     if (_logger) {
@@ -76,7 +197,7 @@ void YaesuDevice::end() {
         return;
     }
 
-    _serial->end();
+    _ports.end();
     _running = false;
 
     if (_logger) {
@@ -89,24 +210,86 @@ void YaesuDevice::update() {
         return;
     }
 
-    _parser.update();
+    // Each client has its own parser; they share _state
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->update();
+    }
+
+    // The satellite pass, band activity and moving meters, then changes
+    // from any client, the console or the meters, reported to clients in
+    // AI mode
+    uint32_t now = millis();
+    _satellite.update(_state, now);
+    _satellite.retune(_state, _bandMap);
+    _bandMap.setTime(now);
+    _bandMap.retune(_state);
+    _meters.update(_state, now);
+    uint16_t changes = _state.takeChanges();
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->autoInfo(changes, now);
+    }
 }
 
 void YaesuDevice::applyBaudRate() {
     uint8_t baudIndex = _options[0].value.enumVal.current;
     uint32_t baud = baudRates[baudIndex];
 
-    if (_serial->isOpen()) {
-        _serial->end();
+    if (_ports.isOpen()) {
+        _ports.end();
     }
 
-    _serial->begin(baud);
+    _ports.begin(baud);
 
     if (_logger) {
         _logger->logf(LogLevel::DEBUG, "Yaesu", "Baud rate set to %lu", (unsigned long)baud);
     }
 }
 
+void YaesuDevice::applyLatency(CATParser* parser) {
+    parser->setLatency(ReplyClass::READ,
+                       (uint16_t)_options[4].value.uint32Val.current,
+                       (uint16_t)_options[5].value.uint32Val.current);
+    parser->setLatency(ReplyClass::SET,
+                       (uint16_t)_options[6].value.uint32Val.current,
+                       (uint16_t)_options[7].value.uint32Val.current);
+}
+
+void YaesuDevice::applyMeterDynamics() {
+    _meters.setDynamics((MeterDynamics)_options[2].value.enumVal.current, _state);
+}
+
+// With the map off the S-meter level goes back to the console value
+void YaesuDevice::applyBandMap() {
+    _bandMap.setEnabled(_options[3].value.boolVal);
+    _bandMap.setFloor(_meters.getLevel(MeterType::SMETER));
+    _satellite.setFloor(_meters.getLevel(MeterType::SMETER));
+    if (_bandMap.isEnabled()) {
+        _bandMap.retune(_state);
+    } else {
+        _meters.setLevel(MeterType::SMETER, _meters.getLevel(MeterType::SMETER), _state);
+    }
+}
+
+// The clock starts at the first pass after the element set's epoch
+// unless the console has set it; with the satellite off the S-meter goes
+// back to the console value or the band map
+void YaesuDevice::applySatellite() {
+    _satellite.setDownlink(_options[9].value.uint32Val.current);
+    if (_options[8].value.boolVal == _satellite.isEnabled()) {
+        return;
+    }
+    _satellite.setEnabled(_options[8].value.boolVal);
+    if (_satellite.isEnabled()) {
+        if (!_satellite.isClockSet()) {
+            _satellite.findPass(millis());
+        }
+        _satellite.setFloor(_meters.getLevel(MeterType::SMETER));
+    } else {
+        _state.dopplerHz = 0;
+        applyBandMap();
+    }
+}
+
 const DeviceOption* YaesuDevice::getOption(size_t index) const {
     if (index >= YAESU_OPTION_COUNT) {
         return nullptr;
@@ -136,6 +319,25 @@ bool YaesuDevice::setOption(const char* name, const char* value) {
         applyBaudRate();
     }
 
+    if (success && strcmp(name, "meters") == 0) {
+        applyMeterDynamics();
+    }
+
+    if (success && strcmp(name, "band_map") == 0) {
+        applyBandMap();
+    }
+
+    if (success && (strcmp(name, "satellite") == 0 || strcmp(name, "downlink") == 0)) {
+        applySatellite();
+    }
+
+    // Latency and jitter options apply to every port at once
+    if (success && opt >= &_options[4] && opt <= &_options[7]) {
+        for (size_t i = 0; i < _ports.count(); i++) {
+            applyLatency(_parsers[i]);
+        }
+    }
+
     return success;
 }
 
@@ -149,22 +351,22 @@ bool YaesuDevice::getOptionValue(const char* name, char* buffer, size_t bufLen)
     return false;
 }
 
+// The console sets a meter's level; the reading follows it directly, or
+// moves around it when meter dynamics are on
 bool YaesuDevice::setMeter(MeterType type, uint8_t value) {
     switch (type) {
         case MeterType::SMETER:
-            _state.smeter = value;
-            break;
         case MeterType::POWER:
-            _state.powerMeter = value;
-            break;
         case MeterType::SWR:
-            _state.swrMeter = value;
-            break;
         case MeterType::ALC:
-            _state.alcMeter = value;
-            break;
         case MeterType::COMPRESSION:
-            _state.compMeter = value;
+            _meters.setLevel(type, value, _state);
+            if (type == MeterType::SMETER) {
+                _bandMap.setFloor(value);
+                _satellite.setFloor(value);
+                _satellite.retune(_state, _bandMap);
+                _bandMap.retune(_state);
+            }
             break;
         default:
             return false;
@@ -177,6 +379,21 @@ bool YaesuDevice::setMeter(MeterType type, uint8_t value) {
     return true;
 }
 
+uint32_t YaesuDevice::getNextEventUs() const {
+    uint32_t next = DEVICE_IDLE_US;
+    if (!_running) {
+        return next;
+    }
+    uint32_t now = micros();
+    for (size_t i = 0; i < _ports.count(); i++) {
+        uint32_t due = _parsers[i]->getReplyDelay().untilNext(now);
+        if (due < next) {
+            next = due;
+        }
+    }
+    return next;
+}
+
 uint8_t YaesuDevice::getMeter(MeterType type) const {
     switch (type) {
         case MeterType::SMETER: return _state.smeter;
@@ -190,7 +407,9 @@ uint8_t YaesuDevice::getMeter(MeterType type) const {
 
 void YaesuDevice::setLogger(ILogger* logger) {
     _logger = logger;
-    _parser.setLogger(logger);
+    for (size_t i = 0; i < _ports.count(); i++) {
+        _parsers[i]->setLogger(logger);
+    }
 }
 
 void YaesuDevice::getStatus(char* buffer, size_t bufLen) const {
@@ -202,14 +421,38 @@ void YaesuDevice::getStatus(char* buffer, size_t bufLen) const {
     uint8_t modeIdx = (uint8_t)_state.getCurrentMode();
     if (modeIdx > 14) modeIdx = 0;
 
-    snprintf(buffer, bufLen,
+    // Replies over all ports, and the port writes that carried them
+    unsigned long replies = 0;
+    unsigned long writes = 0;
+    unsigned long delayed = 0;
+    unsigned long dropped = 0;
+    unsigned long maxLateUs = 0;
+    for (size_t i = 0; i < _ports.count(); i++) {
+        replies += _parsers[i]->getReplyStats().replies;
+        writes += _parsers[i]->getReplyStats().writes;
+
+        const ReplyDelayStats& delay = _parsers[i]->getReplyDelay().getStats();
+        delayed += delay.delayed;
+        dropped += delay.dropped;
+        if (delay.maxLateUs > maxLateUs) {
+            maxLateUs = delay.maxLateUs;
+        }
+    }
+
+    FixedWriter out(buffer, bufLen);
+    out.format(
              "  VFO-A: %lu Hz (%s)\r\n"
              "  VFO-B: %lu Hz\r\n"
              "  Active VFO: %c\r\n"
              "  PTT: %s\r\n"
              "  S-Meter: %d\r\n"
              "  RIT: %s (%+d Hz)\r\n"
-             "  XIT: %s (%+d Hz)",
+             "  XIT: %s (%+d Hz)\r\n"
+             "  Replies: %lu in %lu writes\r\n"
+             "  Delayed replies: %lu, %lu dropped, at most %lu us late\r\n"
+             "  Reply cache: %lu hits, %lu misses\r\n"
+             "  Memory: %u channels in %u bytes%s\r\n"
+             "  Band map: %s, %u stations, %lu searches",
              (unsigned long)_state.freqVfoA,
              modeNames[modeIdx],
              (unsigned long)_state.freqVfoB,
@@ -219,21 +462,56 @@ void YaesuDevice::getStatus(char* buffer, size_t bufLen) const {
              _state.ritOn ? "ON" : "OFF",
              _state.ritOffset,
              _state.xitOn ? "ON" : "OFF",
-             _state.xitOffset);
+             _state.xitOffset,
+             replies, writes,
+             delayed, dropped, maxLateUs,
+             (unsigned long)_cache.getHits(), (unsigned long)_cache.getMisses(),
+             (unsigned)YAESU_MEMORY_CHANNELS, (unsigned)YaesuMemory::ramSize(),
+             _memory.isDirty() ? " (not saved)" : "",
+             _bandMap.isEnabled() ? "on" : "off", (unsigned)YaesuBandMap::getStationCount(),
+             (unsigned long)_bandMap.getSearches());
+    // Where the satellite is and how far its downlink is shifted
+    const SatellitePass& pass = _satellite.getPass();
+    if (!_satellite.isEnabled()) {
+        out.format("\r\n  Satellite: off");
+    } else if (!pass.valid) {
+        out.format("\r\n  Satellite: %05lu, no position (decayed)",
+                   (unsigned long)_satellite.getCatalogNumber());
+    } else {
+        out.format("\r\n  Satellite: %05lu el %d az %u, %lu km, %+ld m/s, %lu Hz %+ld Hz",
+                   (unsigned long)_satellite.getCatalogNumber(),
+                   pass.elevation, pass.azimuth, (unsigned long)pass.rangeKm, (long)pass.rangeRate,
+                   (unsigned long)_satellite.getDownlink(), (long)pass.dopplerHz);
+    }
 }
 
 // === Persistence ===
 
 size_t YaesuDevice::serializeOptions(uint8_t* buffer, size_t bufLen) const {
-    // Format: [baud_rate_index (1 byte)] [echo (1 byte)]
-    if (bufLen < 2) {
+    // Format: [baud_rate_index (1 byte)] [echo (1 byte)] [meters (1 byte)]
+    //         [band_map (1 byte)] [read_latency, read_jitter, set_latency,
+    //         set_jitter (2 bytes each, little-endian)] [satellite (1 byte)]
+    //         [downlink (4 bytes, little-endian)]
+    if (bufLen < 17) {
         return 0;
     }
 
     buffer[0] = _options[0].value.enumVal.current;  // baud_rate
     buffer[1] = _options[1].value.boolVal ? 1 : 0;  // echo
+    buffer[2] = _options[2].value.enumVal.current;  // meters
+    buffer[3] = _options[3].value.boolVal ? 1 : 0;  // band_map
+    for (size_t i = 0; i < 4; i++) {
+        uint32_t ms = _options[4 + i].value.uint32Val.current;
+        buffer[4 + 2 * i] = (uint8_t)(ms & 0xFF);
+        buffer[5 + 2 * i] = (uint8_t)(ms >> 8);
+    }
+    buffer[12] = _options[8].value.boolVal ? 1 : 0;  // satellite
+    uint32_t downlink = _options[9].value.uint32Val.current;
+    for (size_t i = 0; i < 4; i++) {
+        buffer[13 + i] = (uint8_t)(downlink >> (8 * i));
+    }
 
-    return 2;
+    return 17;
 }
 
 bool YaesuDevice::deserializeOptions(const uint8_t* buffer, size_t len) {
@@ -244,20 +522,55 @@ bool YaesuDevice::deserializeOptions(const uint8_t* buffer, size_t len) {
     // Validate baud rate index
     uint8_t baudIndex = buffer[0];
     if (baudIndex >= NUM_BAUD_RATES) {
-        baudIndex = DEFAULT_BAUD_INDEX;
+        baudIndex = defaultBaudIndex(_model);
     }
     _options[0].value.enumVal.current = baudIndex;
 
     // Restore echo setting
     _options[1].value.boolVal = (buffer[1] != 0);
 
+    // Meter dynamics and band map, off in configurations saved before
+    // the options
+    uint8_t meters = (len >= 3) ? buffer[2] : 0;
+    _options[2].value.enumVal.current = (meters < NUM_METER_MODES) ? meters : 0;
+    _options[3].value.boolVal = (len >= 4) && (buffer[3] != 0);
+
+    // Latency, none in configurations saved before the options
+    for (size_t i = 0; i < 4; i++) {
+        uint32_t ms = 0;
+        if (len >= 6 + 2 * i) {
+            ms = (uint32_t)buffer[4 + 2 * i] | ((uint32_t)buffer[5 + 2 * i] << 8);
+        }
+        _options[4 + i].value.uint32Val.current = (ms <= REPLY_LATENCY_MAX_MS) ? ms : 0;
+    }
+
+    // Satellite, off with the ISS downlink in configurations saved before
+    // the options
+    _options[8].value.boolVal = (len >= 13) && (buffer[12] != 0);
+    uint32_t downlink = SAT_DEFAULT_DOWNLINK;
+    if (len >= 17) {
+        downlink = (uint32_t)buffer[13] | ((uint32_t)buffer[14] << 8) |
+                   ((uint32_t)buffer[15] << 16) | ((uint32_t)buffer[16] << 24);
+    }
+    _options[9].value.uint32Val.current =
+        (downlink >= FREQ_MIN && downlink <= FREQ_MAX) ? downlink : SAT_DEFAULT_DOWNLINK;
+
     return true;
 }
 
+// Device state: the memory channels
+bool YaesuDevice::saveState(IStateStream& out) {
+    return _memory.save(out);
+}
+
+bool YaesuDevice::loadState(IStateStream& in) {
+    return _memory.load(in);
+}
+
 // === Factory Implementation ===
 
 IEmulatedDevice* YaesuDeviceFactory::create(ISerialPort* serial, uint8_t uartIndex) {
-    return new YaesuDevice(serial, uartIndex);
+    return new YaesuDevice(serial, uartIndex, _model);
 }
 
 void YaesuDeviceFactory::destroy(IEmulatedDevice* device) {
@@ -6,16 +6,25 @@
 #include "IEmulatedDevice.h"
 #include "ISerialPort.h"
 #include "YaesuState.h"
+#include "YaesuReplyCache.h"
+#include "YaesuMemory.h"
+#include "YaesuMeters.h"
+#include "YaesuBandMap.h"
+#include "YaesuSatellite.h"
+#include "CATModel.h"
 #include "CATParser.h"
+#include "core/SerialFanOut.h"
 #include "platform_config.h"
 
 // Number of configurable options
-#define YAESU_OPTION_COUNT 2
+#define YAESU_OPTION_COUNT 10
 
-// Yaesu FT-991A CAT interface emulator
+// CAT radio emulator: the FT-991A and the other ';'-terminated CAT radios
+// (CATModel), all on the same parser, state, meters and memory
 class YaesuDevice : public IEmulatedDevice {
 public:
-    YaesuDevice(ISerialPort* serial, uint8_t uartIndex);
+    // model: descriptor in flash (CAT_FT991A, ...), copied into the device
+    YaesuDevice(ISerialPort* serial, uint8_t uartIndex, const CATModel& model);
     ~YaesuDevice() override;
 
     // === Lifecycle ===
@@ -24,12 +33,18 @@ public:
     void update() override;
 
     // === Identity ===
-    const char* getName() const override { return "ft-991a"; }
-    const char* getDescription() const override { return "Yaesu FT-991A CAT Emulator"; }
+    const char* getName() const override { return _model.typeName; }
+    const char* getDescription() const override { return _model.description; }
     uint8_t getDeviceId() const override { return _deviceId; }
     void setDeviceId(uint8_t id) override { _deviceId = id; }
     uint8_t getUartIndex() const override { return _uartIndex; }
 
+    // === Ports ===
+    bool attachPort(ISerialPort* serial, uint8_t uartIndex) override;
+    bool detachPort(uint8_t uartIndex) override;
+    size_t getPortCount() const override { return _ports.count(); }
+    uint8_t getPortUart(size_t index) const override { return _ports.getUart(index); }
+
     // === Options ===
     size_t getOptionCount() const override { return YAESU_OPTION_COUNT; }
     const DeviceOption* getOption(size_t index) const override;
@@ -40,6 +55,8 @@ public:
     // === Persistence ===
     size_t serializeOptions(uint8_t* buffer, size_t bufLen) const override;
     bool deserializeOptions(const uint8_t* buffer, size_t len) override;
+    bool saveState(IStateStream& out) override;
+    bool loadState(IStateStream& in) override;
 
     // === Meter Simulation ===
     bool setMeter(MeterType type, uint8_t value) override;
@@ -48,33 +65,61 @@ public:
     // === Logging ===
     void setLogger(ILogger* logger) override;
 
+    // === Timing ===
+    uint32_t getNextEventUs() const override;
+
+    // === Front-ends ===
+    // Radio state, for front-ends that serve it without a CAT round trip
+    // (the host's rigctld server); writers use YaesuState::set() so CAT
+    // clients in AI mode see the change
+    YaesuState& getState() { return _state; }
+    const CATModel& getModel() const { return _model; }
+
+    // Satellite downlink, for the console's element set, station and clock
+    YaesuSatellite& getSatellite() { return _satellite; }
+
     // === Status ===
     bool isRunning() const override { return _running; }
     void getStatus(char* buffer, size_t bufLen) const override;
 
 private:
-    ISerialPort* _serial;
+    CATModel _model;         // Copy of the descriptor, shared by the parsers
+    SerialFanOut _ports;     // Every port the radio is served on
     uint8_t _uartIndex;
     uint8_t _deviceId;
     bool _running;
     ILogger* _logger;
 
     YaesuState _state;
-    CATParser _parser;
+    YaesuReplyCache _cache;  // Shared by the parsers
+    YaesuMemory _memory;     // Memory channels, saved with the configuration
+    YaesuMeters _meters;     // Meter levels and their dynamics
+    YaesuBandMap _bandMap;   // Simulated stations for the S-meter
+    YaesuSatellite _satellite;  // Doppler-shifted satellite downlink
+    CATParser* _parsers[DEVICE_MAX_PORTS];  // One per port, same order as _ports
 
     // Options
     DeviceOption _options[YAESU_OPTION_COUNT];
 
     void initOptions();
     void applyBaudRate();
+    void applyMeterDynamics();
+    void applyBandMap();
+    void applySatellite();
+    void applyLatency(CATParser* parser);
 };
 
-// Factory for creating YaesuDevice instances
+// Factory for one CAT model, from its descriptor in flash
 class YaesuDeviceFactory : public IDeviceFactory {
 public:
-    const char* getTypeName() const override { return "ft-991a"; }
-    const char* getDescription() const override { return "Yaesu FT-991A CAT Emulator"; }
+    explicit YaesuDeviceFactory(const CATModel& model) : _model(model) {}
+
+    const char* getTypeName() const override { return (const char*)pgm_read_ptr(&_model.typeName); }
+    const char* getDescription() const override { return (const char*)pgm_read_ptr(&_model.description); }
     DeviceCategory getCategory() const override { return DeviceCategory::RADIO; }
     IEmulatedDevice* create(ISerialPort* serial, uint8_t uartIndex) override;
     void destroy(IEmulatedDevice* device) override;
+
+private:
+    const CATModel& _model;
 };
@@ -0,0 +1,195 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "YaesuMemory.h"
+#include <string.h>
+
+// Format of the saved block, bumped when the layout changes
+static const uint8_t MEMORY_FORMAT = 1;
+
+// Span of a segment: the 24 bits of the packed frequency offset
+static const uint32_t SEGMENT_SPAN = 1UL << 24;
+
+// Segment base frequencies (Hz): HF/6m, airband/2m, 70cm
+static const uint8_t SEGMENT_COUNT = 10;
+static const uint32_t SEGMENT_BASES[SEGMENT_COUNT] PROGMEM = {
+    FREQ_MIN,
+    FREQ_MIN + SEGMENT_SPAN,
+    FREQ_MIN + 2 * SEGMENT_SPAN,
+    FREQ_MIN + 3 * SEGMENT_SPAN,
+    118000000UL,
+    118000000UL + SEGMENT_SPAN,
+    118000000UL + 2 * SEGMENT_SPAN,
+    420000000UL,
+    420000000UL + SEGMENT_SPAN,
+    420000000UL + 2 * SEGMENT_SPAN
+};
+
+// Channels stored after a reset: FT8 calling frequencies, 160m to 6m
+struct MemoryPreset {
+    uint32_t freq;
+    char tag[YAESU_TAG_LEN + 1];   // Space padded
+};
+
+static const uint8_t PRESET_COUNT = 10;
+static const MemoryPreset PRESETS[PRESET_COUNT] PROGMEM = {
+    { 1840000UL, "FT8 160M    " },
+    { 3573000UL, "FT8 80M     " },
+    { 7074000UL, "FT8 40M     " },
+    { 10136000UL, "FT8 30M     " },
+    { 14074000UL, "FT8 20M     " },
+    { 18100000UL, "FT8 17M     " },
+    { 21074000UL, "FT8 15M     " },
+    { 24915000UL, "FT8 12M     " },
+    { 28074000UL, "FT8 10M     " },
+    { 50313000UL, "FT8 6M      " }
+};
+
+YaesuMemory::YaesuMemory() {
+    reset();
+}
+
+void YaesuMemory::reset() {
+    memset(_packed, 0, sizeof(_packed));
+    memset(_tags, 0, sizeof(_tags));
+    for (uint8_t i = 0; i < PRESET_COUNT; i++) {
+        write(i + 1, pgm_read_dword(&PRESETS[i].freq), YaesuMode::MODE_DATA_USB);
+    }
+    _dirty = false;
+}
+
+uint32_t YaesuMemory::segmentBase(uint8_t segment) {
+    return pgm_read_dword(&SEGMENT_BASES[segment]);
+}
+
+bool YaesuMemory::write(uint8_t channel, uint32_t freq, YaesuMode mode) {
+    if (channel == 0 || channel > YAESU_MEMORY_CHANNELS) {
+        return false;
+    }
+    // Highest segment that starts at or below the frequency
+    uint8_t segment = SEGMENT_COUNT;
+    while (segment > 0 && segmentBase(segment - 1) > freq) {
+        segment--;
+    }
+    if (segment == 0) {
+        return false;
+    }
+    segment--;
+    uint32_t offset = freq - segmentBase(segment);
+    if (offset >= SEGMENT_SPAN) {
+        return false;  // In a gap between tuning ranges
+    }
+    uint32_t packed = (offset << 8) | ((uint32_t)segment << 4) | ((uint8_t)mode & 0x0F);
+    if (_packed[channel - 1] != packed) {
+        _packed[channel - 1] = packed;
+        _dirty = true;
+    }
+    return true;
+}
+
+const YaesuMemory::TagSlot* YaesuMemory::findTag(uint8_t channel) const {
+    for (size_t i = 0; i < YAESU_TAG_SLOTS; i++) {
+        if (_tags[i].channel == channel) {
+            return &_tags[i];
+        }
+    }
+    return nullptr;
+}
+
+bool YaesuMemory::presetTag(uint8_t channel, char* tag) {
+    if (channel == 0 || channel > PRESET_COUNT) {
+        return false;
+    }
+    memcpy_P(tag, PRESETS[channel - 1].tag, YAESU_TAG_LEN);
+    return true;
+}
+
+bool YaesuMemory::getTag(uint8_t channel, char* tag) const {
+    if (channel == 0 || channel > YAESU_MEMORY_CHANNELS) {
+        return false;
+    }
+    const TagSlot* slot = findTag(channel);
+    if (slot) {
+        memcpy(tag, slot->tag, YAESU_TAG_LEN);
+    } else if (!presetTag(channel, tag)) {
+        memset(tag, ' ', YAESU_TAG_LEN);
+    }
+    tag[YAESU_TAG_LEN] = '\0';
+    return true;
+}
+
+bool YaesuMemory::setTag(uint8_t channel, const char* tag) {
+    if (channel == 0 || channel > YAESU_MEMORY_CHANNELS) {
+        return false;
+    }
+    TagSlot* slot = const_cast<TagSlot*>(findTag(channel));
+    if (!slot) {
+        slot = const_cast<TagSlot*>(findTag(0));
+        if (!slot) {
+            return false;
+        }
+        slot->channel = channel;
+    } else if (memcmp(slot->tag, tag, YAESU_TAG_LEN) == 0) {
+        return true;
+    }
+    memcpy(slot->tag, tag, YAESU_TAG_LEN);
+    _dirty = true;
+    return true;
+}
+
+// Saved block: format, packed channels, count of written tags, tag slots
+bool YaesuMemory::save(IStateStream& out) {
+    uint8_t used = 0;
+    for (size_t i = 0; i < YAESU_TAG_SLOTS; i++) {
+        if (_tags[i].channel != 0) {
+            used++;
+        }
+    }
+    if (!out.write(&MEMORY_FORMAT, 1) ||
+        !out.write(_packed, sizeof(_packed)) ||
+        !out.write(&used, 1)) {
+        return false;
+    }
+    for (size_t i = 0; i < YAESU_TAG_SLOTS; i++) {
+        if (_tags[i].channel != 0 && !out.write(&_tags[i], sizeof(TagSlot))) {
+            return false;
+        }
+    }
+    _dirty = false;
+    return true;
+}
+
+bool YaesuMemory::load(IStateStream& in) {
+    uint8_t format = 0;
+    uint8_t used = 0;
+    if (!in.read(&format, 1) || format != MEMORY_FORMAT ||
+        !in.read(_packed, sizeof(_packed)) ||
+        !in.read(&used, 1)) {
+        reset();
+        return false;
+    }
+    // Empty any channel a damaged block left with a bad mode or segment
+    for (size_t i = 0; i < YAESU_MEMORY_CHANNELS; i++) {
+        uint8_t mode = _packed[i] & 0x0F;
+        uint8_t segment = (_packed[i] >> 4) & 0x0F;
+        if (mode > (uint8_t)YaesuMode::MODE_C4FM || segment >= SEGMENT_COUNT) {
+            _packed[i] = 0;
+        }
+    }
+    // Tags beyond this build's slot count are dropped
+    memset(_tags, 0, sizeof(_tags));
+    size_t kept = 0;
+    for (uint8_t i = 0; i < used; i++) {
+        TagSlot slot;
+        if (!in.read(&slot, sizeof(slot))) {
+            reset();
+            return false;
+        }
+        if (kept < YAESU_TAG_SLOTS && slot.channel != 0 &&
+            slot.channel <= YAESU_MEMORY_CHANNELS && !findTag(slot.channel)) {
+            _tags[kept++] = slot;
+        }
+    }
+    _dirty = false;
+    return true;
+}
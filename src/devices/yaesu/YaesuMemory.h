@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "platform_config.h"
+#include "YaesuState.h"
+#include "IStateStream.h"
+
+// Memory channels of the FT-991A (001-099, then the PMS pairs as 100-117)
+#define YAESU_MEMORY_CHANNELS 117
+
+// Characters in a channel tag (MT)
+#define YAESU_TAG_LEN 12
+
+// Memory-channel store
+// Channels are kept bit-packed in 4 bytes each so all 117 fit in SRAM:
+//   bits 31-8  frequency offset from the segment base, Hz (24 bits)
+//   bits 7-4   segment: index into a flash table of base frequencies
+//   bits 3-0   mode (YaesuMode), 0 for an empty channel
+// The segments cover the FT-991A's tuning ranges (30 kHz-67 MHz,
+// 118-168 MHz, 420-470 MHz) in 16.7 MHz steps, so any frequency the
+// radio can tune is stored to the hertz and decoded with one table read.
+// Tags are an overlay on the flash table of preset channels: a preset's
+// tag is read from flash, and only tags written with MT take one of
+// YAESU_TAG_SLOTS RAM slots.
+// Writes only change RAM and mark the store dirty; it reaches EEPROM when
+// the configuration is saved (YaesuDevice::saveState).
+class YaesuMemory {
+public:
+    YaesuMemory();
+
+    // Restore the preset channels and drop written tags
+    void reset();
+
+    // Frequency and mode of a channel (1-based), false if empty or invalid
+    bool read(uint8_t channel, uint32_t& freq, YaesuMode& mode) const {
+        if (channel == 0 || channel > YAESU_MEMORY_CHANNELS) {
+            return false;
+        }
+        uint32_t packed = _packed[channel - 1];
+        if ((packed & 0x0F) == 0) {
+            return false;
+        }
+        freq = segmentBase((packed >> 4) & 0x0F) + (packed >> 8);
+        mode = (YaesuMode)(packed & 0x0F);
+        return true;
+    }
+
+    // Store a channel, false if the channel or frequency is out of range
+    bool write(uint8_t channel, uint32_t freq, YaesuMode mode);
+
+    // Copy the tag of a channel, space padded to YAESU_TAG_LEN and
+    // NUL-terminated, false if the channel is invalid
+    bool getTag(uint8_t channel, char* tag) const;
+
+    // Set the tag of a channel (YAESU_TAG_LEN characters), false if the
+    // channel is invalid or every tag slot is taken
+    bool setTag(uint8_t channel, const char* tag);
+
+    // Persistence
+    bool isDirty() const { return _dirty; }
+    bool save(IStateStream& out);
+    bool load(IStateStream& in);
+
+    // Bytes of RAM used, for the status display
+    static constexpr size_t ramSize() { return sizeof(YaesuMemory); }
+
+private:
+    // Written tag of a channel; a free slot has channel 0
+    struct TagSlot {
+        uint8_t channel;
+        char tag[YAESU_TAG_LEN];
+    };
+
+    uint32_t _packed[YAESU_MEMORY_CHANNELS];
+    TagSlot _tags[YAESU_TAG_SLOTS];
+    bool _dirty;
+
+    static uint32_t segmentBase(uint8_t segment);
+
+    // Slot holding a channel's written tag, nullptr if none
+    const TagSlot* findTag(uint8_t channel) const;
+
+    // Preset tag from flash, false if the channel has no preset
+    static bool presetTag(uint8_t channel, char* tag);
+};
@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "YaesuMeters.h"
+#include <string.h>
+
+// Quarter-wave sine, 127 * sin(i * 90 / 64 degrees)
+static const int8_t SINE_TABLE[65] PROGMEM = {
+      0,   3,   6,   9,  12,  16,  19,  22,  25,  28,  31,  34,  37,  40,  43,  46,
+     49,  51,  54,  57,  60,  63,  65,  68,  71,  73,  76,  78,  81,  83,  85,  88,
+     90,  92,  94,  96,  98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+    117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
+    127
+};
+
+// 16 * log2(1 + m / 16), the fraction bits of log2q4()
+static const uint8_t LOG2_FRACTION[16] PROGMEM = {
+    0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15
+};
+
+// Direct path of the Rician mode: K = 4 times the scattered power
+// (PHASORS * 127^2), so its amplitude is sqrt(4 * 8 * 127^2)
+static const int16_t RICIAN_DIRECT = 718;
+
+// Filter coefficients per tick, out of 256: a meter reaches 90% of its
+// level about 40 ms after PTT and falls to 10% about 350 ms after release
+static const uint8_t TX_ATTACK = 100;
+static const uint8_t TX_DECAY = 16;
+
+// Catch up at most this many ticks after a stall
+static const uint8_t MAX_TICKS = 16;
+
+// Sine of a phase (65536 = one turn), -127 to 127
+static int8_t sine(uint16_t phase) {
+    uint8_t index = phase >> 8;
+    uint8_t step = index & 63;
+    switch (index >> 6) {
+        case 0: return (int8_t)pgm_read_byte(&SINE_TABLE[step]);
+        case 1: return (int8_t)pgm_read_byte(&SINE_TABLE[64 - step]);
+        case 2: return -(int8_t)pgm_read_byte(&SINE_TABLE[step]);
+        default: return -(int8_t)pgm_read_byte(&SINE_TABLE[64 - step]);
+    }
+}
+
+static int8_t cosine(uint16_t phase) {
+    return sine(phase + 16384);
+}
+
+// log2 of a power with 4 fraction bits (16 = a factor of 2, 3 dB)
+static int16_t log2q4(uint32_t x) {
+    if (x == 0) {
+        return 0;
+    }
+    uint8_t msb = 0;
+    while ((x >> msb) > 1) {
+        msb++;
+    }
+    uint8_t mantissa = (msb >= 4) ? (uint8_t)(x >> (msb - 4)) & 15 : (uint8_t)(x << (4 - msb)) & 15;
+    return (int16_t)(msb * 16 + pgm_read_byte(&LOG2_FRACTION[mantissa]));
+}
+
+YaesuMeters::YaesuMeters()
+    : _dynamics(MeterDynamics::STATIC)
+    , _lastTick(0)
+    , _qsbPhase(0)
+    , _meanLog(0)
+{
+    memset(_level, 0, sizeof(_level));
+    memset(_tx, 0, sizeof(_tx));
+    seed(0x2545F491UL);
+}
+
+uint32_t YaesuMeters::random() {
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _random;
+}
+
+void YaesuMeters::seed(uint32_t seed) {
+    _random = (seed != 0) ? seed : 1;
+
+    // Jakes' arrival angles: evenly spread around a random offset, so the
+    // phasors rotate at different rates between -fd and +fd
+    const int32_t maxStep = (int32_t)METER_FADE_RATE_CHZ * 65536L * METER_TICK_MS / 100000L;
+    uint16_t offset = (uint16_t)random();
+    for (uint8_t i = 0; i < PHASORS; i++) {
+        uint16_t angle = offset + (uint16_t)(i * (65536UL / PHASORS)) + 65536UL / (4 * PHASORS);
+        _step[i] = (int16_t)(maxStep * cosine(angle) / 127);
+        _phase[i] = (uint16_t)random();
+    }
+    _qsbPhase = (uint16_t)random();
+}
+
+void YaesuMeters::setDynamics(MeterDynamics dynamics, YaesuState& state) {
+    _dynamics = dynamics;
+
+    // Mean power of the faded signal, the 0 dB reference of fade()
+    uint32_t scattered = (uint32_t)PHASORS * 127 * 127;
+    uint32_t direct = (uint32_t)RICIAN_DIRECT * RICIAN_DIRECT;
+    _meanLog = log2q4((dynamics == MeterDynamics::RICIAN) ? scattered + direct : scattered);
+
+    if (dynamics == MeterDynamics::STATIC) {
+        applyStatic(state);
+    }
+}
+
+void YaesuMeters::setLevel(MeterType type, uint8_t value, YaesuState& state) {
+    uint8_t index = (uint8_t)type;
+    if (index >= sizeof(_level)) {
+        return;
+    }
+    _level[index] = value;
+    if (type == MeterType::SMETER) {
+        state.set(state.signalLevel, value, CHANGED_SMETER);
+    }
+    if (_dynamics == MeterDynamics::STATIC) {
+        applyStatic(state);
+    }
+}
+
+uint8_t YaesuMeters::getLevel(MeterType type) const {
+    uint8_t index = (uint8_t)type;
+    return (index < sizeof(_level)) ? _level[index] : 0;
+}
+
+void YaesuMeters::applyStatic(YaesuState& state) {
+    state.set(state.smeter, state.signalLevel, CHANGED_SMETER);
+    state.set(state.powerMeter, _level[(uint8_t)MeterType::POWER], CHANGED_METERS);
+    state.set(state.swrMeter, _level[(uint8_t)MeterType::SWR], CHANGED_METERS);
+    state.set(state.alcMeter, _level[(uint8_t)MeterType::ALC], CHANGED_METERS);
+    state.set(state.compMeter, _level[(uint8_t)MeterType::COMPRESSION], CHANGED_METERS);
+    for (uint8_t i = 0; i < TX_METERS; i++) {
+        _tx[i] = 0;
+    }
+}
+
+// Power of the phasor sum relative to its mean, converted from log2
+// (16 per 3.01 dB) to meter units (about 2.4 per dB): 3.01 * 2.4 / 16 is
+// close to 29 / 64
+int16_t YaesuMeters::fade() const {
+    int16_t i = (_dynamics == MeterDynamics::RICIAN) ? RICIAN_DIRECT : 0;
+    int16_t q = 0;
+    for (uint8_t k = 0; k < PHASORS; k++) {
+        i += cosine(_phase[k]);
+        q += sine(_phase[k]);
+    }
+    uint32_t power = (uint32_t)((int32_t)i * i) + (uint32_t)((int32_t)q * q);
+    return (int16_t)(((int32_t)(log2q4(power) - _meanLog) * 29) / 64);
+}
+
+void YaesuMeters::update(YaesuState& state, uint32_t now) {
+    if (_dynamics == MeterDynamics::STATIC) {
+        _lastTick = now;
+        return;
+    }
+
+    uint32_t elapsed = now - _lastTick;
+    if (elapsed < METER_TICK_MS) {
+        return;
+    }
+    uint32_t ticks = elapsed / METER_TICK_MS;
+    _lastTick += ticks * METER_TICK_MS;
+    if (ticks > MAX_TICKS) {
+        ticks = MAX_TICKS;
+        _lastTick = now;
+    }
+
+    // Receive: rotate the phasors and the QSB swing
+    for (uint8_t k = 0; k < PHASORS; k++) {
+        _phase[k] += (uint16_t)(_step[k] * (int16_t)ticks);
+    }
+    _qsbPhase += (uint16_t)(ticks * (65536UL / (METER_QSB_PERIOD_S * 1000UL / METER_TICK_MS)));
+
+    int16_t smeter = state.signalLevel + fade() +
+                     (int16_t)sine(_qsbPhase) * METER_QSB_DEPTH / 127 +
+                     (int16_t)(random() & 3) - 1;
+    state.set(state.smeter, (uint8_t)constrain(smeter, 0, 255), CHANGED_SMETER);
+
+    // Transmit: each TX meter filters towards its level while PTT is on,
+    // and towards zero while it is off
+    for (uint8_t t = 0; t < ticks; t++) {
+        for (uint8_t i = 0; i < TX_METERS; i++) {
+            int32_t target = state.ptt ? (int32_t)_level[i + 1] << 8 : 0;
+            int32_t delta = target - (int32_t)_tx[i];
+            uint8_t rate = (delta > 0) ? TX_ATTACK : TX_DECAY;
+            int32_t step = delta * rate / 256;
+            if (step == 0 && delta != 0) {
+                step = (delta > 0) ? 1 : -1;  // Settle exactly
+            }
+            _tx[i] = (uint16_t)(_tx[i] + step);
+        }
+    }
+    state.set(state.powerMeter, (uint8_t)((_tx[0] + 128) >> 8), CHANGED_METERS);
+    state.set(state.swrMeter, (uint8_t)((_tx[1] + 128) >> 8), CHANGED_METERS);
+    state.set(state.alcMeter, (uint8_t)((_tx[2] + 128) >> 8), CHANGED_METERS);
+    state.set(state.compMeter, (uint8_t)((_tx[3] + 128) >> 8), CHANGED_METERS);
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "IEmulatedDevice.h"
+#include "YaesuState.h"
+
+// Meter simulation step; the engine runs at most this often (100 Hz)
+#ifndef METER_TICK_MS
+#define METER_TICK_MS 10
+#endif
+
+// Fastest fading rate (maximum Doppler spread), centihertz
+#ifndef METER_FADE_RATE_CHZ
+#define METER_FADE_RATE_CHZ 50
+#endif
+
+// QSB: period (seconds) and depth (meter units, about 2.4 per dB)
+#ifndef METER_QSB_PERIOD_S
+#define METER_QSB_PERIOD_S 20
+#endif
+#ifndef METER_QSB_DEPTH
+#define METER_QSB_DEPTH 12
+#endif
+
+// How the meters move
+enum class MeterDynamics : uint8_t {
+    STATIC = 0,     // Readings are the levels set from the console
+    RAYLEIGH,       // S-meter fades with no direct path, TX meters ramp
+    RICIAN          // S-meter fades around a direct path (K = 4)
+};
+
+// Meter dynamics for the FT-991A
+// The console sets meter levels; in the dynamic modes the engine turns
+// them into moving readings in YaesuState:
+// - The S-meter follows its level (YaesuState::signalLevel, which the
+//   band map may raise to a station's strength) with multipath fading,
+//   a slow QSB swing and a little noise. Fading is a sum of eight
+//   rotating phasors (Jakes' model) with random Doppler rates; their
+//   power is converted to dB with an integer log2, so one step is a few
+//   table reads, additions and two multiplies.
+// - The power, SWR, ALC and compression meters read zero on receive and
+//   ramp to their levels when PTT is on, with a fast attack and a slower
+//   decay (first-order filters in 8.8 fixed point).
+// Everything is integer arithmetic with tables in flash, cheap enough to
+// run at 100 Hz on a Cortex-M0 or AVR.
+class YaesuMeters {
+public:
+    YaesuMeters();
+
+    // Choose the dynamics; STATIC copies the levels straight to state
+    void setDynamics(MeterDynamics dynamics, YaesuState& state);
+    MeterDynamics getDynamics() const { return _dynamics; }
+
+    // Seed the random number generator and restart fading
+    void seed(uint32_t seed);
+
+    // Level of a meter (0-255), as set from the console
+    void setLevel(MeterType type, uint8_t value, YaesuState& state);
+    uint8_t getLevel(MeterType type) const;
+
+    // Advance the simulation to now (ms) and update the state's meters
+    void update(YaesuState& state, uint32_t now);
+
+private:
+    static const uint8_t PHASORS = 8;
+    static const uint8_t TX_METERS = 4;   // Power, SWR, ALC, compression
+
+    MeterDynamics _dynamics;
+    uint8_t _level[5];                    // Indexed by MeterType
+    uint32_t _random;                     // xorshift32 state
+    uint32_t _lastTick;
+
+    // Fading phasors: phase (65536 = one turn) and step per tick
+    uint16_t _phase[PHASORS];
+    int16_t _step[PHASORS];
+    uint16_t _qsbPhase;
+    int16_t _meanLog;                     // log2 of the mean fading power, 4 fraction bits
+
+    uint16_t _tx[TX_METERS];              // TX meter readings, 8.8 fixed point
+
+    uint32_t random();
+
+    // Fade of the current phasors, in meter units (negative in a fade)
+    int16_t fade() const;
+
+    // Write the levels to the state's meters unchanged
+    void applyStatic(YaesuState& state);
+};
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "YaesuState.h"
+
+// Read replies kept by YaesuReplyCache
+enum class CachedReply : uint8_t {
+    FA = 0,     // FA;
+    FB,         // FB;
+    IF,         // IF;
+    MD,         // MD0;
+    SM,         // SM0;
+    RM1,        // RM1; (S-meter)
+    COUNT
+};
+
+// Room for a cached reply: IF is at most 38 characters with the
+// terminator (Kenwood), the others fit in 14 (11-digit frequencies)
+constexpr uint8_t cachedReplySize(uint8_t i) {
+    return (i == (uint8_t)CachedReply::IF) ? 38 : 14;
+}
+
+constexpr size_t cachedReplyOffset(uint8_t i) {
+    return (i == 0) ? 0 : cachedReplyOffset(i - 1) + cachedReplySize(i - 1);
+}
+
+// Formatted replies to the read commands clients poll most
+// Logging and digital-mode clients read the same few values many times
+// between changes. The first read formats the reply and stores it here;
+// later reads copy the stored text until a state field the reply depends
+// on changes (YaesuState::dirty). One cache serves every parser of a
+// device, always with that device's state.
+class YaesuReplyCache {
+public:
+    YaesuReplyCache()
+        : _hits(0)
+        , _misses(0)
+    {
+        memset(_len, 0, sizeof(_len));
+    }
+
+    // Stored reply, including the terminator, or nullptr if it has to be
+    // formatted again
+    const char* find(YaesuState& state, CachedReply reply, size_t& len) {
+        if (state.dirty != 0) {
+            invalidate(state.dirty);
+            state.dirty = 0;
+        }
+        uint8_t i = (uint8_t)reply;
+        if (_len[i] == 0) {
+            _misses++;
+            return nullptr;
+        }
+        _hits++;
+        len = _len[i];
+        return &_text[cachedReplyOffset(i)];
+    }
+
+    // Keep a freshly formatted reply; too long a reply is not kept
+    void store(CachedReply reply, const char* text, size_t len) {
+        uint8_t i = (uint8_t)reply;
+        if (len == 0 || len > cachedReplySize(i)) {
+            return;
+        }
+        memcpy(&_text[cachedReplyOffset(i)], text, len);
+        _len[i] = (uint8_t)len;
+    }
+
+    uint32_t getHits() const { return _hits; }
+    uint32_t getMisses() const { return _misses; }
+
+private:
+    static const uint8_t COUNT = (uint8_t)CachedReply::COUNT;
+
+    // State fields a reply is formatted from (YaesuChange flags)
+    static uint16_t dependsOn(uint8_t i) {
+        switch ((CachedReply)i) {
+            case CachedReply::FA: return CHANGED_FREQ_A;
+            case CachedReply::FB: return CHANGED_FREQ_B;
+            case CachedReply::IF: return CHANGED_FREQ_A | CHANGED_FREQ_B | CHANGED_MODE |
+                                         CHANGED_VFO | CHANGED_RIT | CHANGED_XIT |
+                                         CHANGED_PTT | CHANGED_SETTINGS;
+            case CachedReply::MD: return CHANGED_MODE | CHANGED_VFO;
+            case CachedReply::SM: return CHANGED_SMETER;
+            case CachedReply::RM1: return CHANGED_SMETER;
+            default: return 0xFFFF;
+        }
+    }
+
+    // Drop the replies formatted from changed fields
+    void invalidate(uint16_t changes) {
+        for (uint8_t i = 0; i < COUNT; i++) {
+            if (dependsOn(i) & changes) {
+                _len[i] = 0;
+            }
+        }
+    }
+
+    char _text[cachedReplyOffset(COUNT)];
+    uint8_t _len[COUNT];         // 0 if the reply is not cached
+    uint32_t _hits;
+    uint32_t _misses;
+};
@@ -0,0 +1,620 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "YaesuSatellite.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Built-in element set: the ISS (the example set from the TLE format
+// documentation), so the radio has a satellite to hear out of the box
+static const char DEFAULT_TLE1[] PROGMEM =
+    "1 25544U 98067A   08264.51782528 -.00002182  00000-0 -11606-4 0  2927";
+static const char DEFAULT_TLE2[] PROGMEM =
+    "2 25544  51.6416 247.4627 0006703 130.5360 325.0288 15.72125391563537";
+
+// Default ground station: the GPS emulator's default position
+#define DEFAULT_LATITUDE 37.7749f
+#define DEFAULT_LONGITUDE -122.4194f
+
+#define TLE_LINE_LEN 69
+
+// WGS-72, as SGP4 expects: earth radius (km), sqrt(GM) in earth radii^1.5
+// per minute, zonal harmonics
+static const float RE = 6378.135f;
+static const float XKE = 0.0743669161f;
+static const float J2 = 0.001082616f;
+static const float J3OJ2 = -0.00000253881f / 0.001082616f;
+static const float J4 = -0.00000165597f;
+static const float FLATTENING = 1.0f / 298.26f;
+
+static const float TWO_PI = 6.2831853f;
+static const float DEG = 0.017453293f;          // Radians per degree
+static const float EARTH_RATE = 7.2921159e-5f;  // Sidereal rotation, rad/s
+static const float SPEED_OF_LIGHT = 299792.458f; // km/s
+
+// Unix seconds at J2000.0 (2000-01-01 12:00 UTC)
+static const int32_t J2000 = 946728000L;
+
+// Angle in [0, 2 pi)
+static float wrap(float angle) {
+    angle = fmodf(angle, TWO_PI);
+    return (angle < 0) ? angle + TWO_PI : angle;
+}
+
+// Fixed-width TLE field as a number
+static float field(const char* line, size_t start, size_t len) {
+    char text[16];
+    memcpy(text, line + start, len);
+    text[len] = '\0';
+    return (float)atof(text);
+}
+
+// Digits of a fixed-width field; false if any is not a digit
+static bool digits(const char* line, size_t start, size_t len, uint32_t& value) {
+    value = 0;
+    for (size_t i = start; i < start + len; i++) {
+        if (line[i] < '0' || line[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (uint32_t)(line[i] - '0');
+    }
+    return true;
+}
+
+// Line number, length and checksum (digits, 1 per '-', mod 10)
+static bool validLine(const char* line, char number) {
+    if (strlen(line) < TLE_LINE_LEN || line[0] != number || line[1] != ' ') {
+        return false;
+    }
+    uint8_t sum = 0;
+    for (size_t i = 0; i < TLE_LINE_LEN - 1; i++) {
+        if (line[i] >= '0' && line[i] <= '9') {
+            sum += (uint8_t)(line[i] - '0');
+        } else if (line[i] == '-') {
+            sum++;
+        }
+    }
+    return line[TLE_LINE_LEN - 1] == (char)('0' + sum % 10);
+}
+
+// Field with an assumed leading decimal point and a power of ten
+// (" 12345-4" is 0.12345e-4)
+static float exponential(const char* line, size_t start) {
+    uint32_t mantissa;
+    if (!digits(line, start + 1, 5, mantissa)) {
+        return 0;
+    }
+    float value = (float)mantissa * 1e-5f;
+    int exponent = line[start + 7] - '0';
+    if (line[start + 6] == '-') {
+        exponent = -exponent;
+    }
+    value *= powf(10.0f, (float)exponent);
+    return (line[start] == '-') ? -value : value;
+}
+
+// Nearest integer
+static int32_t toInt(float value) {
+    return (int32_t)((value < 0) ? value - 0.5f : value + 0.5f);
+}
+
+static bool isLeap(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// Days from 1970-01-01 to the first of the year
+static uint32_t daysBefore(int year) {
+    uint32_t days = 0;
+    for (int y = 1970; y < year; y++) {
+        days += isLeap(y) ? 366 : 365;
+    }
+    return days;
+}
+
+uint32_t YaesuSatellite::toUnix(int year, int month, int day, int hour, int minute, int second) {
+    static const uint16_t MONTH_DAYS[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    uint32_t days = daysBefore(year) + MONTH_DAYS[month - 1] + (uint32_t)(day - 1);
+    if (month > 2 && isLeap(year)) {
+        days++;
+    }
+    return days * 86400UL + (uint32_t)hour * 3600UL + (uint32_t)minute * 60UL + (uint32_t)second;
+}
+
+YaesuSatellite::YaesuSatellite()
+    : _enabled(false)
+    , _loaded(false)
+    , _catalog(0)
+    , _epoch(0)
+    , _epochMs(0)
+    , _downlink(SAT_DEFAULT_DOWNLINK)
+    , _clockSet(false)
+    , _clock(0)
+    , _clockMs(0)
+    , _sampled(false)
+    , _t0(0)
+    , _level(0)
+    , _floor(0)
+    , _written(0xFF)
+{
+    memset(&_pass, 0, sizeof(_pass));
+
+    char line1[TLE_LINE_LEN + 1];
+    char line2[TLE_LINE_LEN + 1];
+    memcpy_P(line1, DEFAULT_TLE1, sizeof(line1));
+    memcpy_P(line2, DEFAULT_TLE2, sizeof(line2));
+    loadTle(line1, line2);
+    setStation(DEFAULT_LATITUDE, DEFAULT_LONGITUDE, 0);
+}
+
+void YaesuSatellite::setEnabled(bool enabled) {
+    _enabled = enabled;
+    _sampled = false;
+    _written = 0xFF;
+}
+
+void YaesuSatellite::setFloor(uint8_t level) {
+    _floor = level;
+    _written = 0xFF;
+}
+
+bool YaesuSatellite::loadTle(const char* line1, const char* line2) {
+    uint32_t catalog, catalog2, year, day, fraction;
+    if (!validLine(line1, '1') || !validLine(line2, '2') ||
+        !digits(line1, 2, 5, catalog) || !digits(line2, 2, 5, catalog2) || catalog != catalog2 ||
+        !digits(line1, 18, 2, year) || !digits(line1, 20, 3, day) ||
+        line1[23] != '.' || !digits(line1, 24, 8, fraction) || day < 1) {
+        return false;
+    }
+
+    // Periods of 225 minutes and more need the deep-space terms, which
+    // are not modelled
+    uint32_t ecc;
+    float inclination = field(line2, 8, 8);
+    float meanMotion = field(line2, 52, 11);  // Revolutions per day
+    if (!digits(line2, 26, 7, ecc) || meanMotion <= 1440.0f / 225.0f ||
+        inclination < 0 || inclination > 180) {
+        return false;
+    }
+
+    // Epoch: two-digit year (57-99 are 1900s), day of the year and its
+    // fraction, kept to the millisecond
+    year += (year < 57) ? 2000 : 1900;
+    if (year < 1970) {
+        return false;
+    }
+    uint32_t ms = (uint32_t)(((uint64_t)fraction * 86400000ULL) / 100000000ULL);
+    _epoch = (daysBefore((int)year) + day - 1) * 86400UL + ms / 1000;
+    _epochMs = (uint16_t)(ms % 1000);
+
+    // Sidereal angle at the epoch (GMST, linear in UT1 days from J2000);
+    // the whole days' 360-degree turns drop out before float rounding
+    int32_t sinceJ2000 = (int32_t)(_epoch - (uint32_t)J2000);
+    int32_t days = sinceJ2000 / 86400L;
+    float dayFraction = ((float)(sinceJ2000 - days * 86400L) + _epochMs * 0.001f) / 86400.0f;
+    float gmst = 280.46061837f + fmodf(0.98564736629f * (float)days, 360.0f) +
+                 360.98564736629f * dayFraction;
+    _gmstEpoch = wrap(gmst * DEG);
+
+    _catalog = catalog;
+    _inclo = inclination * DEG;
+    _nodeo = field(line2, 17, 8) * DEG;
+    _ecco = (float)ecc * 1e-7f;
+    _argpo = field(line2, 34, 8) * DEG;
+    _mo = field(line2, 43, 8) * DEG;
+    _no = meanMotion * TWO_PI / 1440.0f;
+    _bstar = exponential(line1, 53);
+
+    init();
+    _loaded = true;
+    if (!_clockSet) {
+        _clock = _epoch;
+        _clockMs = 0;
+    }
+    _sampled = false;
+    return true;
+}
+
+// SGP4 initialisation (Hoots and Roehrich, Spacetrack Report No. 3, as
+// revised by Vallado et al. 2006), near-earth orbits only
+void YaesuSatellite::init() {
+    const float x2o3 = 2.0f / 3.0f;
+
+    // Recover the original mean motion and semi-major axis from the
+    // Kozai mean motion in the element set
+    float eccsq = _ecco * _ecco;
+    float omeosq = 1.0f - eccsq;
+    float rteosq = sqrtf(omeosq);
+    _cosio = cosf(_inclo);
+    float cosio2 = _cosio * _cosio;
+    float ak = powf(XKE / _no, x2o3);
+    float d1 = 0.75f * J2 * (3.0f * cosio2 - 1.0f) / (rteosq * omeosq);
+    float del = d1 / (ak * ak);
+    float adel = ak * (1.0f - del * del - del * (1.0f / 3.0f + 134.0f * del * del / 81.0f));
+    del = d1 / (adel * adel);
+    _no = _no / (1.0f + del);
+    _ao = powf(XKE / _no, x2o3);
+    _sinio = sinf(_inclo);
+    float po = _ao * omeosq;
+    float con42 = 1.0f - 5.0f * cosio2;
+    _con41 = -con42 - cosio2 - cosio2;
+    float posq = po * po;
+    float rp = _ao * (1.0f - _ecco);
+
+    // Perigees below 220 km drop the higher-order drag terms
+    _isimp = (rp < 220.0f / RE + 1.0f);
+
+    // Atmospheric density parameters, lowered for perigees under 156 km
+    float sfour = 78.0f / RE + 1.0f;
+    float qzms24 = powf((120.0f - 78.0f) / RE, 4.0f);
+    float perige = (rp - 1.0f) * RE;
+    if (perige < 156.0f) {
+        sfour = (perige < 98.0f) ? 20.0f : perige - 78.0f;
+        qzms24 = powf((120.0f - sfour) / RE, 4.0f);
+        sfour = sfour / RE + 1.0f;
+    }
+
+    float pinvsq = 1.0f / posq;
+    float tsi = 1.0f / (_ao - sfour);
+    _eta = _ao * _ecco * tsi;
+    float etasq = _eta * _eta;
+    float eeta = _ecco * _eta;
+    float psisq = fabsf(1.0f - etasq);
+    float coef = qzms24 * powf(tsi, 4.0f);
+    float coef1 = coef / powf(psisq, 3.5f);
+    float cc2 = coef1 * _no * (_ao * (1.0f + 1.5f * etasq + eeta * (4.0f + etasq)) +
+                0.375f * J2 * tsi / psisq * _con41 * (8.0f + 3.0f * etasq * (8.0f + etasq)));
+    _cc1 = _bstar * cc2;
+    float cc3 = 0;
+    if (_ecco > 1.0e-4f) {
+        cc3 = -2.0f * coef * tsi * J3OJ2 * _no * _sinio / _ecco;
+    }
+    _x1mth2 = 1.0f - cosio2;
+    _cc4 = 2.0f * _no * coef1 * _ao * omeosq *
+           (_eta * (2.0f + 0.5f * etasq) + _ecco * (0.5f + 2.0f * etasq) -
+            J2 * tsi / (_ao * psisq) *
+            (-3.0f * _con41 * (1.0f - 2.0f * eeta + etasq * (1.5f - 0.5f * eeta)) +
+             0.75f * _x1mth2 * (2.0f * etasq - eeta * (1.0f + etasq)) * cosf(2.0f * _argpo)));
+    _cc5 = 2.0f * coef1 * _ao * omeosq * (1.0f + 2.75f * (etasq + eeta) + eeta * etasq);
+
+    // Secular rates of the mean anomaly, argument of perigee and node
+    float cosio4 = cosio2 * cosio2;
+    float temp1 = 1.5f * J2 * pinvsq * _no;
+    float temp2 = 0.5f * temp1 * J2 * pinvsq;
+    float temp3 = -0.46875f * J4 * pinvsq * pinvsq * _no;
+    _mdot = _no + 0.5f * temp1 * rteosq * _con41 +
+            0.0625f * temp2 * rteosq * (13.0f - 78.0f * cosio2 + 137.0f * cosio4);
+    _argpdot = -0.5f * temp1 * con42 + 0.0625f * temp2 * (7.0f - 114.0f * cosio2 + 395.0f * cosio4) +
+               temp3 * (3.0f - 36.0f * cosio2 + 49.0f * cosio4);
+    float xhdot1 = -temp1 * _cosio;
+    _nodedot = xhdot1 + (0.5f * temp2 * (4.0f - 19.0f * cosio2) +
+                         2.0f * temp3 * (3.0f - 7.0f * cosio2)) * _cosio;
+    _omgcof = _bstar * cc3 * cosf(_argpo);
+    _xmcof = 0;
+    if (_ecco > 1.0e-4f) {
+        _xmcof = -x2o3 * coef * _bstar / eeta;
+    }
+    _nodecf = 3.5f * omeosq * xhdot1 * _cc1;
+    _t2cof = 1.5f * _cc1;
+
+    // Long-period periodics; the divisor is held off zero near 180 degrees
+    float cosio1 = (fabsf(_cosio + 1.0f) > 1.5e-6f) ? 1.0f + _cosio : 1.5e-6f;
+    _xlcof = -0.25f * J3OJ2 * _sinio * (3.0f + 5.0f * _cosio) / cosio1;
+    _aycof = -0.5f * J3OJ2 * _sinio;
+    _delmo = powf(1.0f + _eta * cosf(_mo), 3.0f);
+    _sinmao = sinf(_mo);
+    _x7thm1 = 7.0f * cosio2 - 1.0f;
+
+    _d2 = _d3 = _d4 = 0;
+    _t3cof = _t4cof = _t5cof = 0;
+    if (!_isimp) {
+        float cc1sq = _cc1 * _cc1;
+        _d2 = 4.0f * _ao * tsi * cc1sq;
+        float temp = _d2 * tsi * _cc1 / 3.0f;
+        _d3 = (17.0f * _ao + sfour) * temp;
+        _d4 = 0.5f * temp * _ao * tsi * (221.0f * _ao + 31.0f * sfour) * _cc1;
+        _t3cof = _d2 + 2.0f * cc1sq;
+        _t4cof = 0.25f * (3.0f * _d3 + _cc1 * (12.0f * _d2 + 10.0f * cc1sq));
+        _t5cof = 0.2f * (3.0f * _d4 + 12.0f * _cc1 * _d3 + 6.0f * _d2 * _d2 +
+                         15.0f * cc1sq * (2.0f * _d2 + cc1sq));
+    }
+}
+
+void YaesuSatellite::propagate(int32_t seconds, SatelliteSample& sample) const {
+    sample.valid = false;
+    float tsinceS = (float)seconds - _epochMs * 0.001f;
+    float t = tsinceS / 60.0f;
+
+    // Secular gravity and atmospheric drag
+    float xmdf = _mo + _mdot * t;
+    float argpdf = _argpo + _argpdot * t;
+    float nodedf = _nodeo + _nodedot * t;
+    float argpm = argpdf;
+    float mm = xmdf;
+    float t2 = t * t;
+    float nodem = nodedf + _nodecf * t2;
+    float tempa = 1.0f - _cc1 * t;
+    float tempe = _bstar * _cc4 * t;
+    float templ = _t2cof * t2;
+    if (!_isimp) {
+        float delomg = _omgcof * t;
+        float delm = _xmcof * (powf(1.0f + _eta * cosf(xmdf), 3.0f) - _delmo);
+        float temp = delomg + delm;
+        mm = xmdf + temp;
+        argpm = argpdf - temp;
+        float t3 = t2 * t;
+        float t4 = t3 * t;
+        tempa = tempa - _d2 * t2 - _d3 * t3 - _d4 * t4;
+        tempe = tempe + _bstar * _cc5 * (sinf(mm) - _sinmao);
+        templ = templ + _t3cof * t3 + t4 * (_t4cof + t * _t5cof);
+    }
+
+    float am = powf(XKE / _no, 2.0f / 3.0f) * tempa * tempa;
+    if (am <= 0) {
+        return;
+    }
+    float nm = XKE / powf(am, 1.5f);
+    float em = _ecco - tempe;
+    if (em >= 1.0f || em < -0.001f) {
+        return;
+    }
+    if (em < 1.0e-6f) {
+        em = 1.0e-6f;
+    }
+    mm = mm + _no * templ;
+    float xlm = wrap(mm + argpm + nodem);
+    nodem = wrap(nodem);
+    argpm = wrap(argpm);
+
+    // Long-period periodics
+    float axnl = em * cosf(argpm);
+    float temp = 1.0f / (am * (1.0f - em * em));
+    float aynl = em * sinf(argpm) + temp * _aycof;
+    float xl = xlm + temp * _xlcof * axnl;
+
+    // Kepler's equation, in the equinoctial elements
+    float u = wrap(xl - nodem);
+    float eo1 = u;
+    float sineo1 = 0;
+    float coseo1 = 1;
+    for (int i = 0; i < 10; i++) {
+        sineo1 = sinf(eo1);
+        coseo1 = cosf(eo1);
+        float step = (u - aynl * coseo1 + axnl * sineo1 - eo1) /
+                     (1.0f - coseo1 * axnl - sineo1 * aynl);
+        if (fabsf(step) >= 0.95f) {
+            step = (step > 0) ? 0.95f : -0.95f;
+        }
+        eo1 += step;
+        if (fabsf(step) < 1.0e-6f) {
+            break;
+        }
+    }
+    sineo1 = sinf(eo1);
+    coseo1 = cosf(eo1);
+
+    // Short-period periodics
+    float ecose = axnl * coseo1 + aynl * sineo1;
+    float esine = axnl * sineo1 - aynl * coseo1;
+    float el2 = axnl * axnl + aynl * aynl;
+    float pl = am * (1.0f - el2);
+    if (pl < 0) {
+        return;
+    }
+    float rl = am * (1.0f - ecose);
+    float rdotl = sqrtf(am) * esine / rl;
+    float rvdotl = sqrtf(pl) / rl;
+    float betal = sqrtf(1.0f - el2);
+    temp = esine / (1.0f + betal);
+    float sinu = am / rl * (sineo1 - aynl - axnl * temp);
+    float cosu = am / rl * (coseo1 - axnl + aynl * temp);
+    float su = atan2f(sinu, cosu);
+    float sin2u = (cosu + cosu) * sinu;
+    float cos2u = 1.0f - 2.0f * sinu * sinu;
+    temp = 1.0f / pl;
+    float temp1 = 0.5f * J2 * temp;
+    float temp2 = temp1 * temp;
+
+    float mrt = rl * (1.0f - 1.5f * temp2 * betal * _con41) + 0.5f * temp1 * _x1mth2 * cos2u;
+    if (mrt < 1.0f) {
+        return;  // Below the surface: decayed
+    }
+    su = su - 0.25f * temp2 * _x7thm1 * sin2u;
+    float xnode = nodem + 1.5f * temp2 * _cosio * sin2u;
+    float xinc = _inclo + 1.5f * temp2 * _cosio * _sinio * cos2u;
+    float mvt = rdotl - nm * temp1 * _x1mth2 * sin2u / XKE;
+    float rvdot = rvdotl + nm * temp1 * (_x1mth2 * cos2u + 1.5f * _con41) / XKE;
+
+    // Orientation vectors, then position (km) and velocity (km/s) in the
+    // true-equator, mean-equinox frame
+    float sinsu = sinf(su), cossu = cosf(su);
+    float snod = sinf(xnode), cnod = cosf(xnode);
+    float sini = sinf(xinc), cosi = cosf(xinc);
+    float xmx = -snod * cosi;
+    float xmy = cnod * cosi;
+    float ux = xmx * sinsu + cnod * cossu;
+    float uy = xmy * sinsu + snod * cossu;
+    float uz = sini * sinsu;
+    float vx = xmx * cossu - cnod * sinsu;
+    float vy = xmy * cossu - snod * sinsu;
+    float vz = sini * cossu;
+    float vkmpersec = RE * XKE / 60.0f;
+    float r[3] = {mrt * ux * RE, mrt * uy * RE, mrt * uz * RE};
+    float v[3] = {(mvt * ux + rvdot * vx) * vkmpersec,
+                  (mvt * uy + rvdot * vy) * vkmpersec,
+                  (mvt * uz + rvdot * vz) * vkmpersec};
+
+    // Earth-fixed: turn by the sidereal angle, and take out the earth's
+    // rotation from the velocity
+    float theta = wrap(_gmstEpoch + EARTH_RATE * tsinceS);
+    float st = sinf(theta), ct = cosf(theta);
+    float x = ct * r[0] + st * r[1];
+    float y = -st * r[0] + ct * r[1];
+    float z = r[2];
+    float vxe = ct * v[0] + st * v[1] + EARTH_RATE * y;
+    float vye = -st * v[0] + ct * v[1] - EARTH_RATE * x;
+    float vze = v[2];
+
+    // From the station: range rate, and east, north and up
+    float dx = x - _station[0];
+    float dy = y - _station[1];
+    float dz = z - _station[2];
+    float range = sqrtf(dx * dx + dy * dy + dz * dz);
+    sample.rangeRate = (dx * vxe + dy * vye + dz * vze) / range;
+    sample.enu[0] = -_sinLon * dx + _cosLon * dy;
+    sample.enu[1] = -_sinLat * _cosLon * dx - _sinLat * _sinLon * dy + _cosLat * dz;
+    sample.enu[2] = _cosLat * _cosLon * dx + _cosLat * _sinLon * dy + _sinLat * dz;
+    sample.valid = true;
+}
+
+void YaesuSatellite::setStation(float latitude, float longitude, float altitude) {
+    _sinLat = sinf(latitude * DEG);
+    _cosLat = cosf(latitude * DEG);
+    _sinLon = sinf(longitude * DEG);
+    _cosLon = cosf(longitude * DEG);
+
+    // Geodetic to earth-fixed on the WGS-72 ellipsoid
+    float e2 = FLATTENING * (2.0f - FLATTENING);
+    float n = RE / sqrtf(1.0f - e2 * _sinLat * _sinLat);
+    float h = altitude * 0.001f;
+    _station[0] = (n + h) * _cosLat * _cosLon;
+    _station[1] = (n + h) * _cosLat * _sinLon;
+    _station[2] = (n * (1.0f - e2) + h) * _sinLat;
+    _sampled = false;
+}
+
+void YaesuSatellite::setTime(uint32_t utc, uint32_t now) {
+    _clock = utc;
+    _clockMs = now;
+    _clockSet = true;
+    _sampled = false;
+}
+
+uint32_t YaesuSatellite::getTime(uint32_t now) const {
+    return _clock + (now - _clockMs) / 1000UL;
+}
+
+int32_t YaesuSatellite::elapsed(uint32_t now, uint16_t& ms) const {
+    uint32_t since = now - _clockMs;
+    ms = (uint16_t)(since % 1000UL);
+    return (int32_t)(_clock - _epoch) + (int32_t)(since / 1000UL);
+}
+
+bool YaesuSatellite::findPass(uint32_t now) {
+    if (!_loaded) {
+        return false;
+    }
+
+    // The next rise after the current time; a pass in progress is skipped
+    uint16_t ms;
+    int32_t start = elapsed(now, ms);
+    SatelliteSample sample;
+    propagate(start, sample);
+    bool wasUp = sample.valid && sample.enu[2] > 0;
+    for (int32_t t = start + SAT_SEARCH_STEP_S; t <= start + SAT_SEARCH_SPAN_S; t += SAT_SEARCH_STEP_S) {
+        propagate(t, sample);
+        bool up = sample.valid && sample.enu[2] > 0;
+        if (up && !wasUp) {
+            // Back to the second it rose (bisection, about six steps)
+            int32_t low = t - SAT_SEARCH_STEP_S;
+            int32_t high = t;
+            while (high - low > 1) {
+                int32_t mid = low + (high - low) / 2;
+                propagate(mid, sample);
+                if (sample.valid && sample.enu[2] > 0) {
+                    high = mid;
+                } else {
+                    low = mid;
+                }
+            }
+            setTime(_epoch + (uint32_t)high, now);
+            return true;
+        }
+        wasUp = up;
+    }
+    return false;
+}
+
+void YaesuSatellite::update(YaesuState& state, uint32_t now) {
+    if (!_enabled || !_loaded) {
+        return;
+    }
+
+    // Keep points at the step either side of now; a step forward costs
+    // one propagation, a jump (clock set, first call) two
+    uint16_t ms;
+    int32_t t = elapsed(now, ms);
+    if (!_sampled || t < _t0 || t >= _t0 + 2 * SAT_STEP_S) {
+        _t0 = t;
+        propagate(_t0, _samples[0]);
+        propagate(_t0 + SAT_STEP_S, _samples[1]);
+        _sampled = true;
+    } else if (t >= _t0 + SAT_STEP_S) {
+        _samples[0] = _samples[1];
+        _t0 += SAT_STEP_S;
+        propagate(_t0 + SAT_STEP_S, _samples[1]);
+    }
+
+    if (!_samples[0].valid || !_samples[1].valid) {
+        _pass.valid = false;
+        _pass.visible = false;
+        _pass.dopplerHz = 0;
+        _level = 0;
+        state.dopplerHz = 0;
+        return;
+    }
+
+    // Linear between the points: the range rate curves most at closest
+    // approach, where this is still within a couple of m/s
+    float f = ((float)(t - _t0) * 1000.0f + ms) / (SAT_STEP_S * 1000.0f);
+    const SatelliteSample& a = _samples[0];
+    const SatelliteSample& b = _samples[1];
+    float east = a.enu[0] + (b.enu[0] - a.enu[0]) * f;
+    float north = a.enu[1] + (b.enu[1] - a.enu[1]) * f;
+    float up = a.enu[2] + (b.enu[2] - a.enu[2]) * f;
+    float rangeRate = a.rangeRate + (b.rangeRate - a.rangeRate) * f;
+    float range = sqrtf(east * east + north * north + up * up);
+
+    _pass.valid = true;
+    _pass.visible = (up > 0);
+    _pass.elevation = (int16_t)toInt(asinf(up / range) / DEG);
+    float azimuth = atan2f(east, north) / DEG;
+    _pass.azimuth = (uint16_t)(toInt(azimuth + 360.0f) % 360);
+    _pass.rangeKm = (uint32_t)toInt(range);
+    _pass.rangeRate = toInt(rangeRate * 1000.0f);
+    _pass.dopplerHz = toInt(-(float)_downlink * rangeRate / SPEED_OF_LIGHT);
+    state.dopplerHz = _pass.dopplerHz;
+
+    _level = 0;
+    if (_pass.visible) {
+        float level = SAT_LEVEL - 48.0f * log10f(range / SAT_LEVEL_RANGE_KM);
+        _level = (uint8_t)constrain((int)level, 1, 255);
+    }
+}
+
+void YaesuSatellite::retune(YaesuState& state, YaesuBandMap& bandMap) {
+    if (!_enabled) {
+        return;
+    }
+
+    uint8_t level = _floor;
+    if (_level > level) {
+        uint32_t low, high;
+        YaesuBandMap::passband(state.getCurrentMode(), state.getCurrentFreq(), low, high);
+        uint32_t heard = _downlink + (uint32_t)_pass.dopplerHz;
+        if (heard >= low && heard <= high) {
+            level = _level;
+        }
+    }
+    if (level == _written) {
+        return;
+    }
+    _written = level;
+
+    if (bandMap.isEnabled()) {
+        bandMap.setFloor(level);
+    } else {
+        state.set(state.signalLevel, level, CHANGED_SMETER);
+        state.set(state.smeter, level, CHANGED_SMETER);
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include "YaesuState.h"
+#include "YaesuBandMap.h"
+
+// Propagation step (seconds): SGP4 runs once per step, and the pass
+// geometry is interpolated in between
+#ifndef SAT_STEP_S
+#define SAT_STEP_S 1
+#endif
+
+// Pass search: step, and how far ahead to look
+#define SAT_SEARCH_STEP_S 60
+#define SAT_SEARCH_SPAN_S 86400L
+
+// Downlink strength: SAT_LEVEL at SAT_LEVEL_RANGE_KM, falling with free
+// space loss (20 dB per decade of range, about 2.4 S-meter units per dB)
+#define SAT_LEVEL 150
+#define SAT_LEVEL_RANGE_KM 500.0f
+
+// Default downlink: the ISS FM voice downlink
+#define SAT_DEFAULT_DOWNLINK 145800000UL
+
+// One propagated point of the pass: the satellite as seen from the
+// station, in local east, north and up (km), and the range rate (km/s)
+struct SatelliteSample {
+    bool valid;          // False if SGP4 failed (decayed orbit)
+    float enu[3];
+    float rangeRate;
+};
+
+// Pass geometry at the current time, for the status display
+struct SatellitePass {
+    bool valid;
+    bool visible;        // Above the horizon
+    int16_t elevation;   // Degrees
+    uint16_t azimuth;    // Degrees from north
+    uint32_t rangeKm;
+    int32_t rangeRate;   // m/s, positive moving away
+    int32_t dopplerHz;   // Shift of the downlink
+};
+
+// Doppler-shifted satellite downlink for the S-meter
+// A two-line element set (the ISS by default, from flash, or one loaded
+// from the console) is propagated with SGP4 (near-earth model, no deep
+// space terms) in single precision, cheap enough for a Cortex-M4F and
+// usable on the FPU-less parts. The satellite is seen from a ground
+// station; its range rate shifts the downlink by -f * rr / c, which
+// goes to YaesuState::dopplerHz, and the S-meter hears the downlink when
+// the satellite is above the horizon and the shifted frequency is in the
+// receiver passband, at a level that falls with range.
+//
+// SGP4 runs once per SAT_STEP_S, on whole seconds since the element
+// set's epoch; update() interpolates the station-relative position and
+// range rate between the last two points, so a tick at a 10 Hz tracking
+// rate costs a few multiplies and a square root. Angles that grow with
+// time (mean anomaly, node, sidereal time) stay accurate to a few
+// kilometres along track for a week or two from the epoch, which is as
+// long as an element set is good for anyway.
+class YaesuSatellite {
+public:
+    YaesuSatellite();
+
+    // Off by default; when off, update() and retune() do nothing
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return _enabled; }
+
+    // Load an element set from its two lines (69 characters each, with
+    // valid checksums); false if either line does not parse, or the orbit
+    // needs the deep-space model. A clock not yet set moves to the new
+    // epoch.
+    bool loadTle(const char* line1, const char* line2);
+
+    // NORAD catalog number of the satellite
+    uint32_t getCatalogNumber() const { return _catalog; }
+
+    // Ground station, geodetic degrees and metres
+    void setStation(float latitude, float longitude, float altitude);
+
+    // Nominal downlink frequency (Hz)
+    void setDownlink(uint32_t hz) { _downlink = hz; }
+    uint32_t getDownlink() const { return _downlink; }
+
+    // UTC (Unix seconds) at now (ms, millis()); until it is set the
+    // clock starts at the element set's epoch
+    void setTime(uint32_t utc, uint32_t now);
+    bool isClockSet() const { return _clockSet; }
+    uint32_t getTime(uint32_t now) const;
+
+    // Unix seconds of a UTC date and time (1970-2099)
+    static uint32_t toUnix(int year, int month, int day, int hour, int minute, int second);
+
+    // Move the clock to the start of the next pass, searching up to
+    // SAT_SEARCH_SPAN_S ahead in SAT_SEARCH_STEP_S steps (one SGP4 run
+    // each, so this is for the console, not the main loop); false if
+    // there is no pass in that time
+    bool findPass(uint32_t now);
+
+    // Level read when the downlink is not heard (the console S-meter value)
+    void setFloor(uint8_t level);
+
+    // Advance the pass to now (ms) and set the state's Doppler shift
+    void update(YaesuState& state, uint32_t now);
+
+    // Hear the downlink on the current VFO: the S-meter level goes to the
+    // band map as its floor when the map is on, to the state when not
+    void retune(YaesuState& state, YaesuBandMap& bandMap);
+
+    const SatellitePass& getPass() const { return _pass; }
+
+private:
+    bool _enabled;
+
+    // Element set at epoch (radians, radians/minute)
+    bool _loaded;
+    uint32_t _catalog;
+    uint32_t _epoch;        // Unix seconds
+    uint16_t _epochMs;
+    float _gmstEpoch;       // Sidereal angle at the epoch
+    float _no, _ecco, _inclo, _nodeo, _argpo, _mo, _bstar;
+
+    // SGP4 constants derived from the elements
+    bool _isimp;
+    float _ao, _con41, _x1mth2, _x7thm1, _cosio, _sinio;
+    float _eta, _cc1, _cc4, _cc5, _d2, _d3, _d4, _delmo, _sinmao;
+    float _mdot, _argpdot, _nodedot, _omgcof, _xmcof, _nodecf;
+    float _t2cof, _t3cof, _t4cof, _t5cof, _xlcof, _aycof;
+
+    // Ground station, earth-fixed (km), and its local vertical
+    float _station[3];
+    float _sinLat, _cosLat, _sinLon, _cosLon;
+
+    uint32_t _downlink;
+
+    // Clock: UTC _clock at millis() _clockMs
+    bool _clockSet;
+    uint32_t _clock;
+    uint32_t _clockMs;
+
+    // Points at _t0 and _t0 + SAT_STEP_S (seconds since the epoch second)
+    bool _sampled;
+    int32_t _t0;
+    SatelliteSample _samples[2];
+
+    SatellitePass _pass;
+    uint8_t _level;         // Downlink level, 0 below the horizon
+    uint8_t _floor;
+    uint8_t _written;       // Level last given to the S-meter, 0xFF for none
+
+    // Derive the SGP4 constants from the elements
+    void init();
+
+    // Propagate to seconds since the epoch second, as seen from the station
+    void propagate(int32_t seconds, SatelliteSample& sample) const;
+
+    // Seconds since the epoch second at now, and the milliseconds after
+    int32_t elapsed(uint32_t now, uint16_t& ms) const;
+};
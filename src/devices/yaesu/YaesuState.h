@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <string.h>
 
 // Yaesu operating modes
 enum class YaesuMode : uint8_t {
@@ -29,18 +30,48 @@ enum class YaesuVFO : uint8_t {
     VFO_B = 1
 };
 
-// Radio ID for FT-991A
-#define YAESU_RADIO_ID "0670"
-
 // Default frequencies (Hz)
 #define DEFAULT_FREQ_VFO_A 14074000UL   // 20m FT8
 #define DEFAULT_FREQ_VFO_B 7074000UL    // 40m FT8
 
-// Frequency limits (Hz)
+// Frequency limits (Hz): the widest coverage of any CAT model, and the
+// range memory channels hold; each model's own is in its CATModel
 #define FREQ_MIN 30000UL         // 30 kHz
 #define FREQ_MAX 470000000UL     // 470 MHz
 
+// EX menu items the emulator keeps (table in CATParser.cpp)
+#define YAESU_MENU_COUNT 6
+
+struct YaesuMenuItem {
+    uint8_t number;   // EXnnn
+    uint8_t digits;   // Width of the value
+    uint16_t min;
+    uint16_t max;
+    uint16_t value;   // Default
+};
+
+extern const YaesuMenuItem YAESU_MENU[YAESU_MENU_COUNT] PROGMEM;
+
+// State fields tracked for change reporting (bit flags for YaesuState::changed)
+// Auto-Information mode pushes the reports for changed fields to clients
+enum YaesuChange : uint16_t {
+    CHANGED_FREQ_A = 0x0001,   // freqVfoA
+    CHANGED_FREQ_B = 0x0002,   // freqVfoB
+    CHANGED_MODE   = 0x0004,   // modeVfoA, modeVfoB
+    CHANGED_VFO    = 0x0008,   // currentVfo
+    CHANGED_PTT    = 0x0010,   // ptt
+    CHANGED_POWER  = 0x0020,   // powerOn
+    CHANGED_RIT    = 0x0040,   // ritOn, ritOffset
+    CHANGED_XIT    = 0x0080,   // xitOn, xitOffset
+    CHANGED_SMETER = 0x0100,   // smeter
+    CHANGED_METERS = 0x0200,   // powerMeter, swrMeter, alcMeter, compMeter
+    CHANGED_LEVELS = 0x0400,   // squelch, afGain, rfGain
+    CHANGED_SETTINGS = 0x0800  // Front panel settings below rfGain
+};
+
 // State structure representing the emulated radio
+// Fields may be read directly; writers use set() (or the helpers below) so
+// that changes are recorded in changed and dirty
 struct YaesuState {
     // VFO frequencies (Hz)
     uint32_t freqVfoA;
@@ -67,11 +98,18 @@ struct YaesuState {
 
     // Meters (console-controlled simulation values)
     uint8_t smeter;     // 0-255 (CAT reports 0-15 for S0-S9, or 0-255 for raw)
+    uint8_t signalLevel; // S-meter level before meter dynamics: the console
+                         // value, or the band map's station or the
+                         // satellite downlink on frequency
     uint8_t powerMeter; // 0-255
     uint8_t swrMeter;   // 0-255
     uint8_t alcMeter;   // 0-255
     uint8_t compMeter;  // 0-255
 
+    // Doppler shift (Hz) of the satellite downlink (YaesuSatellite): a
+    // tracking client tunes to the downlink plus this; not a CAT field
+    int32_t dopplerHz;
+
     // Squelch
     uint8_t squelch;    // 0-100
 
@@ -79,6 +117,74 @@ struct YaesuState {
     uint8_t afGain;     // 0-255
     uint8_t rfGain;     // 0-255
 
+    // Front panel settings, read and set through the CAT command table
+    // (ranges and CAT opcodes are in CATParser.cpp)
+    uint8_t txPower;        // PC, watts
+    uint8_t agc;            // GT
+    uint8_t preamp;         // PA
+    uint8_t attenuator;     // RA
+    uint8_t noiseBlanker;   // NB
+    uint8_t nbLevel;        // NL
+    uint8_t noiseReduction; // NR
+    uint8_t nrLevel;        // RL
+    uint8_t beatCancel;     // BC
+    uint8_t narrow;         // NA
+    uint8_t width;          // SH, bandwidth index
+    int16_t ifShift;        // IS, Hz
+    uint16_t contour[4];    // CO, contour on/off, contour Hz, APF on/off, APF Hz
+    uint16_t notch[2];      // BP, on/off, notch level
+    uint8_t tuner;          // AC
+    uint8_t micGain;        // MG
+    uint8_t procLevel;      // PL
+    uint8_t processor[2];   // PR, speech processor, parametric EQ
+    uint8_t monitor[2];     // ML, on/off, level
+    uint8_t vox;            // VX
+    uint8_t voxGain;        // VG
+    uint16_t voxDelay;      // VD, ms
+    uint8_t keyer;          // KR
+    uint8_t keySpeed;       // KS, WPM
+    uint8_t keyPitch;       // KP, index (300 + 10 * n Hz)
+    uint8_t breakIn;        // BI
+    uint16_t breakInDelay;  // SD, ms
+    uint8_t ctcssMode;      // CT
+    uint8_t toneNumber[2];  // CN, CTCSS tone, DCS code
+    uint8_t rptOffset;      // OS
+    uint8_t fastStep;       // FS
+    uint8_t lock;           // LK
+    uint8_t meterSelect;    // MS
+    uint8_t memoryChannel;  // MC, last channel recalled (YaesuMemory)
+
+    // Menu values served by EX (see the menu table in CATParser.cpp)
+    uint16_t menu[YAESU_MENU_COUNT];
+
+    // Fields changed since the device last took them (YaesuChange flags)
+    uint16_t changed;
+
+    // Fields changed since the reply cache last checked (YaesuChange flags)
+    uint16_t dirty;
+
+    // Set a field, recording a change if the value differs
+    template <typename T>
+    void set(T& field, T value, uint16_t change) {
+        if (field != value) {
+            field = value;
+            markChanged(change);
+        }
+    }
+
+    // Record a change made without set()
+    void markChanged(uint16_t change) {
+        changed |= change;
+        dirty |= change;
+    }
+
+    // Return the changed flags and clear them
+    uint16_t takeChanges() {
+        uint16_t result = changed;
+        changed = 0;
+        return result;
+    }
+
     // Initialize to default values
     void reset() {
         freqVfoA = DEFAULT_FREQ_VFO_A;
@@ -93,6 +199,8 @@ struct YaesuState {
         ritOffset = 0;
         xitOffset = 0;
         smeter = 0;
+        signalLevel = 0;
+        dopplerHz = 0;
         powerMeter = 0;
         swrMeter = 0;
         alcMeter = 0;
@@ -100,6 +208,54 @@ struct YaesuState {
         squelch = 50;
         afGain = 128;
         rfGain = 255;
+        txPower = 100;
+        agc = 0;
+        preamp = 0;
+        attenuator = 0;
+        noiseBlanker = 0;
+        nbLevel = 5;
+        noiseReduction = 0;
+        nrLevel = 8;
+        beatCancel = 0;
+        narrow = 0;
+        width = 0;
+        ifShift = 0;
+        contour[0] = 0;
+        contour[1] = 1000;
+        contour[2] = 0;
+        contour[3] = 0;
+        notch[0] = 0;
+        notch[1] = 100;
+        tuner = 0;
+        micGain = 50;
+        procLevel = 50;
+        processor[0] = 0;
+        processor[1] = 0;
+        monitor[0] = 0;
+        monitor[1] = 50;
+        vox = 0;
+        voxGain = 50;
+        voxDelay = 500;
+        keyer = 0;
+        keySpeed = 20;
+        keyPitch = 40;
+        breakIn = 0;
+        breakInDelay = 200;
+        ctcssMode = 0;
+        toneNumber[0] = 12;
+        toneNumber[1] = 0;
+        rptOffset = 0;
+        fastStep = 0;
+        lock = 0;
+        meterSelect = 0;
+        memoryChannel = 1;
+        for (size_t i = 0; i < YAESU_MENU_COUNT; i++) {
+            YaesuMenuItem item;
+            memcpy_P(&item, &YAESU_MENU[i], sizeof(item));
+            menu[i] = item.value;
+        }
+        changed = 0;
+        dirty = 0xFFFF;  // Every cached reply is stale
     }
 
     // Get frequency of current VFO
@@ -110,12 +266,17 @@ struct YaesuState {
     // Set frequency of current VFO
     void setCurrentFreq(uint32_t freq) {
         if (currentVfo == YaesuVFO::VFO_A) {
-            freqVfoA = freq;
+            set(freqVfoA, freq, CHANGED_FREQ_A);
         } else {
-            freqVfoB = freq;
+            set(freqVfoB, freq, CHANGED_FREQ_B);
         }
     }
 
+    // Change flag for the frequency of current VFO
+    uint16_t currentFreqChange() const {
+        return (currentVfo == YaesuVFO::VFO_A) ? CHANGED_FREQ_A : CHANGED_FREQ_B;
+    }
+
     // Get mode of current VFO
     YaesuMode getCurrentMode() const {
         return (currentVfo == YaesuVFO::VFO_A) ? modeVfoA : modeVfoB;
@@ -124,9 +285,9 @@ struct YaesuState {
     // Set mode of current VFO
     void setCurrentMode(YaesuMode mode) {
         if (currentVfo == YaesuVFO::VFO_A) {
-            modeVfoA = mode;
+            set(modeVfoA, mode, CHANGED_MODE);
         } else {
-            modeVfoB = mode;
+            set(modeVfoB, mode, CHANGED_MODE);
         }
     }
 };
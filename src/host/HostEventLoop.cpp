@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "HostEventLoop.h"
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+
+// Static member initialization
+int HostEventLoop::_fds[HOST_MAX_FDS];
+short HostEventLoop::_revents[HOST_MAX_FDS];
+size_t HostEventLoop::_fdCount = 0;
+
+bool HostEventLoop::addFd(int fd) {
+    for (size_t i = 0; i < _fdCount; i++) {
+        if (_fds[i] == fd) {
+            return true;
+        }
+    }
+    if (_fdCount >= HOST_MAX_FDS) {
+        return false;
+    }
+    _revents[_fdCount] = 0;
+    _fds[_fdCount++] = fd;
+    return true;
+}
+
+void HostEventLoop::removeFd(int fd) {
+    for (size_t i = 0; i < _fdCount; i++) {
+        if (_fds[i] == fd) {
+            _fdCount--;
+            _fds[i] = _fds[_fdCount];
+            _revents[i] = _revents[_fdCount];
+            return;
+        }
+    }
+}
+
+int HostEventLoop::wait(uint32_t timeoutUs) {
+    struct pollfd pfds[HOST_MAX_FDS];
+    for (size_t i = 0; i < _fdCount; i++) {
+        pfds[i].fd = _fds[i];
+        pfds[i].events = POLLIN;
+        pfds[i].revents = 0;
+    }
+
+    // ppoll() rather than poll() so line-timed ports can sleep for less
+    // than a millisecond between characters
+    struct timespec timeout;
+    timeout.tv_sec = timeoutUs / 1000000UL;
+    timeout.tv_nsec = (long)(timeoutUs % 1000000UL) * 1000L;
+
+    int ready = ppoll(pfds, _fdCount, &timeout, nullptr);
+    for (size_t i = 0; i < _fdCount; i++) {
+        _revents[i] = (ready > 0) ? pfds[i].revents : 0;
+    }
+    if (ready < 0 && errno == EINTR) {
+        return 0;
+    }
+    return ready;
+}
+
+bool HostEventLoop::isReadable(int fd) {
+    for (size_t i = 0; i < _fdCount; i++) {
+        if (_fds[i] == fd) {
+            return _revents[i] != 0;
+        }
+    }
+    return false;
+}
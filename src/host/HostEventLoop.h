@@ -0,0 +1,38 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// Maximum file descriptors watched by the host main loop
+#define HOST_MAX_FDS 128
+
+// Main loop idle wait for the Linux host build
+// Serial backends register their file descriptors here; the host main loop
+// sleeps in poll() until one of them has input or the tick expires, instead
+// of spinning like loop() does on a microcontroller.
+class HostEventLoop {
+public:
+    // Watch fd for input, returns false if the table is full
+    static bool addFd(int fd);
+
+    // Stop watching fd
+    static void removeFd(int fd);
+
+    // Block until any watched fd is readable or timeoutUs elapses
+    // Returns number of ready descriptors (0 on timeout)
+    static int wait(uint32_t timeoutUs);
+
+    // True if fd was readable (or hung up) when wait() last returned, so
+    // servers with many connections only read the ones with input
+    static bool isReadable(int fd);
+
+    // Number of watched descriptors
+    static size_t getFdCount() { return _fdCount; }
+
+private:
+    static int _fds[HOST_MAX_FDS];
+    static short _revents[HOST_MAX_FDS];  // From the last wait()
+    static size_t _fdCount;
+};
@@ -0,0 +1,353 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+// Entry point for the Linux host build (env:native)
+// Replaces setup()/loop() from main.cpp: devices are served on
+// pseudo-terminals (or sockets, see -p) and the console runs on stdin/stdout.
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "platform_config.h"
+#include "DeviceManager.h"
+#include "ConfigStorage.h"
+#include "SerialCapture.h"
+#include "core/ConsoleLogger.h"
+#include "console/Console.h"
+#include "devices/yaesu/YaesuDevice.h"
+#include "devices/g5500/G5500Device.h"
+#include "devices/nmea_gps/NMEAGPSDevice.h"
+#include "devices/icom/IcomDevice.h"
+#include "HostEventLoop.h"
+#include "SocketSerialPort.h"
+#include "RigctlServer.h"
+
+// Main loop tick (us): upper bound on how long the loop sleeps when no
+// port has input, so time-driven devices (rotation, NMEA output) keep running
+#define HOST_LOOP_TICK_US 5000
+
+// Default EEPROM image file
+#define HOST_EEPROM_FILE "emulator-eeprom.bin"
+
+// Maximum devices that can be given on the command line
+#define HOST_MAX_CLI_DEVICES MAX_DEVICES
+
+// Maximum rigctld servers that can be given on the command line
+#define HOST_MAX_RIGCTL MAX_DEVICES
+
+// Global instances
+static DeviceManager deviceManager;
+static ConsoleLogger logger(Serial);
+static Console* console = nullptr;
+static RigctlServer* rigctlServers[HOST_MAX_RIGCTL];
+static size_t rigctlCount = 0;
+
+// Device factories
+static YaesuDeviceFactory ft991aFactory(CAT_FT991A);
+static YaesuDeviceFactory ftdx10Factory(CAT_FTDX10);
+static YaesuDeviceFactory ts590Factory(CAT_TS590);
+static YaesuDeviceFactory ts2000Factory(CAT_TS2000);
+static YaesuDeviceFactory k3Factory(CAT_K3);
+static G5500DeviceFactory g5500Factory;
+static NMEAGPSDeviceFactory nmeaGpsFactory;
+static IcomDeviceFactory ic7300Factory(ICOM_IC7300);
+static IcomDeviceFactory ic9700Factory(ICOM_IC9700);
+
+static volatile sig_atomic_t running = 1;
+static struct termios savedTermios;
+static bool termiosSaved = false;
+
+static void onSignal(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static void restoreTerminal() {
+    if (termiosSaved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+    }
+}
+
+// Hand keystrokes to the console unbuffered and unechoed, as a serial
+// monitor would; the console does its own echo and line editing
+static void setupTerminal() {
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &savedTermios) != 0) {
+        return;
+    }
+    termiosSaved = true;
+    atexit(restoreTerminal);
+
+    struct termios tio = savedTermios;
+    tio.c_lflag &= ~(ICANON | ECHO);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &tio);
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+            "Usage: %s [-t] [-c capture-file] [-e eeprom-file] [-p uart=address]... [-r id=address]...\r\n"
+            "          [-d type[:uart[,uart]...]]...\r\n"
+            "  -t              Pace ports at their baud rate like a real UART\r\n"
+            "  -c file         Capture all UART traffic into file (see tools/capture_decode.py)\r\n"
+            "  -e file         EEPROM image for saved configuration (default %s)\r\n"
+            "  -p uart=address Serve a UART on a socket instead of a pty, where\r\n"
+            "                  address is tcp:[host:]port or unix:path\r\n"
+            "                  (e.g., -p 1=tcp:4532 -p 2=unix:/tmp/rotator.sock)\r\n"
+            "  -r id=address   Serve CAT radio id to Hamlib clients as rigctld\r\n"
+            "                  (e.g., -r 0=tcp:4532, then rigctl -m 2 -r localhost:4532)\r\n"
+            "  -d type[:uart]  Create and start a device (e.g., -d ft-991a:1 -d gps)\r\n"
+            "                  Without a UART the first free one is used; more UARTs\r\n"
+            "                  serve the same device (e.g., -d ft-991a:1,2); Icom\r\n"
+            "                  radios given one UART share it as a CI-V bus\r\n"
+            "                  (e.g., -d ic-7300:3 -d ic-9700:3)\r\n",
+            prog, HOST_EEPROM_FILE);
+}
+
+// Find the first UART not in use
+static uint8_t findFreeUart() {
+    for (uint8_t i = 1; i <= PLATFORM_MAX_UARTS; i++) {
+        if (deviceManager.isUartAvailable(i)) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+// Capture into a memory-mapped file, so the capture survives a crash and
+// can be decoded while the emulator runs
+static bool startCaptureFile(const char* path) {
+    size_t size = sizeof(CaptureHeader) + CAPTURE_BUFFER_SIZE;
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    SerialCapture::begin((uint8_t*)map, size);
+    SerialCapture::setEnabled(0, true);
+    return true;
+}
+
+// Install the serial backend from a "uart=address" argument
+static bool setPortFromArg(const char* arg) {
+    const char* eq = strchr(arg, '=');
+    int uart = atoi(arg);
+    if (eq == nullptr || uart < 1 || uart > PLATFORM_MAX_UARTS) {
+        return false;
+    }
+
+    // "pty" is the default backend, nothing to install
+    if (strcmp(eq + 1, "pty") == 0) {
+        return true;
+    }
+
+    SocketSerialPort* port = new SocketSerialPort(eq + 1);
+    if (!port->isValid()) {
+        delete port;
+        return false;
+    }
+    return deviceManager.setSerialPort((uint8_t)uart, port);
+}
+
+// Start a rigctld server from an "id=address" argument
+static bool addRigctlFromArg(const char* arg) {
+    const char* eq = strchr(arg, '=');
+    int id = atoi(arg);
+    if (eq == nullptr || id < 0 || id >= MAX_DEVICES || rigctlCount >= HOST_MAX_RIGCTL) {
+        return false;
+    }
+
+    RigctlServer* server = new RigctlServer(deviceManager, (uint8_t)id, eq + 1);
+    if (!server->isValid()) {
+        delete server;
+        return false;
+    }
+    rigctlServers[rigctlCount++] = server;
+    return true;
+}
+
+// Create a device from a "type[:uart[,uart]...]" argument
+static bool createFromArg(const char* arg) {
+    char typeName[32];
+    strncpy(typeName, arg, sizeof(typeName) - 1);
+    typeName[sizeof(typeName) - 1] = '\0';
+
+    uint8_t uart = 0;
+    char* uarts = strchr(typeName, ':');
+    if (uarts != nullptr) {
+        *uarts++ = '\0';
+        uart = (uint8_t)strtoul(uarts, &uarts, 10);
+    } else {
+        uart = findFreeUart();
+    }
+
+    uint8_t deviceId = deviceManager.createDevice(typeName, uart);
+    if (deviceId == 0xFF) {
+        return false;
+    }
+
+    // Further UARTs serve the same device
+    while (uarts != nullptr && *uarts == ',') {
+        uart = (uint8_t)strtoul(uarts + 1, &uarts, 10);
+        if (!deviceManager.attachUart(deviceId, uart)) {
+            return false;
+        }
+    }
+    return deviceManager.getDevice(deviceId)->begin();
+}
+
+int main(int argc, char** argv) {
+    const char* eepromFile = HOST_EEPROM_FILE;
+    const char* cliDevices[HOST_MAX_CLI_DEVICES];
+    size_t cliDeviceCount = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "tc:e:p:r:d:h")) != -1) {
+        switch (opt) {
+            case 't':
+                deviceManager.setLineTiming(true);
+                break;
+            case 'c':
+                if (!startCaptureFile(optarg)) {
+                    fprintf(stderr, "Cannot create capture file '%s'\r\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'e':
+                eepromFile = optarg;
+                break;
+            case 'p':
+                if (!setPortFromArg(optarg)) {
+                    fprintf(stderr, "Cannot serve UART on '%s'\r\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'r':
+                if (!addRigctlFromArg(optarg)) {
+                    fprintf(stderr, "Cannot serve rigctld on '%s'\r\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'd':
+                if (cliDeviceCount < HOST_MAX_CLI_DEVICES) {
+                    cliDevices[cliDeviceCount++] = optarg;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    setupTerminal();
+
+    // Set up logger
+    deviceManager.setLogger(&logger);
+
+    // Register device factories
+    deviceManager.registerFactory(&ft991aFactory);
+    deviceManager.registerFactory(&ftdx10Factory);
+    deviceManager.registerFactory(&ts590Factory);
+    deviceManager.registerFactory(&ts2000Factory);
+    deviceManager.registerFactory(&k3Factory);
+    deviceManager.registerFactory(&g5500Factory);
+    deviceManager.registerFactory(&nmeaGpsFactory);
+    deviceManager.registerFactory(&ic7300Factory);
+    deviceManager.registerFactory(&ic9700Factory);
+
+    // Initialize configuration storage
+    EEPROM.setBackingFile(eepromFile);
+    ConfigStorage::begin();
+    ConfigStorage::setLogger(&logger);
+
+    // Devices from the command line replace the saved configuration
+    if (cliDeviceCount > 0) {
+        for (size_t i = 0; i < cliDeviceCount; i++) {
+            if (!createFromArg(cliDevices[i])) {
+                fprintf(stderr, "Failed to create device '%s'\r\n", cliDevices[i]);
+                return 1;
+            }
+        }
+    } else if (ConfigStorage::load(deviceManager) > 0) {
+        // Start all restored devices
+        for (uint8_t i = 0; i < MAX_DEVICES; i++) {
+            IEmulatedDevice* dev = deviceManager.getDevice(i);
+            if (dev != nullptr && !dev->isRunning()) {
+                dev->begin();
+            }
+        }
+    }
+
+    // Tell the user where to point client software
+    for (uint8_t i = 0; i < MAX_DEVICES; i++) {
+        IEmulatedDevice* dev = deviceManager.getDevice(i);
+        if (dev != nullptr) {
+            printf("Device %d (%s): %s", dev->getDeviceId(), dev->getName(),
+                   deviceManager.getUartDescription(dev->getUartIndex()));
+            for (size_t p = 1; p < dev->getPortCount(); p++) {
+                printf(", %s", deviceManager.getUartDescription(dev->getPortUart(p)));
+            }
+            printf("\r\n");
+        }
+    }
+    for (size_t i = 0; i < rigctlCount; i++) {
+        printf("Device %d rigctld: %s\r\n", rigctlServers[i]->getDeviceId(),
+               rigctlServers[i]->getAddress());
+    }
+    fflush(stdout);
+
+    // Create console
+    HostEventLoop::addFd(STDIN_FILENO);
+    console = new Console(Serial, deviceManager, logger);
+    console->begin();
+
+    while (running) {
+        // Process console input
+        console->update();
+
+        // Answer rigctld clients; their sets reach CAT clients below
+        for (size_t i = 0; i < rigctlCount; i++) {
+            rigctlServers[i]->service();
+        }
+
+        // Update all running devices
+        deviceManager.updateAll();
+
+        // Stop watching stdin once it is closed (e.g., running under a CI job)
+        if (Serial.atEof()) {
+            HostEventLoop::removeFd(STDIN_FILENO);
+        }
+
+        // Sleep until a port has input, a paced byte or delayed reply is
+        // due, or the tick expires
+        uint32_t timeoutUs = deviceManager.getNextEventUs();
+        if (timeoutUs > HOST_LOOP_TICK_US) {
+            timeoutUs = HOST_LOOP_TICK_US;
+        }
+        HostEventLoop::wait(timeoutUs);
+    }
+
+    printf("\r\nShutting down\r\n");
+    for (size_t i = 0; i < rigctlCount; i++) {
+        delete rigctlServers[i];
+    }
+    delete console;
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "HostSocket.h"
+#include "HostEventLoop.h"
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+int HostSocket::listen(const char* address, char* name, size_t nameLen) {
+    if (nameLen > 0) {
+        name[0] = '\0';
+    }
+    if (address == nullptr) {
+        return -1;
+    }
+
+    int fd = -1;
+    if (strncmp(address, "tcp:", 4) == 0) {
+        fd = listenTcp(address + 4, name, nameLen);
+    } else if (strncmp(address, "unix:", 5) == 0) {
+        fd = listenUnix(address + 5, name, nameLen);
+    }
+    if (fd >= 0) {
+        HostEventLoop::addFd(fd);
+    }
+    return fd;
+}
+
+int HostSocket::listenTcp(const char* spec, char* name, size_t nameLen) {
+    // Split "[host:]port" at the last colon; "[::1]:port" is accepted for IPv6
+    char host[64];
+    const char* port = spec;
+    strcpy(host, "127.0.0.1");
+
+    const char* colon = strrchr(spec, ':');
+    if (colon != nullptr) {
+        const char* start = spec;
+        size_t len = colon - spec;
+        if (len >= 2 && start[0] == '[' && start[len - 1] == ']') {
+            start++;
+            len -= 2;
+        }
+        if (len == 0 || len >= sizeof(host)) {
+            return -1;
+        }
+        memcpy(host, start, len);
+        host[len] = '\0';
+        port = colon + 1;
+    }
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+
+    struct addrinfo* res = nullptr;
+    if (getaddrinfo(host, port, &hints, &res) != 0 || res == nullptr) {
+        return -1;
+    }
+
+    int fd = socket(res->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd >= 0) {
+        // Allow an immediate restart while old connections sit in TIME_WAIT
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, res->ai_addr, res->ai_addrlen) != 0 || ::listen(fd, 16) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (strchr(host, ':') != nullptr) {
+        snprintf(name, nameLen, "tcp:[%s]:%s", host, port);
+    } else {
+        snprintf(name, nameLen, "tcp:%s:%s", host, port);
+    }
+    return fd;
+}
+
+int HostSocket::listenUnix(const char* path, char* name, size_t nameLen) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path[0] == '\0' || strlen(path) >= sizeof(addr.sun_path) || strlen(path) + 5 >= nameLen) {
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    // Remove a socket left behind by a previous run, but nothing else: a
+    // mistyped path must not delete an ordinary file
+    struct stat st;
+    if (lstat(path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "'%s' exists and is not a socket\r\n", path);
+            return -1;
+        }
+        unlink(path);
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(fd, 16) != 0) {
+        ::close(fd);
+        return -1;
+    }
+
+    snprintf(name, nameLen, "unix:%s", path);
+    return fd;
+}
+
+int HostSocket::accept(int listenFd, bool isTcp) {
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd >= 0 && isTcp) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+void HostSocket::close(int listenFd, const char* name) {
+    if (listenFd < 0) {
+        return;
+    }
+    HostEventLoop::removeFd(listenFd);
+    ::close(listenFd);
+    if (name != nullptr && strncmp(name, "unix:", 5) == 0) {
+        unlink(name + 5);
+    }
+}
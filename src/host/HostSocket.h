@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// Listening sockets for the Linux host build
+// Shared by the socket serial backend and the network front-ends. The
+// address is "tcp:PORT", "tcp:HOST:PORT" or "unix:PATH"; TCP listens on
+// 127.0.0.1 unless a host is given. Sockets are non-blocking and
+// registered with HostEventLoop.
+class HostSocket {
+public:
+    // Open a listening socket, returns its fd or -1
+    // name receives the address in canonical form ("tcp:127.0.0.1:4532",
+    // "unix:/tmp/rig.sock"); a unix socket path is name + 5
+    static int listen(const char* address, char* name, size_t nameLen);
+
+    // Accept one pending connection (non-blocking), returns its fd or -1
+    // TCP connections get TCP_NODELAY: replies are small and
+    // latency-sensitive, and callers batch their own writes
+    static int accept(int listenFd, bool isTcp);
+
+    // Stop listening; a unix socket's path is removed
+    static void close(int listenFd, const char* name);
+
+private:
+    static int listenTcp(const char* spec, char* name, size_t nameLen);
+    static int listenUnix(const char* path, char* name, size_t nameLen);
+};
@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "PtySerialPort.h"
+#include "HostEventLoop.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+PtySerialPort::PtySerialPort()
+    : _masterFd(-1)
+    , _slaveFd(-1)
+    , _isOpen(false)
+    , _rxHead(0)
+    , _rxLen(0)
+{
+    _slavePath[0] = '\0';
+    openPty();
+}
+
+PtySerialPort::~PtySerialPort() {
+    closePty();
+}
+
+bool PtySerialPort::openPty() {
+    _masterFd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (_masterFd < 0) {
+        return false;
+    }
+
+    if (grantpt(_masterFd) != 0 || unlockpt(_masterFd) != 0 ||
+        ptsname_r(_masterFd, _slavePath, sizeof(_slavePath)) != 0) {
+        closePty();
+        return false;
+    }
+
+    // Keep one slave handle open ourselves: without it the master reports
+    // hangup (and poll() spins) whenever no client has the port open
+    _slaveFd = ::open(_slavePath, O_RDWR | O_NOCTTY);
+    if (_slaveFd < 0) {
+        closePty();
+        return false;
+    }
+
+    // Raw line discipline: no echo, no CR/LF translation, byte-at-a-time
+    struct termios tio;
+    if (tcgetattr(_slaveFd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(_slaveFd, TCSANOW, &tio);
+    }
+
+    HostEventLoop::addFd(_masterFd);
+    return true;
+}
+
+void PtySerialPort::closePty() {
+    if (_masterFd >= 0) {
+        HostEventLoop::removeFd(_masterFd);
+        ::close(_masterFd);
+        _masterFd = -1;
+    }
+    if (_slaveFd >= 0) {
+        ::close(_slaveFd);
+        _slaveFd = -1;
+    }
+    _isOpen = false;
+}
+
+void PtySerialPort::begin(uint32_t baud, uint32_t config) {
+    (void)config;
+
+    if (_masterFd < 0) {
+        return;
+    }
+
+    // The pty passes bytes at memory speed, but report the configured rate
+    // to clients that query it (stty, tcgetattr)
+    struct termios tio;
+    if (tcgetattr(_slaveFd, &tio) == 0) {
+        speed_t speed = B38400;
+        switch (baud) {
+            case 1200: speed = B1200; break;
+            case 2400: speed = B2400; break;
+            case 4800: speed = B4800; break;
+            case 9600: speed = B9600; break;
+            case 19200: speed = B19200; break;
+            case 38400: speed = B38400; break;
+            case 57600: speed = B57600; break;
+            case 115200: speed = B115200; break;
+            default: break;
+        }
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        tcsetattr(_slaveFd, TCSANOW, &tio);
+    }
+
+    _rxHead = 0;
+    _rxLen = 0;
+    _isOpen = true;
+}
+
+void PtySerialPort::end() {
+    _isOpen = false;
+    _rxHead = 0;
+    _rxLen = 0;
+}
+
+void PtySerialPort::fill() {
+    if (_rxHead < _rxLen || !_isOpen) {
+        return;
+    }
+
+    ssize_t n = ::read(_masterFd, _rxBuf, sizeof(_rxBuf));
+    _rxHead = 0;
+    _rxLen = (n > 0) ? (size_t)n : 0;
+}
+
+int PtySerialPort::available() {
+    fill();
+    return (int)(_rxLen - _rxHead);
+}
+
+int PtySerialPort::read() {
+    fill();
+    if (_rxHead >= _rxLen) {
+        return -1;
+    }
+    return _rxBuf[_rxHead++];
+}
+
+size_t PtySerialPort::readBytes(uint8_t* buffer, size_t length) {
+    return readAvailable(buffer, length);
+}
+
+size_t PtySerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    if (!_isOpen || length == 0) {
+        return 0;
+    }
+
+    // Hand out read-ahead bytes first
+    size_t count = _rxLen - _rxHead;
+    if (count > length) {
+        count = length;
+    }
+    memcpy(buffer, &_rxBuf[_rxHead], count);
+    _rxHead += count;
+
+    if (count < length) {
+        ssize_t n = ::read(_masterFd, buffer + count, length - count);
+        if (n > 0) {
+            count += (size_t)n;
+        }
+    }
+    return count;
+}
+
+int PtySerialPort::availableForWrite() {
+    return _isOpen ? PTY_WRITE_CHUNK : 0;
+}
+
+size_t PtySerialPort::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t PtySerialPort::write(const uint8_t* buffer, size_t size) {
+    if (!_isOpen) {
+        return 0;
+    }
+
+    ssize_t n = ::write(_masterFd, buffer, size);
+    if (n < 0) {
+        // EAGAIN: the client is not reading and the pty buffer is full
+        return 0;
+    }
+    return (size_t)n;
+}
+
+size_t PtySerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t PtySerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+void PtySerialPort::flush() {
+    // Nothing to wait for: write() hands bytes straight to the kernel
+}
+
+bool PtySerialPort::isOpen() const {
+    return _isOpen;
+}
+
+const char* PtySerialPort::getPortName() const {
+    return _slavePath;
+}
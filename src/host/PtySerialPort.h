@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+
+// Bytes reported by availableForWrite() while the port is open
+// The master fd is non-blocking, so a write never stalls; the kernel simply
+// accepts fewer bytes when the client is not reading
+#define PTY_WRITE_CHUNK 4096
+
+// Serial port backed by a Linux pseudo-terminal
+// The pty is created when the port is constructed and stays open until the
+// port is destroyed, so the /dev/pts/N path is stable across device
+// stop/start. Client software opens the slave path like a real serial port.
+class PtySerialPort : public ISerialPort {
+public:
+    PtySerialPort();
+    ~PtySerialPort() override;
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void flush() override;
+    void service() override {}
+    bool isOpen() const override;
+    const char* getPortName() const override;
+
+    // True if the pseudo-terminal was created successfully
+    bool isValid() const { return _masterFd >= 0; }
+
+private:
+    int _masterFd;
+    int _slaveFd;    // Held open so the master never sees hangup between clients
+    bool _isOpen;
+    char _slavePath[32];
+
+    // Small read-ahead buffer so available() does not need a syscall per call
+    uint8_t _rxBuf[256];
+    size_t _rxHead;
+    size_t _rxLen;
+
+    bool openPty();
+    void closePty();
+    void fill();
+};
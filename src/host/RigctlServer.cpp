@@ -0,0 +1,598 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "RigctlServer.h"
+#include "HostEventLoop.h"
+#include "HostSocket.h"
+#include "DeviceManager.h"
+#include "core/FixedWriter.h"
+#include "devices/yaesu/YaesuDevice.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Hamlib status codes (RIG_E*), sent negated as "RPRT -n"
+#define RIG_OK 0
+#define RIG_EINVAL 1     // Invalid parameter
+#define RIG_EIO 6        // The radio is not there
+#define RIG_ENAVAIL 11   // Command not available
+
+// Bytes read from a connection at a time
+#define RIGCTL_READ_CHUNK 512
+
+// Longest reply to one request (\dump_state)
+#define RIGCTL_REPLY_SIZE 1024
+
+// Hamlib mode names, RIG_MODE_* bits and default passbands (Hz) for each
+// CAT mode; a model offers the rows of the modes it has (see hasMode())
+// The narrow FM and AM modes are their wide mode with a narrower passband.
+// Hamlib's mode masks are 64 bits wide: C4FM is bit 33 (bit 31 is PSKR).
+struct RigctlMode {
+    YaesuMode mode;
+    const char* name;
+    uint64_t bit;
+    uint16_t passband;
+};
+
+static const RigctlMode RIGCTL_MODES[] = {
+    {YaesuMode::MODE_LSB,      "LSB",    0x8,        2400},
+    {YaesuMode::MODE_USB,      "USB",    0x4,        2400},
+    {YaesuMode::MODE_CW_U,     "CW",     0x2,        500},
+    {YaesuMode::MODE_FM,       "FM",     0x20,       12000},
+    {YaesuMode::MODE_FM_N,     "FM",     0x20,       9000},
+    {YaesuMode::MODE_AM,       "AM",     0x1,        6000},
+    {YaesuMode::MODE_AM_N,     "AM",     0x1,        3000},
+    {YaesuMode::MODE_RTTY_LSB, "RTTY",   0x10,       500},
+    {YaesuMode::MODE_CW_L,     "CWR",    0x80,       500},
+    {YaesuMode::MODE_DATA_LSB, "PKTLSB", 0x400,      2400},
+    {YaesuMode::MODE_RTTY_USB, "RTTYR",  0x100,      500},
+    {YaesuMode::MODE_DATA_FM,  "PKTFM",  0x1000,     12000},
+    {YaesuMode::MODE_DATA_USB, "PKTUSB", 0x800,      2400},
+    {YaesuMode::MODE_C4FM,     "C4FM",   1ULL << 33, 12000},
+};
+
+#define RIGCTL_MODE_COUNT (sizeof(RIGCTL_MODES) / sizeof(RIGCTL_MODES[0]))
+
+// S-meter reading (SM0, 0-255) to dB over S9, Hamlib's FT-991 calibration
+struct RigctlCal {
+    uint8_t raw;
+    int8_t db;
+};
+
+static const RigctlCal RIGCTL_STRENGTH_CAL[] = {
+    {0, -54}, {12, -48}, {27, -42}, {40, -36}, {55, -30}, {65, -24},
+    {80, -18}, {95, -12}, {112, -6}, {130, 0}, {150, 10}, {172, 20},
+    {190, 30}, {220, 40}, {240, 50}, {255, 60},
+};
+
+#define RIGCTL_CAL_COUNT (sizeof(RIGCTL_STRENGTH_CAL) / sizeof(RIGCTL_STRENGTH_CAL[0]))
+
+// Capabilities for \dump_state (rigctld protocol 1), which the NET rigctl
+// backend reads when it connects: the protocol version and model number,
+// the model's ranges, tuning steps and filters (from its coverage and
+// modes), then what every model shares. Levels: AF, RF, SQL, RFPOWER and
+// STRENGTH.
+static const char RIGCTL_DUMP_STATE_TAIL[] =
+    "9999\n"
+    "9999\n"
+    "1200\n"
+    "0\n"
+    "10 20 0\n"
+    "12 0\n"
+    "0x0\n"
+    "0x0\n"
+    "0x40001038\n"
+    "0x0\n"
+    "0x0\n"
+    "0x0\n"
+    "vfo_ops=0x0\n"
+    "ptt_type=0x1\n"
+    "targetable_vfo=0x0\n"
+    "has_set_vfo=1\n"
+    "has_get_vfo=1\n"
+    "has_set_freq=1\n"
+    "has_get_freq=1\n"
+    "timeout=0\n"
+    "rig_model=";
+
+// Transmit power of every model (mW)
+#define RIGCTL_MIN_POWER 5000
+#define RIGCTL_MAX_POWER 100000
+
+const RigctlServer::Command RigctlServer::COMMANDS[] = {
+    {'f', "get_freq",      true,  &RigctlServer::getFreq},
+    {'F', "set_freq",      true,  &RigctlServer::setFreq},
+    {'m', "get_mode",      true,  &RigctlServer::getMode},
+    {'M', "set_mode",      true,  &RigctlServer::setMode},
+    {'t', "get_ptt",       true,  &RigctlServer::getPtt},
+    {'T', "set_ptt",       true,  &RigctlServer::setPtt},
+    {'v', "get_vfo",       true,  &RigctlServer::getVfo},
+    {'V', "set_vfo",       true,  &RigctlServer::setVfo},
+    {'l', "get_level",     true,  &RigctlServer::getLevel},
+    {0,   "get_powerstat", true,  &RigctlServer::getPowerstat},
+    {0,   "chk_vfo",       false, &RigctlServer::checkVfo},
+    {0,   "dump_state",    false, &RigctlServer::dumpState},
+};
+
+#define RIGCTL_COMMAND_COUNT (sizeof(COMMANDS) / sizeof(COMMANDS[0]))
+
+// Hexadecimal mask ("0x%llx")
+static void putMask(FixedWriter& out, uint64_t mask) {
+    char digits[16];
+    uint8_t n = 0;
+    do {
+        digits[n++] = "0123456789abcdef"[mask & 0xF];
+        mask >>= 4;
+    } while (mask != 0);
+    out.put("0x");
+    while (n > 0) {
+        out.put(digits[--n]);
+    }
+}
+
+// True if the model has a mode of its own: CAT sets take the first mode
+// with a code, so a mode the radio lacks (read as the nearest it has)
+// shares its code with an earlier one
+static bool hasMode(const CATModel& model, YaesuMode mode) {
+    uint8_t m = (uint8_t)mode;
+    for (uint8_t i = 1; i < m; i++) {
+        if (model.modes[i] == model.modes[m]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Signed decimal ("%d")
+static void putInt(FixedWriter& out, int32_t value) {
+    if (value < 0) {
+        out.put('-');
+        out.number((uint32_t)0 - (uint32_t)value);
+    } else {
+        out.number((uint32_t)value);
+    }
+}
+
+static const char* skipSpaces(const char* text) {
+    while (*text == ' ' || *text == '\t') {
+        text++;
+    }
+    return text;
+}
+
+RigctlServer::RigctlServer(DeviceManager& manager, uint8_t deviceId, const char* address)
+    : _manager(manager)
+    , _deviceId(deviceId)
+    , _listenFd(-1)
+    , _isTcp(false)
+    , _clientCount(0)
+    , _requests(0)
+    , _state(nullptr)
+    , _model(nullptr)
+{
+    _listenFd = HostSocket::listen(address, _name, sizeof(_name));
+    _isTcp = strncmp(_name, "tcp:", 4) == 0;
+}
+
+RigctlServer::~RigctlServer() {
+    while (_clientCount > 0) {
+        dropClient(_clientCount - 1);
+    }
+    HostSocket::close(_listenFd, _name);
+}
+
+void RigctlServer::service() {
+    if (_listenFd < 0) {
+        return;
+    }
+
+    if (HostEventLoop::isReadable(_listenFd)) {
+        acceptClients();
+    }
+
+    // Backwards, so a dropped client's slot is refilled from one already seen
+    for (size_t i = _clientCount; i-- > 0;) {
+        Client& client = _clients[i];
+        if (HostEventLoop::isReadable(client.fd) && !client.closing) {
+            readClient(client);
+        }
+        sendReplies(client);
+        if (client.fd < 0 || (client.closing && client.txLen == 0)) {
+            dropClient(i);
+        }
+    }
+}
+
+void RigctlServer::acceptClients() {
+    while (true) {
+        int fd = HostSocket::accept(_listenFd, _isTcp);
+        if (fd < 0) {
+            return;
+        }
+        if (_clientCount >= RIGCTL_MAX_CLIENTS || !HostEventLoop::addFd(fd)) {
+            ::close(fd);
+            continue;
+        }
+
+        Client& client = _clients[_clientCount++];
+        client.fd = fd;
+        client.lineLen = 0;
+        client.lineTooLong = false;
+        client.closing = false;
+        client.txLen = 0;
+    }
+}
+
+void RigctlServer::dropClient(size_t index) {
+    Client& client = _clients[index];
+    if (client.fd >= 0) {
+        HostEventLoop::removeFd(client.fd);
+        ::close(client.fd);
+    }
+    _clientCount--;
+    if (index != _clientCount) {
+        memcpy(&_clients[index], &_clients[_clientCount], sizeof(Client));
+    }
+}
+
+// Every complete line in the input is answered before anything is sent,
+// so a client that pipelines requests gets its replies in one write
+void RigctlServer::readClient(Client& client) {
+    char chunk[RIGCTL_READ_CHUNK];
+    ssize_t n = recv(client.fd, chunk, sizeof(chunk), 0);
+    if (n <= 0) {
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            // Client hung up
+            HostEventLoop::removeFd(client.fd);
+            ::close(client.fd);
+            client.fd = -1;
+        }
+        return;
+    }
+
+    for (ssize_t i = 0; i < n && !client.closing; i++) {
+        char c = chunk[i];
+        if (c == '\n') {
+            client.line[client.lineLen] = '\0';
+            bool fits;
+            if (client.lineTooLong) {
+                char buf[16];
+                FixedWriter rsp(buf, sizeof(buf));
+                rsp.put("RPRT -");
+                rsp.number((uint8_t)RIG_EINVAL);
+                rsp.put('\n');
+                fits = client.txLen + rsp.length() <= RIGCTL_TX_SIZE;
+                if (fits) {
+                    memcpy(client.tx + client.txLen, rsp.c_str(), rsp.length());
+                    client.txLen += rsp.length();
+                }
+            } else {
+                fits = processLine(client, client.line);
+            }
+            client.lineLen = 0;
+            client.lineTooLong = false;
+
+            if (!fits) {
+                // Not reading its replies
+                HostEventLoop::removeFd(client.fd);
+                ::close(client.fd);
+                client.fd = -1;
+                return;
+            }
+        } else if (c != '\r') {
+            if (client.lineLen < RIGCTL_LINE_SIZE - 1) {
+                client.line[client.lineLen++] = c;
+            } else {
+                client.lineTooLong = true;
+            }
+        }
+    }
+}
+
+void RigctlServer::sendReplies(Client& client) {
+    if (client.fd < 0 || client.txLen == 0) {
+        return;
+    }
+    ssize_t n = send(client.fd, client.tx, client.txLen, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            HostEventLoop::removeFd(client.fd);
+            ::close(client.fd);
+            client.fd = -1;
+        }
+        return;  // Socket buffer full: try again next iteration
+    }
+    client.txLen -= (size_t)n;
+    if (client.txLen > 0) {
+        memmove(client.tx, client.tx + n, client.txLen);
+    }
+}
+
+YaesuState* RigctlServer::findRadio() {
+    _model = nullptr;
+    IEmulatedDevice* dev = _manager.getDevice(_deviceId);
+    if (dev == nullptr || findCATModel(dev->getName()) == nullptr) {
+        return nullptr;
+    }
+    YaesuDevice* radio = static_cast<YaesuDevice*>(dev);
+    _model = &radio->getModel();
+    return dev->isRunning() ? &radio->getState() : nullptr;
+}
+
+bool RigctlServer::processLine(Client& client, char* line) {
+    const char* text = skipSpaces(line);
+    if (*text == '\0') {
+        return true;
+    }
+    _requests++;
+
+    // "q" closes the connection once the replies so far are sent
+    if ((text[0] == 'q' || text[0] == 'Q') && (text[1] == '\0' || text[1] == ' ')) {
+        client.closing = true;
+        return true;
+    }
+
+    // Short form "f", "F 14074000"; long form "\get_freq", "\set_freq 14074000"
+    const Command* command = nullptr;
+    const char* args;
+    if (text[0] == '\\') {
+        const char* name = text + 1;
+        size_t len = strcspn(name, " \t");
+        for (size_t i = 0; i < RIGCTL_COMMAND_COUNT; i++) {
+            if (strlen(COMMANDS[i].longName) == len &&
+                strncmp(COMMANDS[i].longName, name, len) == 0) {
+                command = &COMMANDS[i];
+                break;
+            }
+        }
+        args = skipSpaces(name + len);
+    } else {
+        for (size_t i = 0; i < RIGCTL_COMMAND_COUNT; i++) {
+            if (COMMANDS[i].shortName == text[0]) {
+                command = &COMMANDS[i];
+                break;
+            }
+        }
+        args = skipSpaces(text + 1);
+    }
+
+    char buf[RIGCTL_REPLY_SIZE];
+    FixedWriter rsp(buf, sizeof(buf));
+    int status = -RIG_ENAVAIL;
+    if (command != nullptr) {
+        _state = findRadio();
+        if (command->needsRadio && _state == nullptr) {
+            status = -RIG_EIO;
+        } else {
+            status = (this->*command->handler)(args, rsp);
+        }
+        _state = nullptr;
+    }
+
+    // Sets and failures answer with their status only
+    if (status != RIG_OK || rsp.length() == 0) {
+        rsp.clear();
+        rsp.put("RPRT ");
+        putInt(rsp, status);
+        rsp.put('\n');
+    }
+
+    if (client.txLen + rsp.length() > RIGCTL_TX_SIZE) {
+        return false;
+    }
+    memcpy(client.tx + client.txLen, rsp.c_str(), rsp.length());
+    client.txLen += rsp.length();
+    return true;
+}
+
+// === Handlers ===
+
+// f: frequency of the current VFO (Hz)
+int RigctlServer::getFreq(const char* args, FixedWriter& out) {
+    out.number(_state->getCurrentFreq());
+    out.put('\n');
+    return RIG_OK;
+}
+
+// F <Hz>: Hamlib sends a float ("14074000.000000")
+// Written as "not in coverage" so NaN, which compares false, is refused
+int RigctlServer::setFreq(const char* args, FixedWriter& out) {
+    char* end;
+    double freq = strtod(args, &end);
+    if (end == args || !(freq >= _model->minHz && freq <= _model->maxHz)) {
+        return -RIG_EINVAL;
+    }
+    _state->setCurrentFreq((uint32_t)(freq + 0.5));
+    return RIG_OK;
+}
+
+// m: mode name and passband (Hz)
+int RigctlServer::getMode(const char* args, FixedWriter& out) {
+    YaesuMode mode = _state->getCurrentMode();
+    for (size_t i = 0; i < RIGCTL_MODE_COUNT; i++) {
+        if (RIGCTL_MODES[i].mode == mode) {
+            out.put(RIGCTL_MODES[i].name).put('\n');
+            out.number(RIGCTL_MODES[i].passband).put('\n');
+            return RIG_OK;
+        }
+    }
+    return -RIG_EIO;
+}
+
+// M <mode> [passband]: a passband narrower than the mode's default picks
+// the narrow FM or AM mode; 0 or -1 keeps the current width
+int RigctlServer::setMode(const char* args, FixedWriter& out) {
+    size_t len = strcspn(args, " \t");
+    long passband = atol(skipSpaces(args + len));
+    YaesuMode current = _state->getCurrentMode();
+
+    const RigctlMode* chosen = nullptr;
+    for (size_t i = 0; i < RIGCTL_MODE_COUNT; i++) {
+        const RigctlMode& row = RIGCTL_MODES[i];
+        if (strlen(row.name) != len || strncasecmp(row.name, args, len) != 0 ||
+            !hasMode(*_model, row.mode)) {
+            continue;
+        }
+        if (passband <= 0) {
+            // Keep the current width if the mode is not changing
+            if (chosen == nullptr || row.mode == current) {
+                chosen = &row;
+            }
+        } else if (chosen == nullptr || row.passband >= passband) {
+            // Rows of a mode go from wide to narrow: the narrowest that
+            // still passes the requested width
+            chosen = &row;
+        }
+    }
+    if (chosen == nullptr) {
+        return -RIG_EINVAL;
+    }
+
+    _state->setCurrentMode(chosen->mode);
+    return RIG_OK;
+}
+
+// t: PTT
+int RigctlServer::getPtt(const char* args, FixedWriter& out) {
+    out.put(_state->ptt ? '1' : '0').put('\n');
+    return RIG_OK;
+}
+
+// T <0|1|2|3>: off, on, on (mic), on (data)
+int RigctlServer::setPtt(const char* args, FixedWriter& out) {
+    if (*args < '0' || *args > '3') {
+        return -RIG_EINVAL;
+    }
+    _state->set(_state->ptt, *args != '0', CHANGED_PTT);
+    return RIG_OK;
+}
+
+// v: current VFO
+int RigctlServer::getVfo(const char* args, FixedWriter& out) {
+    out.put(_state->currentVfo == YaesuVFO::VFO_A ? "VFOA\n" : "VFOB\n");
+    return RIG_OK;
+}
+
+// V <VFOA|VFOB|currVFO>
+int RigctlServer::setVfo(const char* args, FixedWriter& out) {
+    if (strcasecmp(args, "VFOA") == 0 || strcasecmp(args, "Main") == 0) {
+        _state->set(_state->currentVfo, YaesuVFO::VFO_A, CHANGED_VFO);
+    } else if (strcasecmp(args, "VFOB") == 0 || strcasecmp(args, "Sub") == 0) {
+        _state->set(_state->currentVfo, YaesuVFO::VFO_B, CHANGED_VFO);
+    } else if (strcasecmp(args, "currVFO") != 0) {
+        return -RIG_EINVAL;
+    }
+    return RIG_OK;
+}
+
+// l <level>: STRENGTH in dB over S9, the others as 0.0-1.0
+int RigctlServer::getLevel(const char* args, FixedWriter& out) {
+    if (strcasecmp(args, "STRENGTH") == 0) {
+        // Interpolate the calibration table
+        uint8_t raw = _state->smeter;
+        int32_t db = RIGCTL_STRENGTH_CAL[RIGCTL_CAL_COUNT - 1].db;
+        for (size_t i = 1; i < RIGCTL_CAL_COUNT; i++) {
+            const RigctlCal& lo = RIGCTL_STRENGTH_CAL[i - 1];
+            const RigctlCal& hi = RIGCTL_STRENGTH_CAL[i];
+            if (raw <= hi.raw) {
+                db = lo.db + ((int32_t)(raw - lo.raw) * (hi.db - lo.db)) / (hi.raw - lo.raw);
+                break;
+            }
+        }
+        putInt(out, db);
+    } else if (strcasecmp(args, "RFPOWER") == 0) {
+        out.fixed<6>(_state->txPower / 100.0);
+    } else if (strcasecmp(args, "AF") == 0) {
+        out.fixed<6>(_state->afGain / 255.0);
+    } else if (strcasecmp(args, "RF") == 0) {
+        out.fixed<6>(_state->rfGain / 255.0);
+    } else if (strcasecmp(args, "SQL") == 0) {
+        out.fixed<6>(_state->squelch / 100.0);
+    } else {
+        return -RIG_ENAVAIL;
+    }
+    out.put('\n');
+    return RIG_OK;
+}
+
+// \get_powerstat
+int RigctlServer::getPowerstat(const char* args, FixedWriter& out) {
+    out.put(_state->powerOn ? '1' : '0').put('\n');
+    return RIG_OK;
+}
+
+// \chk_vfo: 0, requests carry no VFO argument
+int RigctlServer::checkVfo(const char* args, FixedWriter& out) {
+    out.put("0\n");
+    return RIG_OK;
+}
+
+// \dump_state: capabilities, read by the NET rigctl backend on connect
+// The radio may be stopped, but it has to exist for its model
+int RigctlServer::dumpState(const char* args, FixedWriter& out) {
+    if (_model == nullptr) {
+        return -RIG_EIO;
+    }
+
+    uint64_t modes = 0;
+    for (size_t i = 0; i < RIGCTL_MODE_COUNT; i++) {
+        if (hasMode(*_model, RIGCTL_MODES[i].mode)) {
+            modes |= RIGCTL_MODES[i].bit;
+        }
+    }
+
+    out.put("1\n");
+    out.number(_model->rigModel).put('\n');
+    out.put("0\n");
+
+    // Receive, then transmit: the emulator tunes and keys anywhere in the
+    // model's coverage, so each list is that one range
+    for (uint8_t tx = 0; tx < 2; tx++) {
+        out.number(_model->minHz).put(".000000 ");
+        out.number(_model->maxHz).put(".000000 ");
+        putMask(out, modes);
+        if (tx) {
+            out.put(' ').number((uint32_t)RIGCTL_MIN_POWER);
+            out.put(' ').number((uint32_t)RIGCTL_MAX_POWER);
+        } else {
+            out.put(" -1 -1");
+        }
+        out.put(" 0x3 0x1\n");
+        out.put("0 0 0 0 0 0 0\n");
+    }
+
+    // Tuning steps
+    putMask(out, modes);
+    out.put(" 10\n0 0\n");
+
+    // Filters: the modes of each passband, the first listed for a mode
+    // being its default (rows go from wide to narrow)
+    for (size_t i = 0; i < RIGCTL_MODE_COUNT; i++) {
+        const RigctlMode& row = RIGCTL_MODES[i];
+        if (!hasMode(*_model, row.mode)) {
+            continue;
+        }
+        bool listed = false;
+        for (size_t j = 0; j < i && !listed; j++) {
+            listed = RIGCTL_MODES[j].passband == row.passband && hasMode(*_model, RIGCTL_MODES[j].mode);
+        }
+        if (listed) {
+            continue;
+        }
+        uint64_t mask = 0;
+        for (size_t j = i; j < RIGCTL_MODE_COUNT; j++) {
+            if (RIGCTL_MODES[j].passband == row.passband && hasMode(*_model, RIGCTL_MODES[j].mode)) {
+                mask |= RIGCTL_MODES[j].bit;
+            }
+        }
+        putMask(out, mask);
+        out.put(' ').number(row.passband).put('\n');
+    }
+    out.put("0 0\n");
+
+    out.put(RIGCTL_DUMP_STATE_TAIL, sizeof(RIGCTL_DUMP_STATE_TAIL) - 1);
+    out.number(_model->rigModel).put("\ndone\n");
+    return out.overflowed() ? -RIG_EIO : RIG_OK;
+}
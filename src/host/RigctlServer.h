@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+class DeviceManager;
+class FixedWriter;
+struct YaesuState;
+struct CATModel;
+
+// Connections served at once by one server
+#define RIGCTL_MAX_CLIENTS 32
+
+// Longest request line; longer lines are answered with an error
+#define RIGCTL_LINE_SIZE 128
+
+// Replies waiting to be sent to one client; a client that lets this fill
+// up is not reading its replies and is disconnected
+#define RIGCTL_TX_SIZE 2048
+
+// Hamlib rigctld front-end for a CAT radio (FT-991A, TS-590, ...; host build)
+// Serves the rigctld TCP protocol that station software speaks to Hamlib's
+// NET rigctl backend (model 2), so clients can use the emulated radio
+// without a serial port. Requests are answered straight from the device's
+// YaesuState: nothing goes through a CATParser or a UART, so any number of
+// clients can poll while the CAT ports run at full speed. Sets go through
+// YaesuState::set(), so CAT clients in AI mode see them.
+//
+// The listening socket and every connection are registered with
+// HostEventLoop; service() only reads connections that poll() reported,
+// answers every complete line, and sends each client its replies in one
+// write. The device is looked up by id on every request, so it can be
+// deleted and recreated from the console while clients stay connected.
+//
+// Supported: f F m M t T v V l (STRENGTH, RFPOWER, AF, RF, SQL),
+// \get_powerstat, \chk_vfo, \dump_state and q, in short or long form.
+// Anything else is answered "RPRT -11" (not available). \dump_state and
+// M follow the radio's CATModel: its Hamlib model number, coverage and
+// modes.
+class RigctlServer {
+public:
+    // Serve device deviceId on address ("tcp:4532", see HostSocket)
+    RigctlServer(DeviceManager& manager, uint8_t deviceId, const char* address);
+    ~RigctlServer();
+
+    // True if the listening socket was created successfully
+    bool isValid() const { return _listenFd >= 0; }
+
+    // Address in canonical form, for the startup banner
+    const char* getAddress() const { return _name; }
+
+    uint8_t getDeviceId() const { return _deviceId; }
+
+    // Accept connections and answer requests; call once per loop
+    void service();
+
+    size_t getClientCount() const { return _clientCount; }
+    uint32_t getRequests() const { return _requests; }
+
+private:
+    struct Client {
+        int fd;
+        char line[RIGCTL_LINE_SIZE];
+        size_t lineLen;
+        bool lineTooLong;        // Discarding the rest of an overlong line
+        bool closing;            // Sent 'q': close once replies are out
+        char tx[RIGCTL_TX_SIZE];
+        size_t txLen;
+    };
+
+    // A request handler formats its reply into out and returns a Hamlib
+    // status: 0, or a negative RIG_E* code sent as "RPRT n" instead of the
+    // reply. A handler that writes nothing is answered "RPRT 0".
+    typedef int (RigctlServer::*Handler)(const char* args, FixedWriter& out);
+
+    struct Command {
+        char shortName;          // 0 if only the long form exists
+        const char* longName;    // Without the backslash
+        bool needsRadio;         // Fails with RIG_EIO while the radio is gone
+        Handler handler;
+    };
+
+    static const Command COMMANDS[];
+
+    DeviceManager& _manager;
+    uint8_t _deviceId;
+    int _listenFd;
+    bool _isTcp;
+    char _name[112];
+    Client _clients[RIGCTL_MAX_CLIENTS];
+    size_t _clientCount;
+    uint32_t _requests;
+    YaesuState* _state;          // The radio for the request being answered
+    const CATModel* _model;      // Its model, also while it is stopped
+
+    void acceptClients();
+    void readClient(Client& client);
+    void sendReplies(Client& client);
+    void dropClient(size_t index);
+
+    // Answer one request line into the client's reply buffer
+    // Returns false if the reply did not fit
+    bool processLine(Client& client, char* line);
+
+    // The CAT radio for the request being answered, or nullptr
+    YaesuState* findRadio();
+
+    // Handlers
+    int getFreq(const char* args, FixedWriter& out);
+    int setFreq(const char* args, FixedWriter& out);
+    int getMode(const char* args, FixedWriter& out);
+    int setMode(const char* args, FixedWriter& out);
+    int getPtt(const char* args, FixedWriter& out);
+    int setPtt(const char* args, FixedWriter& out);
+    int getVfo(const char* args, FixedWriter& out);
+    int setVfo(const char* args, FixedWriter& out);
+    int getLevel(const char* args, FixedWriter& out);
+    int getPowerstat(const char* args, FixedWriter& out);
+    int checkVfo(const char* args, FixedWriter& out);
+    int dumpState(const char* args, FixedWriter& out);
+
+    // Not copyable
+    RigctlServer(const RigctlServer&);
+    RigctlServer& operator=(const RigctlServer&);
+};
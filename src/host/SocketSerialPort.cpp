@@ -0,0 +1,209 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include "SocketSerialPort.h"
+#include "HostEventLoop.h"
+#include "HostSocket.h"
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+SocketSerialPort::SocketSerialPort(const char* address)
+    : _listenFd(-1)
+    , _clientFd(-1)
+    , _isTcp(false)
+    , _isOpen(false)
+    , _rxHead(0)
+    , _rxLen(0)
+    , _txBatch(SOCKET_TX_BATCH_SIZE)
+{
+    _listenFd = HostSocket::listen(address, _name, sizeof(_name));
+    _isTcp = strncmp(_name, "tcp:", 4) == 0;
+}
+
+SocketSerialPort::~SocketSerialPort() {
+    dropClient();
+    HostSocket::close(_listenFd, _name);
+    _listenFd = -1;
+}
+
+void SocketSerialPort::acceptClient() {
+    while (true) {
+        int fd = HostSocket::accept(_listenFd, _isTcp);
+        if (fd < 0) {
+            return;
+        }
+
+        // Only one client can be attached to a serial line
+        if (_clientFd >= 0) {
+            ::close(fd);
+            continue;
+        }
+
+        _clientFd = fd;
+        _rxHead = 0;
+        _rxLen = 0;
+        _txBatch.clear();
+        HostEventLoop::addFd(_clientFd);
+    }
+}
+
+void SocketSerialPort::dropClient() {
+    if (_clientFd >= 0) {
+        HostEventLoop::removeFd(_clientFd);
+        ::close(_clientFd);
+        _clientFd = -1;
+    }
+    _rxHead = 0;
+    _rxLen = 0;
+    _txBatch.clear();
+}
+
+void SocketSerialPort::begin(uint32_t baud, uint32_t config) {
+    // A socket has no line settings
+    (void)baud;
+    (void)config;
+
+    _rxHead = 0;
+    _rxLen = 0;
+    _isOpen = _listenFd >= 0;
+}
+
+void SocketSerialPort::end() {
+    _isOpen = false;
+    _rxHead = 0;
+    _rxLen = 0;
+    _txBatch.clear();
+}
+
+void SocketSerialPort::fill() {
+    if (_rxHead < _rxLen || _clientFd < 0) {
+        return;
+    }
+
+    _rxHead = 0;
+    _rxLen = 0;
+    ssize_t n = recv(_clientFd, _rxBuf, sizeof(_rxBuf), 0);
+    if (n > 0) {
+        _rxLen = (size_t)n;
+    } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        // Client hung up
+        dropClient();
+    }
+}
+
+int SocketSerialPort::available() {
+    if (!_isOpen) {
+        return 0;
+    }
+    fill();
+    return (int)(_rxLen - _rxHead);
+}
+
+int SocketSerialPort::read() {
+    if (!_isOpen) {
+        return -1;
+    }
+    fill();
+    if (_rxHead >= _rxLen) {
+        return -1;
+    }
+    return _rxBuf[_rxHead++];
+}
+
+size_t SocketSerialPort::readBytes(uint8_t* buffer, size_t length) {
+    return readAvailable(buffer, length);
+}
+
+size_t SocketSerialPort::readAvailable(uint8_t* buffer, size_t length) {
+    if (!_isOpen || length == 0) {
+        return 0;
+    }
+
+    // Hand out read-ahead bytes first
+    size_t count = _rxLen - _rxHead;
+    if (count > length) {
+        count = length;
+    }
+    memcpy(buffer, &_rxBuf[_rxHead], count);
+    _rxHead += count;
+
+    if (count < length && _clientFd >= 0) {
+        ssize_t n = recv(_clientFd, buffer + count, length - count, 0);
+        if (n > 0) {
+            count += (size_t)n;
+        } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            dropClient();
+        }
+    }
+    return count;
+}
+
+int SocketSerialPort::availableForWrite() {
+    if (!_isOpen) {
+        return 0;
+    }
+    // Without a client everything is accepted and discarded
+    return (_clientFd >= 0) ? (int)_txBatch.space() : SOCKET_TX_BATCH_SIZE;
+}
+
+size_t SocketSerialPort::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t SocketSerialPort::write(const uint8_t* buffer, size_t size) {
+    if (!_isOpen) {
+        return 0;
+    }
+    if (_clientFd < 0) {
+        return size;
+    }
+    return _txBatch.write(buffer, size);
+}
+
+size_t SocketSerialPort::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t SocketSerialPort::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+void SocketSerialPort::sendBatch() {
+    while (_clientFd >= 0 && !_txBatch.empty()) {
+        const uint8_t* data;
+        size_t len = _txBatch.peek(&data);
+        ssize_t n = send(_clientFd, data, len, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                dropClient();
+            }
+            return;  // Socket buffer full: try again next iteration
+        }
+        _txBatch.consume((size_t)n);
+    }
+}
+
+void SocketSerialPort::flush() {
+    sendBatch();
+}
+
+void SocketSerialPort::service() {
+    if (_listenFd < 0) {
+        return;
+    }
+
+    acceptClient();
+
+    // Notice a hang-up even on ports whose device never reads (e.g., GPS)
+    if (_clientFd >= 0 && _rxHead >= _rxLen) {
+        fill();
+    }
+
+    sendBatch();
+}
+
+bool SocketSerialPort::isOpen() const {
+    return _isOpen;
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ISerialPort.h"
+#include "core/ByteRing.h"
+
+// Output batch size (must be a power of 2)
+// Writes made during one loop iteration are collected here and sent with a
+// single send() from service(), so a reply written in pieces (e.g., "FA...",
+// then ";") goes out as one segment even with TCP_NODELAY set
+#define SOCKET_TX_BATCH_SIZE 4096
+
+// Serial port served on a listening socket (serial-over-socket)
+// The address is "tcp:PORT", "tcp:HOST:PORT" or "unix:PATH"; TCP listens on
+// 127.0.0.1 unless a host is given. Like a serial line, one client is
+// attached at a time: further connections are refused until it disconnects.
+// While no client is attached, output is discarded as if nothing were
+// plugged into the port.
+class SocketSerialPort : public ISerialPort {
+public:
+    explicit SocketSerialPort(const char* address);
+    ~SocketSerialPort() override;
+
+    void begin(uint32_t baud, uint32_t config = SERIAL_8N1) override;
+    void end() override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t readAvailable(uint8_t* buffer, size_t length) override;
+    int availableForWrite() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t print(const char* str) override;
+    size_t println(const char* str) override;
+    void flush() override;
+    void service() override;
+    bool isOpen() const override;
+    const char* getPortName() const override { return _name; }
+
+    // True if the listening socket was created successfully
+    bool isValid() const { return _listenFd >= 0; }
+
+    // True if a client is connected
+    bool hasClient() const { return _clientFd >= 0; }
+
+private:
+    int _listenFd;
+    int _clientFd;
+    bool _isTcp;
+    bool _isOpen;
+    char _name[112];    // Canonical address, "unix:" + the socket path
+
+    // Read-ahead buffer so available() does not need a syscall per call
+    uint8_t _rxBuf[256];
+    size_t _rxHead;
+    size_t _rxLen;
+
+    ByteRing _txBatch;
+
+    void acceptClient();
+    void dropClient();
+    void fill();
+    void sendBatch();
+};
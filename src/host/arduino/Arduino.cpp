@@ -0,0 +1,180 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+
+static uint64_t monotonicMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static const uint64_t startMicros = monotonicMicros();
+
+static bool simulated = false;
+static uint64_t simulatedMicros = 0;
+
+static uint64_t elapsedMicros() {
+    return simulated ? simulatedMicros : monotonicMicros() - startMicros;
+}
+
+unsigned long millis() {
+    return (unsigned long)(elapsedMicros() / 1000ULL);
+}
+
+unsigned long micros() {
+    return (unsigned long)elapsedMicros();
+}
+
+void setSimulatedMicros(uint64_t us) {
+    simulated = true;
+    simulatedMicros = us;
+}
+
+void useRealClock() {
+    simulated = false;
+}
+
+void delay(unsigned long ms) {
+    usleep((useconds_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+    usleep(us);
+}
+
+char* dtostrf(double val, signed char width, unsigned char prec, char* buf) {
+    sprintf(buf, "%*.*f", width, prec, val);
+    return buf;
+}
+
+// === Print ===
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++) == 0) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+size_t Print::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t Print::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t Print::print(int value) {
+    char buf[12];
+    snprintf(buf, sizeof(buf), "%d", value);
+    return print(buf);
+}
+
+size_t Print::println(const char* str) {
+    size_t n = print(str);
+    return n + print("\r\n");
+}
+
+// === Stream ===
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = read();
+        if (c < 0) {
+            break;
+        }
+        buffer[count++] = (uint8_t)c;
+    }
+    return count;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    return readBytes((uint8_t*)buffer, length);
+}
+
+// === HardwareSerial (stdin/stdout console) ===
+
+HardwareSerial::HardwareSerial()
+    : _rxHead(0)
+    , _rxLen(0)
+    , _eof(false)
+{
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config) {
+    (void)baud;
+    (void)config;
+}
+
+void HardwareSerial::end() {
+}
+
+void HardwareSerial::fill() {
+    if (_rxHead < _rxLen || _eof) {
+        return;
+    }
+
+    // Only read when poll() says data is ready, so stdin can stay blocking
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    if (poll(&pfd, 1, 0) <= 0) {
+        return;
+    }
+
+    ssize_t n = ::read(STDIN_FILENO, _rxBuf, sizeof(_rxBuf));
+    if (n <= 0) {
+        _eof = true;
+        return;
+    }
+    _rxHead = 0;
+    _rxLen = (size_t)n;
+}
+
+int HardwareSerial::available() {
+    fill();
+    return (int)(_rxLen - _rxHead);
+}
+
+int HardwareSerial::read() {
+    fill();
+    if (_rxHead >= _rxLen) {
+        return -1;
+    }
+    return _rxBuf[_rxHead++];
+}
+
+int HardwareSerial::peek() {
+    fill();
+    if (_rxHead >= _rxLen) {
+        return -1;
+    }
+    return _rxBuf[_rxHead];
+}
+
+size_t HardwareSerial::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    size_t n = fwrite(buffer, 1, size, stdout);
+    fflush(stdout);
+    return n;
+}
+
+int HardwareSerial::availableForWrite() {
+    return 4096;
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
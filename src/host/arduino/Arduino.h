@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Minimal Arduino core API for the Linux host build (env:native)
+// Only what the emulator uses is provided. The console Serial object is
+// backed by stdin/stdout.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+// Serial frame configurations (data bits, parity, stop bits)
+// Encoding matches the AVR core: bits 1-2 = data bits - 5, bits 4-5 = parity
+// (0 none, 2 even, 3 odd), bit 3 = two stop bits
+#define SERIAL_5N1 0x00
+#define SERIAL_6N1 0x02
+#define SERIAL_7N1 0x04
+#define SERIAL_8N1 0x06
+#define SERIAL_5N2 0x08
+#define SERIAL_6N2 0x0A
+#define SERIAL_7N2 0x0C
+#define SERIAL_8N2 0x0E
+#define SERIAL_5E1 0x20
+#define SERIAL_6E1 0x22
+#define SERIAL_7E1 0x24
+#define SERIAL_8E1 0x26
+#define SERIAL_5E2 0x28
+#define SERIAL_6E2 0x2A
+#define SERIAL_7E2 0x2C
+#define SERIAL_8E2 0x2E
+#define SERIAL_5O1 0x30
+#define SERIAL_6O1 0x32
+#define SERIAL_7O1 0x34
+#define SERIAL_8O1 0x36
+#define SERIAL_5O2 0x38
+#define SERIAL_6O2 0x3A
+#define SERIAL_7O2 0x3C
+#define SERIAL_8O2 0x3E
+
+// Flash storage is ordinary memory on the host
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Time since program start
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Host only: hold millis() and micros() at a simulated time that moves
+// only when it is set again (for deterministic replays), until
+// useRealClock() is called
+void setSimulatedMicros(uint64_t us);
+void useRealClock();
+
+// Format a double into buf (width, decimals), as in avr-libc
+char* dtostrf(double val, signed char width, unsigned char prec, char* buf);
+
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t byte) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const char* str);
+    size_t print(char c);
+    size_t print(int value);
+    size_t println(const char* str = "");
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    // Reads only what is already buffered (the host console never waits)
+    size_t readBytes(uint8_t* buffer, size_t length);
+    size_t readBytes(char* buffer, size_t length);
+};
+
+// Console serial port on stdin/stdout
+class HardwareSerial : public Stream {
+public:
+    HardwareSerial();
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1);
+    void end();
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int availableForWrite() override;
+    void flush() override;
+    operator bool() const { return true; }
+
+    // True once stdin has been closed
+    bool atEof() const { return _eof; }
+
+private:
+    uint8_t _rxBuf[256];
+    size_t _rxHead;
+    size_t _rxLen;
+    bool _eof;
+
+    void fill();
+};
+
+extern HardwareSerial Serial;
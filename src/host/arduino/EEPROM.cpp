@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#include <EEPROM.h>
+
+EEPROMClass EEPROM;
+
+EEPROMClass::EEPROMClass()
+    : _data(nullptr)
+    , _size(0)
+    , _path(nullptr)
+{
+}
+
+EEPROMClass::~EEPROMClass() {
+    end();
+}
+
+void EEPROMClass::setBackingFile(const char* path) {
+    _path = path;
+}
+
+void EEPROMClass::begin(size_t size) {
+    end();
+
+    // Erased EEPROM reads as 0xFF
+    _data = new uint8_t[size];
+    _size = size;
+    memset(_data, 0xFF, size);
+
+    if (_path == nullptr) {
+        return;
+    }
+
+    FILE* f = fopen(_path, "rb");
+    if (f != nullptr) {
+        size_t n = fread(_data, 1, size, f);
+        (void)n;  // A short or missing image simply stays erased
+        fclose(f);
+    }
+}
+
+bool EEPROMClass::commit() {
+    if (_path == nullptr || _data == nullptr) {
+        return true;
+    }
+
+    FILE* f = fopen(_path, "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(_data, 1, _size, f) == _size;
+    fclose(f);
+    return ok;
+}
+
+void EEPROMClass::end() {
+    delete[] _data;
+    _data = nullptr;
+    _size = 0;
+}
+
+uint8_t EEPROMClass::read(int address) const {
+    if (address < 0 || (size_t)address >= _size) {
+        return 0xFF;
+    }
+    return _data[address];
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+    if (address >= 0 && (size_t)address < _size) {
+        _data[address] = value;
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+
+// File-backed EEPROM emulation for the Linux host build
+// Same API as the Pico/ESP32 cores: begin(size), get/put, commit()
+class EEPROMClass {
+public:
+    EEPROMClass();
+    ~EEPROMClass();
+
+    // Set the file that holds the EEPROM image (call before begin)
+    void setBackingFile(const char* path);
+
+    void begin(size_t size);
+    bool commit();
+    void end();
+
+    uint8_t read(int address) const;
+    void write(int address, uint8_t value);
+    void update(int address, uint8_t value) { write(address, value); }
+    size_t length() const { return _size; }
+
+    template <typename T>
+    T& get(int address, T& value) const {
+        if (address >= 0 && address + sizeof(T) <= _size) {
+            memcpy(&value, _data + address, sizeof(T));
+        } else {
+            memset(&value, 0xFF, sizeof(T));
+        }
+        return value;
+    }
+
+    template <typename T>
+    const T& put(int address, const T& value) {
+        if (address >= 0 && address + sizeof(T) <= _size) {
+            memcpy(_data + address, &value, sizeof(T));
+        }
+        return value;
+    }
+
+private:
+    uint8_t* _data;
+    size_t _size;
+    const char* _path;
+};
+
+extern EEPROMClass EEPROM;
@@ -11,6 +11,7 @@
 #include "devices/yaesu/YaesuDevice.h"
 #include "devices/g5500/G5500Device.h"
 #include "devices/nmea_gps/NMEAGPSDevice.h"
+#include "devices/icom/IcomDevice.h"
 
 // Global instances
 static DeviceManager deviceManager;
@@ -18,9 +19,15 @@ static ConsoleLogger logger(Serial);
 static Console* console = nullptr;
 
 // Device factories
-static YaesuDeviceFactory yaesuFactory;
+static YaesuDeviceFactory ft991aFactory(CAT_FT991A);
+static YaesuDeviceFactory ftdx10Factory(CAT_FTDX10);
+static YaesuDeviceFactory ts590Factory(CAT_TS590);
+static YaesuDeviceFactory ts2000Factory(CAT_TS2000);
+static YaesuDeviceFactory k3Factory(CAT_K3);
 static G5500DeviceFactory g5500Factory;
 static NMEAGPSDeviceFactory nmeaGpsFactory;
+static IcomDeviceFactory ic7300Factory(ICOM_IC7300);
+static IcomDeviceFactory ic9700Factory(ICOM_IC9700);
 
 void setup() {
     // Initialize console serial port
@@ -38,9 +45,15 @@ void setup() {
     deviceManager.setLogger(&logger);
 
     // Register device factories
-    deviceManager.registerFactory(&yaesuFactory);
+    deviceManager.registerFactory(&ft991aFactory);
+    deviceManager.registerFactory(&ftdx10Factory);
+    deviceManager.registerFactory(&ts590Factory);
+    deviceManager.registerFactory(&ts2000Factory);
+    deviceManager.registerFactory(&k3Factory);
     deviceManager.registerFactory(&g5500Factory);
     deviceManager.registerFactory(&nmeaGpsFactory);
+    deviceManager.registerFactory(&ic7300Factory);
+    deviceManager.registerFactory(&ic9700Factory);
 
     // Initialize configuration storage
     ConfigStorage::begin();
@@ -0,0 +1,622 @@
+// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>
+// SPDX-License-Identifier: MIT
+
+// Golden-trace regression runner (env:trace-replay)
+// Replays recorded client traffic against a device parser through an
+// in-memory loopback port, diffs every response against the golden
+// transcript, and reports throughput and per-command latency.
+//
+// Trace format (one entry per line, streamed, so traces can be any size):
+//   # comment
+//   @ ft-991a          select the parser (a CAT model such as ft-991a or
+//                      ts-590, g-5500, ic-7300 or ic-9700) and reset state;
+//                      a CAT model may add "band-map", "satellite" and
+//                      latency options ("read_latency=30")
+//   > FA;              bytes the client sends (one command)
+//   < FA014074000;     expected response, may span several '<' lines
+// Escapes: \r \n \\ \xNN. A command with no '<' lines expects no response.
+// tools/capture_decode.py -f trace turns a capture into a trace.
+
+#include <Arduino.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "core/LoopbackSerialPort.h"
+#include "devices/yaesu/CATParser.h"
+#include "devices/yaesu/YaesuSatellite.h"
+#include "devices/g5500/GS232Parser.h"
+#include "devices/icom/IcomDevice.h"
+
+// Longest trace line
+#define TRACE_LINE_SIZE 1024
+
+// Largest response collected for one command
+#define TRACE_RESPONSE_SIZE 2048
+
+// Mismatches printed before the rest are only counted
+#define DEFAULT_MAX_REPORTS 10
+
+// Latency histogram: power-of-2 ranges of nanoseconds, each split into
+// 8 linear sub-buckets (about 12% resolution at any scale)
+#define HIST_SUB_BITS 3
+#define HIST_SUB_COUNT (1 << HIST_SUB_BITS)
+#define HIST_RANGES 40
+#define HIST_BUCKETS (HIST_RANGES * HIST_SUB_COUNT)
+
+struct LatencyHistogram {
+    uint64_t counts[HIST_BUCKETS];
+    uint64_t total;
+    uint64_t maxNs;
+    uint64_t sumNs;
+};
+
+static size_t histBucket(uint64_t ns) {
+    if (ns < HIST_SUB_COUNT) {
+        return (size_t)ns;
+    }
+    int msb = 63 - __builtin_clzll(ns);
+    size_t range = (size_t)(msb - HIST_SUB_BITS + 1);
+    size_t sub = (size_t)(ns >> (msb - HIST_SUB_BITS)) & (HIST_SUB_COUNT - 1);
+    size_t bucket = range * HIST_SUB_COUNT + sub;
+    return (bucket < HIST_BUCKETS) ? bucket : HIST_BUCKETS - 1;
+}
+
+// Upper bound of a bucket in nanoseconds
+static uint64_t histBucketLimit(size_t bucket) {
+    size_t range = bucket / HIST_SUB_COUNT;
+    size_t sub = bucket % HIST_SUB_COUNT;
+    if (range == 0) {
+        return sub + 1;
+    }
+    int shift = (int)range - 1;
+    return ((uint64_t)(HIST_SUB_COUNT + sub + 1)) << shift;
+}
+
+static void histRecord(LatencyHistogram& hist, uint64_t ns) {
+    hist.counts[histBucket(ns)]++;
+    hist.total++;
+    hist.sumNs += ns;
+    if (ns > hist.maxNs) {
+        hist.maxNs = ns;
+    }
+}
+
+static uint64_t histPercentile(const LatencyHistogram& hist, double pct) {
+    uint64_t target = (uint64_t)(hist.total * pct / 100.0 + 0.5);
+    if (target == 0) {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < HIST_BUCKETS; i++) {
+        seen += hist.counts[i];
+        if (seen >= target) {
+            uint64_t limit = histBucketLimit(i);
+            return (limit < hist.maxNs) ? limit : hist.maxNs;
+        }
+    }
+    return hist.maxNs;
+}
+
+static uint64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Decode escapes in place, returns decoded length
+static size_t unescape(char* text) {
+    char* out = text;
+    for (const char* in = text; *in != '\0'; in++) {
+        if (*in != '\\' || in[1] == '\0') {
+            *out++ = *in;
+            continue;
+        }
+        in++;
+        switch (*in) {
+            case 'r': *out++ = '\r'; break;
+            case 'n': *out++ = '\n'; break;
+            case 'x':
+                if (isxdigit((unsigned char)in[1]) && isxdigit((unsigned char)in[2])) {
+                    char hex[3] = {in[1], in[2], '\0'};
+                    *out++ = (char)strtol(hex, nullptr, 16);
+                    in += 2;
+                } else {
+                    *out++ = 'x';
+                }
+                break;
+            default: *out++ = *in; break;
+        }
+    }
+    return (size_t)(out - text);
+}
+
+// Write bytes with the trace escapes
+static void printEscaped(FILE* out, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+        if (c == '\r') {
+            fputs("\\r", out);
+        } else if (c == '\n') {
+            fputs("\\n", out);
+        } else if (c == '\\') {
+            fputs("\\\\", out);
+        } else if (c >= 32 && c < 127) {
+            fputc(c, out);
+        } else {
+            fprintf(out, "\\x%02X", c);
+        }
+    }
+}
+
+// Parser under test, driven through a loopback pair
+class ReplayTarget {
+public:
+    explicit ReplayTarget(bool useCache)
+        : _useCache(useCache)
+        , _cat(nullptr)
+        , _gs232(nullptr)
+        , _icom(nullptr)
+        , _delayed(false)
+        , _clock(0)
+    {
+        memset(&_replies, 0, sizeof(_replies));
+        _pair.device().begin(DEFAULT_DEVICE_BAUD);
+        _pair.client().begin(DEFAULT_DEVICE_BAUD);
+    }
+
+    ~ReplayTarget() {
+        clear();
+    }
+
+    // Select the parser by device type, with fresh state
+    // A CAT model may be followed by "band-map" ("ft-991a band-map") to
+    // turn on the band-activity map, by "satellite" to hear the built-in
+    // satellite from the start of its first pass, and by the latency
+    // options as name=ms ("ft-991a read_latency=30 set_latency=150")
+    bool select(const char* type) {
+        clear();
+        _clock = 0;
+        char words[128];
+        snprintf(words, sizeof(words), "%s", type);
+        char* rest = nullptr;
+        const char* name = strtok_r(words, " ", &rest);
+        bool bandMap = false;
+        bool satellite = false;
+        uint16_t latency[4] = { 0, 0, 0, 0 };
+        bool known = (name != nullptr);
+        for (char* word = strtok_r(nullptr, " ", &rest); word != nullptr;
+             word = strtok_r(nullptr, " ", &rest)) {
+            if (strcasecmp(word, "band-map") == 0) {
+                bandMap = true;
+            } else if (strcasecmp(word, "satellite") == 0) {
+                satellite = true;
+            } else if (!latencyWord(word, latency)) {
+                known = false;
+            }
+        }
+        const CATModel* model = known ? findCATModel(name) : nullptr;
+
+        if (model != nullptr) {
+            _yaesu.reset();
+            _memory.reset();
+            _bandMap.setEnabled(bandMap);
+            _bandMap.setFloor(0);
+            _bandMap.setTime(_clock);
+            _satellite = YaesuSatellite();
+            _satellite.setEnabled(satellite);
+            if (satellite) {
+                _satellite.findPass(_clock);
+            }
+            memcpy_P(&_model, model, sizeof(_model));
+            _cat = new CATParser(_model, _yaesu, _pair.device(),
+                                 _useCache ? &_replyCache : nullptr, &_memory, &_bandMap);
+            _delayed = latency[0] != 0 || latency[1] != 0 || latency[2] != 0 || latency[3] != 0;
+            if (_delayed) {
+                // Latency is timed by micros(), which follows the trace clock
+                setSimulatedMicros(0);
+                _cat->setLatency(ReplyClass::READ, latency[0], latency[1]);
+                _cat->setLatency(ReplyClass::SET, latency[2], latency[3]);
+            }
+        } else if (strcasecmp(type, "g-5500") == 0) {
+            _g5500.reset();
+            _gs232 = new GS232Parser(_g5500, _pair.device());
+        } else if (strcasecmp(type, "ic-7300") == 0 || strcasecmp(type, "ic-9700") == 0) {
+            // A radio alone on its CI-V bus, with echo and transceive on
+            const IcomModel& model = (strcasecmp(type, "ic-7300") == 0) ? ICOM_IC7300 : ICOM_IC9700;
+            _icom = new IcomDevice(&_pair.device(), 1, model);
+            _icom->begin();
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool isSelected() const { return _cat != nullptr || _gs232 != nullptr || _icom != nullptr; }
+
+    // Reply counters of every parser used so far
+    ReplyStats replyStats() const {
+        ReplyStats total = _replies;
+        addReplyStats(total);
+        return total;
+    }
+
+    // CAT reply cache counters
+    const YaesuReplyCache& replyCache() const { return _replyCache; }
+
+    // Send one command and collect the response, returns response length
+    // For CAT radios this includes Auto-Information reports: commands are
+    // taken to be CAT_AI_INTERVAL_MS apart, so every change is reported
+    // right after the command that made it, as YaesuDevice::update() does.
+    // With a latency, the parser is run every millisecond of the interval,
+    // so the response is what the radio sends in the 100 ms after the
+    // command: replies due later come with a later command's response.
+    size_t exchange(const char* command, size_t len, uint8_t* response, size_t size) {
+        _pair.client().write((const uint8_t*)command, len);
+        if (_cat != nullptr) {
+            _satellite.update(_yaesu, _clock);
+            _satellite.retune(_yaesu, _bandMap);
+            _bandMap.setTime(_clock);
+            _bandMap.retune(_yaesu);
+            _cat->update();
+            if (_delayed) {
+                for (uint32_t ms = 1; ms < CAT_AI_INTERVAL_MS; ms++) {
+                    setSimulatedMicros(((uint64_t)_clock + ms) * 1000ULL);
+                    _cat->update();
+                }
+            }
+            _clock += CAT_AI_INTERVAL_MS;
+            if (_delayed) {
+                setSimulatedMicros((uint64_t)_clock * 1000ULL);
+            }
+            _cat->autoInfo(_yaesu.takeChanges(), _clock);
+        } else if (_icom != nullptr) {
+            _icom->update();
+        } else {
+            _gs232->update();
+        }
+        return _pair.client().readAvailable(response, size);
+    }
+
+private:
+    LoopbackSerialPair _pair;
+    YaesuState _yaesu;
+    YaesuReplyCache _replyCache;
+    YaesuMemory _memory;
+    YaesuBandMap _bandMap;
+    YaesuSatellite _satellite;
+    CATModel _model;      // Copy of the selected CAT model's descriptor
+    bool _useCache;
+    G5500State _g5500;
+    CATParser* _cat;
+    GS232Parser* _gs232;
+    IcomDevice* _icom;
+    bool _delayed;        // CAT latency set, timed by the trace clock
+    ReplyStats _replies;  // Counters of parsers already deleted
+    uint32_t _clock;      // Simulated millis() for Auto-Information, the band
+                          // map and the satellite pass
+
+    // Add the current parser's counters to total
+    void addReplyStats(ReplyStats& total) const {
+        const ReplyStats* stats = nullptr;
+        if (_cat != nullptr) {
+            stats = &_cat->getReplyStats();
+        } else if (_gs232 != nullptr) {
+            stats = &_gs232->getReplyStats();
+        } else if (_icom != nullptr) {
+            stats = &_icom->getCivBus()->getReplyStats();
+        }
+        if (stats == nullptr) {
+            return;
+        }
+        total.replies += stats->replies;
+        total.writes += stats->writes;
+        if (stats->maxBatch > total.maxBatch) {
+            total.maxBatch = stats->maxBatch;
+        }
+    }
+
+    // Parse a latency option word ("read_jitter=10") into latency: read
+    // latency and jitter, set latency and jitter (ms); false if it is not one
+    static bool latencyWord(const char* word, uint16_t latency[4]) {
+        static const char* const NAMES[4] = {
+            "read_latency", "read_jitter", "set_latency", "set_jitter"
+        };
+        for (size_t i = 0; i < 4; i++) {
+            size_t len = strlen(NAMES[i]);
+            if (strncasecmp(word, NAMES[i], len) != 0 || word[len] != '=') {
+                continue;
+            }
+            char* end = nullptr;
+            unsigned long ms = strtoul(word + len + 1, &end, 10);
+            if (end == word + len + 1 || *end != '\0' || ms > REPLY_LATENCY_MAX_MS) {
+                return false;
+            }
+            latency[i] = (uint16_t)ms;
+            return true;
+        }
+        return false;
+    }
+
+    void clear() {
+        addReplyStats(_replies);
+        if (_delayed) {
+            useRealClock();
+            _delayed = false;
+        }
+
+        delete _cat;
+        _cat = nullptr;
+        delete _gs232;
+        _gs232 = nullptr;
+        if (_icom != nullptr) {
+            // The radio closes the port when it leaves the bus
+            delete _icom;
+            _icom = nullptr;
+            _pair.device().begin(DEFAULT_DEVICE_BAUD);
+        }
+
+        // Drop anything left over from the previous trace
+        uint8_t discard[64];
+        while (_pair.device().readAvailable(discard, sizeof(discard)) > 0) {
+        }
+        while (_pair.client().readAvailable(discard, sizeof(discard)) > 0) {
+        }
+    }
+};
+
+// Replay state for the command in progress
+struct PendingCommand {
+    bool active;
+    unsigned long line;
+    char command[TRACE_LINE_SIZE];
+    size_t commandLen;
+    uint8_t expected[TRACE_RESPONSE_SIZE];
+    size_t expectedLen;
+};
+
+struct ReplayStats {
+    uint64_t commands;
+    uint64_t mismatches;
+    uint64_t busyNs;
+    LatencyHistogram latency;
+};
+
+struct ReplayOptions {
+    const char* defaultType;
+    unsigned long maxReports;
+    FILE* record;  // Write actual responses here as a new golden trace
+    bool noCache;  // Format every FT-991A reply (to measure the reply cache)
+};
+
+static void runPending(ReplayTarget& target, PendingCommand& cmd, ReplayStats& stats,
+                       const ReplayOptions& opts, const char* path) {
+    if (!cmd.active) {
+        return;
+    }
+    cmd.active = false;
+
+    uint8_t actual[TRACE_RESPONSE_SIZE];
+    uint64_t start = nowNs();
+    size_t actualLen = target.exchange(cmd.command, cmd.commandLen, actual, sizeof(actual));
+    uint64_t elapsed = nowNs() - start;
+
+    stats.commands++;
+    stats.busyNs += elapsed;
+    histRecord(stats.latency, elapsed);
+
+    if (opts.record != nullptr) {
+        fputs("> ", opts.record);
+        printEscaped(opts.record, (const uint8_t*)cmd.command, cmd.commandLen);
+        fputc('\n', opts.record);
+        if (actualLen > 0) {
+            fputs("< ", opts.record);
+            printEscaped(opts.record, actual, actualLen);
+            fputc('\n', opts.record);
+        }
+        return;
+    }
+
+    if (actualLen == cmd.expectedLen && memcmp(actual, cmd.expected, actualLen) == 0) {
+        return;
+    }
+
+    stats.mismatches++;
+    if (stats.mismatches <= opts.maxReports) {
+        fprintf(stderr, "%s:%lu: ", path, cmd.line);
+        printEscaped(stderr, (const uint8_t*)cmd.command, cmd.commandLen);
+        fputs("\n  expected: ", stderr);
+        printEscaped(stderr, cmd.expected, cmd.expectedLen);
+        fputs("\n  actual:   ", stderr);
+        printEscaped(stderr, actual, actualLen);
+        fputc('\n', stderr);
+    }
+}
+
+// Stream one trace file through the target
+static bool replayFile(const char* path, ReplayTarget& target, ReplayStats& stats,
+                       const ReplayOptions& opts) {
+    FILE* in = fopen(path, "r");
+    if (in == nullptr) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    if (opts.defaultType != nullptr) {
+        target.select(opts.defaultType);
+    }
+
+    static PendingCommand cmd;
+    cmd.active = false;
+
+    char line[TRACE_LINE_SIZE];
+    unsigned long lineNo = 0;
+    bool ok = true;
+
+    while (fgets(line, sizeof(line), in) != nullptr) {
+        lineNo++;
+        size_t len = strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+            line[--len] = '\0';
+        }
+        if (len == 0 || line[0] == '#') {
+            continue;
+        }
+
+        // Text after the marker and one optional space
+        char* text = line + 1;
+        if (*text == ' ') {
+            text++;
+        }
+
+        switch (line[0]) {
+            case '@':
+                runPending(target, cmd, stats, opts, path);
+                if (!target.select(text)) {
+                    fprintf(stderr, "%s:%lu: unknown device type '%s'\n", path, lineNo, text);
+                    ok = false;
+                }
+                if (opts.record != nullptr) {
+                    fprintf(opts.record, "@ %s\n", text);
+                }
+                break;
+
+            case '>':
+                runPending(target, cmd, stats, opts, path);
+                if (!target.isSelected()) {
+                    fprintf(stderr, "%s:%lu: no device type selected (use '@ type' or -d)\n",
+                            path, lineNo);
+                    ok = false;
+                    break;
+                }
+                cmd.commandLen = unescape(text);
+                memcpy(cmd.command, text, cmd.commandLen);
+                cmd.expectedLen = 0;
+                cmd.line = lineNo;
+                cmd.active = true;
+                break;
+
+            case '<': {
+                size_t n = unescape(text);
+                if (!cmd.active || cmd.expectedLen + n > sizeof(cmd.expected)) {
+                    fprintf(stderr, "%s:%lu: unexpected response line\n", path, lineNo);
+                    ok = false;
+                    break;
+                }
+                memcpy(&cmd.expected[cmd.expectedLen], text, n);
+                cmd.expectedLen += n;
+                break;
+            }
+
+            default:
+                fprintf(stderr, "%s:%lu: unknown line type '%c'\n", path, lineNo, line[0]);
+                ok = false;
+                break;
+        }
+
+        if (!ok) {
+            break;
+        }
+    }
+    runPending(target, cmd, stats, opts, path);
+
+    fclose(in);
+    return ok;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+            "Usage: %s [-d type] [-n repeat] [-m max-reports] [-r out-trace] [-C] trace...\n"
+            "  -d type    Device type for traces without an '@' line (ft-991a, ftdx10,\n"
+            "             ts-590, ts-2000, k3, g-5500, ic-7300, ic-9700)\n"
+            "  -n count   Replay the traces count times (for benchmarking)\n"
+            "  -m count   Mismatches to print in full (default %d)\n"
+            "  -r file    Record actual responses as a new golden trace instead of diffing\n"
+            "  -C         Disable the CAT reply cache\n",
+            prog, DEFAULT_MAX_REPORTS);
+}
+
+int main(int argc, char** argv) {
+    ReplayOptions opts;
+    opts.defaultType = nullptr;
+    opts.maxReports = DEFAULT_MAX_REPORTS;
+    opts.record = nullptr;
+    opts.noCache = false;
+    unsigned long repeat = 1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "d:n:m:r:Ch")) != -1) {
+        switch (opt) {
+            case 'd':
+                opts.defaultType = optarg;
+                break;
+            case 'n':
+                repeat = strtoul(optarg, nullptr, 10);
+                break;
+            case 'm':
+                opts.maxReports = strtoul(optarg, nullptr, 10);
+                break;
+            case 'r':
+                opts.record = fopen(optarg, "w");
+                if (opts.record == nullptr) {
+                    fprintf(stderr, "Cannot create %s\n", optarg);
+                    return 2;
+                }
+                break;
+            case 'C':
+                opts.noCache = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    static ReplayStats stats;
+    ReplayTarget target(!opts.noCache);
+
+    uint64_t wallStart = nowNs();
+    for (unsigned long r = 0; r < repeat; r++) {
+        for (int i = optind; i < argc; i++) {
+            if (!replayFile(argv[i], target, stats, opts)) {
+                return 2;
+            }
+        }
+    }
+    uint64_t wallNs = nowNs() - wallStart;
+
+    if (opts.record != nullptr) {
+        fclose(opts.record);
+    }
+
+    const LatencyHistogram& lat = stats.latency;
+    ReplyStats replies = target.replyStats();
+    printf("Commands:    %llu\n", (unsigned long long)stats.commands);
+    printf("Mismatches:  %llu\n", (unsigned long long)stats.mismatches);
+    printf("Replies:     %lu in %lu writes (%lu writes saved, up to %u per write)\n",
+           (unsigned long)replies.replies, (unsigned long)replies.writes,
+           (unsigned long)(replies.replies - replies.writes), (unsigned)replies.maxBatch);
+    const YaesuReplyCache& cache = target.replyCache();
+    if (cache.getHits() + cache.getMisses() > 0) {
+        printf("Cache:       %lu hits, %lu misses\n",
+               (unsigned long)cache.getHits(), (unsigned long)cache.getMisses());
+    }
+    if (stats.commands > 0) {
+        printf("Throughput:  %.0f commands/s in parser, %.0f commands/s overall\n",
+               stats.commands * 1e9 / (double)stats.busyNs,
+               stats.commands * 1e9 / (double)wallNs);
+        printf("Latency ns:  mean %.0f  p50 %llu  p90 %llu  p99 %llu  p99.9 %llu  max %llu\n",
+               (double)lat.sumNs / lat.total,
+               (unsigned long long)histPercentile(lat, 50.0),
+               (unsigned long long)histPercentile(lat, 90.0),
+               (unsigned long long)histPercentile(lat, 99.0),
+               (unsigned long long)histPercentile(lat, 99.9),
+               (unsigned long long)lat.maxNs);
+    }
+
+    return stats.mismatches > 0 ? 1 : 0;
+}
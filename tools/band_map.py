@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Generate the FT-991A band-activity map (src/devices/yaesu/YaesuBandMapData.h).
+
+The map is a list of simulated stations: frequency, bandwidth, S-meter
+strength and an on-air schedule. It is made up, but shaped like a busy
+contest weekend: FT8 and FT4 sub-bands full of signals on 15-second
+slots, CW and SSB QSOs, the NCDXF beacon cycle, and FM repeaters on
+2 m and 70 cm. The output is deterministic for a given seed.
+
+The schedule is a bitmask over eight 15-second slots (a 2-minute cycle):
+bit n set means the station is on the air in slot n. FT8 stations use
+0x55 (even slots) or 0xAA (odd slots).
+
+Usage:
+    band_map.py                          # write the header in the repo
+    band_map.py -o out.h --seed 7        # another map
+"""
+
+import argparse
+import os
+import random
+import sys
+
+# Dial frequency (Hz) of the FT8 and FT4 sub-bands, CW and SSB segments
+HF_BANDS = [
+    # name    FT8       FT4       CW start  CW end    SSB start  SSB end
+    ("160m", 1840000, 1840000, 1810000, 1840000, 1843000, 1990000),
+    ("80m", 3573000, 3575000, 3500000, 3570000, 3600000, 3800000),
+    ("40m", 7074000, 7047500, 7000000, 7040000, 7100000, 7200000),
+    ("30m", 10136000, 10140000, 10100000, 10130000, None, None),
+    ("20m", 14074000, 14080000, 14000000, 14070000, 14100000, 14350000),
+    ("17m", 18100000, 18104000, 18068000, 18095000, 18111000, 18168000),
+    ("15m", 21074000, 21140000, 21000000, 21070000, 21151000, 21450000),
+    ("12m", 24915000, 24919000, 24890000, 24915000, 24931000, 24990000),
+    ("10m", 28074000, 28180000, 28000000, 28070000, 28300000, 28700000),
+    ("6m", 50313000, 50318000, 50000000, 50100000, 50100000, 50300000),
+]
+
+# NCDXF/IARU beacons: 18 stations, 10 seconds each on every frequency; a
+# 15-second slot approximates one station's turn
+BEACON_FREQS = [14100000, 18110000, 21150000, 24930000, 28200000]
+
+FM_SEGMENTS = [
+    # start      end        channel  count
+    (145600000, 145800000, 12500, 16),
+    (146610000, 147390000, 15000, 30),
+    (438000000, 440000000, 25000, 20),
+    (442000000, 445000000, 25000, 30),
+]
+
+# Widths are stored in 100 Hz units (rounded up), in one byte
+MAX_WIDTH = 25500
+
+
+def s_units(rng, low, high):
+    """Strength in S-meter units (0-255, S9 is about 130)."""
+    return rng.randint(low, high)
+
+
+def qso_schedule(rng):
+    """Schedule of one side of a QSO: a run of slots, or always on."""
+    return rng.choice([0xFF, 0x0F, 0xF0, 0x33, 0xCC, 0x3C, 0xC3, 0x77, 0xEE])
+
+
+def generate(seed):
+    rng = random.Random(seed)
+    signals = []
+
+    def add(freq, width, strength, schedule):
+        signals.append((freq, min(width, MAX_WIDTH), strength, schedule))
+
+    for _, ft8, ft4, cw_start, cw_end, ssb_start, ssb_end in HF_BANDS:
+        # FT8: audio offsets 200-3000 Hz above the dial, 50 Hz wide
+        for _ in range(60):
+            add(ft8 + rng.randrange(200, 3000, 5), 50, s_units(rng, 10, 150),
+                rng.choice([0x55, 0xAA]))
+        # FT4: 90 Hz wide, shorter slots, most slots used
+        for _ in range(20):
+            add(ft4 + rng.randrange(200, 3000, 5), 90, s_units(rng, 10, 130),
+                rng.choice([0x55, 0xAA, 0xFF]))
+        # CW: 150 Hz wide, on 10 Hz steps
+        for _ in range(60):
+            add(rng.randrange(cw_start, cw_end, 10), 150, s_units(rng, 5, 170),
+                qso_schedule(rng))
+        # SSB: 2.7 kHz wide, on 1 kHz steps
+        if ssb_start is not None:
+            for _ in range(40):
+                add(rng.randrange(ssb_start, ssb_end, 1000) + 1500, 2700,
+                    s_units(rng, 20, 190), qso_schedule(rng))
+
+    for freq in BEACON_FREQS:
+        for slot in range(8):
+            add(freq, 100, s_units(rng, 10, 120), 1 << slot)
+
+    for start, end, step, count in FM_SEGMENTS:
+        channels = list(range(start, end, step))
+        for freq in rng.sample(channels, min(count, len(channels))):
+            add(freq, 12500, s_units(rng, 60, 220), rng.choice([0xFF, 0x0F, 0x81, 0x18]))
+
+    signals.sort()
+    return signals
+
+
+def write_header(signals, path, seed):
+    max_width = max(s[1] for s in signals)
+    lines = []
+    lines.append("// Copyright (c) 2025 Andrew C. Young <andrew@vaelen.org>")
+    lines.append("// SPDX-License-Identifier: MIT")
+    lines.append("")
+    lines.append("// Generated by tools/band_map.py --seed %d; do not edit" % seed)
+    lines.append("")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("#define BAND_MAP_COUNT %d" % len(signals))
+    lines.append("#define BAND_MAP_MAX_WIDTH %d  // Hz" % max_width)
+    lines.append("")
+    lines.append("// Station frequencies (Hz), ascending")
+    lines.append("static const uint32_t BAND_MAP_FREQS[BAND_MAP_COUNT] PROGMEM = {")
+    for i in range(0, len(signals), 6):
+        row = ", ".join("%9dUL" % s[0] for s in signals[i:i + 6])
+        lines.append("    " + row + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Width (100 Hz units), strength (S-meter units), schedule (slot mask)")
+    lines.append("static const uint8_t BAND_MAP_INFO[BAND_MAP_COUNT][3] PROGMEM = {")
+    for i in range(0, len(signals), 6):
+        row = ", ".join("{%3d, %3d, 0x%02X}" % ((s[1] + 99) // 100, s[2], s[3])
+                        for s in signals[i:i + 6])
+        lines.append("    " + row + ",")
+    lines.append("};")
+    lines.append("")
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    default_out = os.path.join(here, "..", "src", "devices", "yaesu", "YaesuBandMapData.h")
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", default=default_out, help="header to write")
+    parser.add_argument("--seed", type=int, default=1, help="random seed")
+    args = parser.parse_args()
+
+    signals = generate(args.seed)
+    write_header(signals, args.output, args.seed)
+    print("%d signals, %d bytes of flash" % (len(signals), len(signals) * 7), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
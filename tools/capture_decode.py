@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Decode a serial capture into a transcript, CSV, pcap or replay trace.
+
+Input is either the capture file written by the host build (-c file) or the
+text printed by the console's `capture dump` command (the hex lines between
+the "-- capture begin --" and "-- capture end --" markers; other lines are
+ignored, so a whole terminal log can be passed in).
+
+Usage:
+    capture_decode.py capture.bin                 # transcript to stdout
+    capture_decode.py -f csv capture.bin -o out.csv
+    capture_decode.py -f pcap console.log -o out.pcap
+    capture_decode.py -f trace -u 1 -d ft-991a capture.bin -o radio.trace
+
+A trace is the input of the trace-replay tool: each received chunk becomes a
+'>' line and each transmitted chunk a '<' line.
+"""
+
+import argparse
+import struct
+import sys
+
+CAPTURE_MAGIC = 0x50414353
+CAPTURE_VERSION = 1
+HEADER = struct.Struct("<IB3xIIII")
+RECORD_HEADER = 6
+DIR_TX = 0x80
+
+# pcap link type for private use; each packet is one record, prefixed with
+# the record's port byte (UART index | 0x80 for TX)
+LINKTYPE_USER0 = 147
+
+
+def load(path):
+    with open(path, "rb") as f:
+        raw = f.read()
+
+    if len(raw) >= 4 and struct.unpack_from("<I", raw)[0] == CAPTURE_MAGIC:
+        return raw
+
+    # Console hex dump
+    text = raw.decode("ascii", errors="replace")
+    data = bytearray()
+    inside = False
+    for line in text.splitlines():
+        line = line.strip()
+        if line == "-- capture begin --":
+            inside = True
+            data.clear()
+        elif line == "-- capture end --":
+            inside = False
+        elif inside and line:
+            data.extend(bytes.fromhex(line))
+    if not data:
+        sys.exit("%s: not a capture file or capture dump" % path)
+    return bytes(data)
+
+
+def records(buf):
+    """Yield (time_us, uart, is_tx, data) in capture order."""
+    magic, version, capacity, head, tail, overwritten = HEADER.unpack_from(buf)
+    if magic != CAPTURE_MAGIC or version != CAPTURE_VERSION:
+        sys.exit("Unsupported capture (magic %08x, version %d)" % (magic, version))
+
+    ring = buf[HEADER.size:HEADER.size + capacity]
+    if len(ring) < capacity:
+        sys.exit("Capture is truncated")
+    mask = capacity - 1
+
+    def take(offset, length):
+        start = offset & mask
+        end = start + length
+        if end <= capacity:
+            return ring[start:end]
+        return ring[start:] + ring[:end - capacity]
+
+    if overwritten:
+        print("note: %d older records were overwritten" % overwritten, file=sys.stderr)
+
+    # micros() wraps every ~71 minutes; unwrap into a 64-bit timeline
+    base = 0
+    last = None
+    offset = tail
+    while (head - offset) & 0xFFFFFFFF >= RECORD_HEADER:
+        stamp, port, length = struct.unpack("<IBB", take(offset, RECORD_HEADER))
+        if (head - offset) & 0xFFFFFFFF < RECORD_HEADER + length:
+            break
+        if last is not None and stamp < last and last - stamp > 0x80000000:
+            base += 1 << 32
+        last = stamp
+        yield base + stamp, port & 0x7F, bool(port & DIR_TX), take(offset + RECORD_HEADER, length)
+        offset = (offset + RECORD_HEADER + length) & 0xFFFFFFFF
+
+
+def escape(data):
+    out = []
+    for b in data:
+        if b == 0x0D:
+            out.append("\\r")
+        elif b == 0x0A:
+            out.append("\\n")
+        elif b == 0x5C:
+            out.append("\\\\")
+        elif 0x20 <= b < 0x7F:
+            out.append(chr(b))
+        else:
+            out.append("\\x%02x" % b)
+    return "".join(out)
+
+
+def write_text(recs, out):
+    start = None
+    for t, uart, tx, data in recs:
+        if start is None:
+            start = t
+        out.write("%12.6f  UART%-2d %s  %s\n" % ((t - start) / 1e6, uart,
+                                               "TX" if tx else "RX", escape(data)))
+
+
+def write_csv(recs, out):
+    out.write("time_us,uart,direction,length,hex,text\n")
+    for t, uart, tx, data in recs:
+        text = escape(data).replace('"', '""')
+        out.write('%d,%d,%s,%d,%s,"%s"\n' % (t, uart, "TX" if tx else "RX",
+                                           len(data), data.hex(), text))
+
+
+def write_trace(recs, out, device):
+    if device:
+        out.write("@ %s\n" % device)
+    uart = None
+    skipped = 0
+    started = False
+    for t, rec_uart, tx, data in recs:
+        if uart is None:
+            uart = rec_uart
+        elif rec_uart != uart:
+            sys.exit("A trace holds one UART; select it with -u")
+        if tx and not started:
+            skipped += 1
+            continue
+        started = True
+        out.write("%s %s\n" % ("<" if tx else ">", escape(data)))
+    if skipped:
+        print("note: skipped %d records sent before the first command" % skipped,
+              file=sys.stderr)
+
+
+def write_pcap(recs, out):
+    out.write(struct.pack("<IHHiIII", 0xA1B2C3D4, 2, 4, 0, 0, 65535, LINKTYPE_USER0))
+    for t, uart, tx, data in recs:
+        payload = bytes([uart | (DIR_TX if tx else 0)]) + data
+        out.write(struct.pack("<IIII", t // 1000000, t % 1000000, len(payload), len(payload)))
+        out.write(payload)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="capture file or console log with a capture dump")
+    parser.add_argument("-f", "--format", choices=("text", "csv", "pcap", "trace"),
+                        default="text")
+    parser.add_argument("-o", "--output", help="output file (default stdout)")
+    parser.add_argument("-u", "--uart", type=int, action="append",
+                        help="only include this UART (may be repeated)")
+    parser.add_argument("-d", "--device", help="device type for the trace '@' line")
+    args = parser.parse_args()
+
+    recs = records(load(args.input))
+    if args.uart:
+        recs = (r for r in recs if r[1] in args.uart)
+
+    if args.format == "pcap":
+        if args.output:
+            out = open(args.output, "wb")
+        else:
+            out = sys.stdout.buffer
+        write_pcap(recs, out)
+    else:
+        out = open(args.output, "w", newline="") if args.output else sys.stdout
+        if args.format == "csv":
+            write_csv(recs, out)
+        elif args.format == "trace":
+            write_trace(recs, out, args.device)
+        else:
+            write_text(recs, out)
+
+    if args.output:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()